@@ -0,0 +1,96 @@
+/**
+ * @file ZArena.cpp
+ * @brief Implementation of the ZArena class for the ZincX framework.
+ *
+ * Blocks are kept in allocation order and current_ only moves forward between rewinds, so every
+ * block after current_ is empty and a rewind only has to zero the blocks it passes over. Objects
+ * with destructors are threaded onto a list whose nodes live in the arena next to the objects;
+ * a marker records the list head, which makes rewinding to it a pop until that head.
+ */
+#include "ZArena.h"
+#include "ZCommon.h"
+#include <algorithm>
+
+namespace ZincX {
+
+ZArena::ZArena(std::size_t blockBytes) : blockBytes_(std::max<std::size_t>(blockBytes, 1)) {}
+
+ZArena::~ZArena() {
+    runFinalizers(nullptr);
+    releaseBlocks();
+}
+
+ZArena& ZArena::frame() {
+    thread_local ZArena arena;
+    return arena;
+}
+
+void* ZArena::allocate(std::size_t bytes, std::size_t alignment) {
+    bytes = std::max<std::size_t>(bytes, 1);
+    auto fit = [bytes, alignment](Block& block) -> void* {
+        const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.data);
+        const std::size_t offset = ((base + block.used + alignment - 1) & ~(alignment - 1)) - base;
+        if (offset + bytes > block.capacity) return nullptr;
+        block.used = offset + bytes;
+        return block.data + offset;
+    };
+    // The current block, then blocks kept from before the last rewind, then a new one.
+    for (; current_ < blocks_.size(); ++current_) {
+        if (void* p = fit(blocks_[current_])) return p;
+    }
+    const std::size_t capacity = std::max(blockBytes_, bytes + alignment);
+    blocks_.push_back({ static_cast<unsigned char*>(::operator new(capacity)), capacity, 0 });
+    current_ = blocks_.size() - 1;
+    return fit(blocks_.back());
+}
+
+void ZArena::rewind(const Marker& marker) {
+    runFinalizers(marker.finalizers);
+    if (blocks_.empty()) return;
+    for (std::size_t i = marker.block + 1; i <= current_ && i < blocks_.size(); ++i) blocks_[i].used = 0;
+    blocks_[marker.block].used = marker.used;
+    current_ = marker.block;
+}
+
+void ZArena::reset() {
+    if (scopes_ != 0) throw ZException("ZArena::reset() called inside an open ZArena::Scope");
+    runFinalizers(nullptr);
+    current_ = 0;
+    if (blocks_.size() > 1) {
+        // Spilled: one block of the combined size serves the same load next time without chaining.
+        std::size_t total = 0;
+        for (const Block& block : blocks_) total += block.capacity;
+        releaseBlocks();
+        blocks_.push_back({ static_cast<unsigned char*>(::operator new(total)), total, 0 });
+    } else if (!blocks_.empty()) {
+        blocks_.front().used = 0;
+    }
+}
+
+std::size_t ZArena::bytesUsed() const {
+    std::size_t used = 0;
+    for (const Block& block : blocks_) used += block.used;
+    return used;
+}
+
+std::size_t ZArena::bytesReserved() const {
+    std::size_t reserved = 0;
+    for (const Block& block : blocks_) reserved += block.capacity;
+    return reserved;
+}
+
+void ZArena::runFinalizers(void* until) {
+    while (finalizers_ && finalizers_ != until) {
+        Finalizer* finalizer = finalizers_;
+        finalizers_ = finalizer->next;
+        finalizer->destroy(finalizer->object);
+    }
+}
+
+void ZArena::releaseBlocks() {
+    for (const Block& block : blocks_) ::operator delete(block.data);
+    blocks_.clear();
+    current_ = 0;
+}
+
+} // namespace ZincX
@@ -0,0 +1,168 @@
+/**
+ * @file ZArena.h
+ * @brief Defines the bump arena used for transient allocations in the ZincX framework.
+ *
+ * This file contains ZArena, a region allocator that hands out memory by advancing a pointer
+ * through large blocks and releases everything at once, and ZArenaAllocator, which lets standard
+ * containers draw from an arena. Freeing is a pointer reset: rewind() to a mark() drops what was
+ * allocated since, and reset() drops everything. A reset arena whose allocations spilled into
+ * extra blocks replaces them with one block of the combined size, so a workload that repeats
+ * every frame settles on a single block and stops calling malloc altogether.
+ *
+ * Each thread has a frame arena, ZArena::frame(), which ZGraphicsView::render() resets as a new
+ * frame begins. Code that only needs memory for the duration of a call, such as layout passes,
+ * brackets its allocations with a ZArena::Scope on it instead. Arenas are not synchronized; a
+ * thread only ever touches its own frame arena.
+ */
+#pragma once
+#include "ZConfig.h"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ZincX {
+
+class ZArena {
+public:
+    /**
+     * @brief Creates an empty arena; no memory is reserved until the first allocation.
+     * @param blockBytes Size of each block; larger requests get a block of their own size.
+     */
+    explicit ZArena(std::size_t blockBytes = ARENA_BLOCK_BYTES);
+
+    /** @brief Runs the destructors of objects made with create() and frees every block. */
+    ~ZArena();
+
+    ZArena(const ZArena&) = delete;
+    ZArena& operator=(const ZArena&) = delete;
+
+    /** @brief The calling thread's frame arena, reset by ZGraphicsView::render() every frame. */
+    static ZArena& frame();
+
+    /**
+     * @brief Returns uninitialized memory that stays valid until the arena is rewound past it.
+     * @param bytes Size of the allocation.
+     * @param alignment A power of two.
+     */
+    void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+    /** @brief Returns uninitialized storage for @p count objects of type T. */
+    template <typename T>
+    T* allocateArray(std::size_t count) {
+        return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    /**
+     * @brief Constructs an object in the arena.
+     *
+     * Unless T is trivially destructible, its destructor runs when the arena is rewound past it,
+     * reset or destroyed, in reverse order of creation.
+     */
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        if constexpr (std::is_trivially_destructible_v<T>) {
+            return ::new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        } else {
+            Finalizer* finalizer = static_cast<Finalizer*>(allocate(sizeof(Finalizer), alignof(Finalizer)));
+            T* object = ::new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+            *finalizer = { [](void* p) { static_cast<T*>(p)->~T(); }, object, finalizers_ };
+            finalizers_ = finalizer;
+            return object;
+        }
+    }
+
+    /** @brief A position in the arena to rewind() to. */
+    struct Marker {
+        std::size_t block;
+        std::size_t used;
+        void* finalizers;
+    };
+
+    Marker mark() const { return { current_, blocks_.empty() ? 0 : blocks_[current_].used, finalizers_ }; }
+
+    /** @brief Releases everything allocated after @p marker was taken, running pending destructors. */
+    void rewind(const Marker& marker);
+
+    /** @brief Marks the arena on construction and rewinds to the mark on destruction. */
+    class Scope {
+    public:
+        explicit Scope(ZArena& arena) : arena_(arena), marker_(arena.mark()) { ++arena_.scopes_; }
+        ~Scope() {
+            --arena_.scopes_;
+            arena_.rewind(marker_);
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ZArena& arena_;
+        Marker marker_;
+    };
+
+    /**
+     * @brief Releases every allocation and merges spilled blocks into one.
+     * @throws ZException if a Scope on this arena is still open.
+     */
+    void reset();
+
+    /** @brief Bytes handed out since the last reset, including alignment padding. */
+    std::size_t bytesUsed() const;
+
+    /** @brief Bytes held in blocks. */
+    std::size_t bytesReserved() const;
+
+private:
+    struct Finalizer {
+        void (*destroy)(void* object);
+        void* object;
+        Finalizer* next;
+    };
+
+    struct Block {
+        unsigned char* data;
+        std::size_t capacity;
+        std::size_t used;
+    };
+
+    void runFinalizers(void* until);
+    void releaseBlocks();
+
+    std::size_t blockBytes_;
+    std::vector<Block> blocks_;
+    std::size_t current_ = 0;        ///< Block allocations are currently served from.
+    Finalizer* finalizers_ = nullptr; ///< Most recently created first.
+    int scopes_ = 0;
+};
+
+/** @brief Standard allocator drawing from a ZArena; deallocation is a no-op. */
+template <typename T>
+class ZArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ZArenaAllocator(ZArena& arena) noexcept : arena_(&arena) {}
+
+    template <typename U>
+    ZArenaAllocator(const ZArenaAllocator<U>& other) noexcept : arena_(other.arena()) {}
+
+    T* allocate(std::size_t count) { return arena_->allocateArray<T>(count); }
+    void deallocate(T*, std::size_t) noexcept {}
+
+    ZArena* arena() const noexcept { return arena_; }
+
+    template <typename U>
+    bool operator==(const ZArenaAllocator<U>& other) const noexcept { return arena_ == other.arena(); }
+
+private:
+    ZArena* arena_;
+};
+
+/** @brief A vector whose storage lives in an arena; it must not outlive the arena's next rewind. */
+template <typename T>
+using ZArenaVector = std::vector<T, ZArenaAllocator<T>>;
+
+} // namespace ZincX
@@ -14,6 +14,8 @@
 
 #include <cmath>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <string>
 
@@ -27,6 +29,8 @@ namespace ZincX {
 struct ZPoint {
     int x; /**< The X-coordinate. */
     int y; /**< The Y-coordinate. */
+
+    constexpr bool operator==(const ZPoint&) const = default;
 };
 
 /**
@@ -35,26 +39,129 @@ struct ZPoint {
 struct ZSize {
     int width;  /**< The width of the object. */
     int height; /**< The height of the object. */
+
+    constexpr bool operator==(const ZSize&) const = default;
+};
+
+/**
+ * @brief A color packed into 32 bits as 0xAARRGGBB (8 bits per channel).
+ *
+ * In little-endian memory this is B, G, R, A byte order, the native layout of most linear
+ * framebuffers. The type is trivially copyable and constexpr so it can live in POD command
+ * buffers and pixel arrays and be processed with plain memory or SIMD loops.
+ */
+struct ZColor32 {
+    std::uint32_t value; /**< Packed 0xAARRGGBB value. */
+
+    ZColor32() = default;
+
+    /**
+     * @brief Constructs a color from a packed 0xAARRGGBB value.
+     * @param argb The packed value.
+     */
+    constexpr explicit ZColor32(std::uint32_t argb) : value(argb) {}
+
+    /**
+     * @brief Constructs a color from separate channels.
+     * @param red Red value.
+     * @param green Green value.
+     * @param blue Blue value.
+     * @param alpha Alpha value, default is 255.
+     */
+    constexpr ZColor32(std::uint8_t red, std::uint8_t green, std::uint8_t blue, std::uint8_t alpha = 255)
+        : value((static_cast<std::uint32_t>(alpha) << 24) | (static_cast<std::uint32_t>(red) << 16) |
+                (static_cast<std::uint32_t>(green) << 8) | blue) {}
+
+    constexpr std::uint8_t r() const { return static_cast<std::uint8_t>(value >> 16); }
+    constexpr std::uint8_t g() const { return static_cast<std::uint8_t>(value >> 8); }
+    constexpr std::uint8_t b() const { return static_cast<std::uint8_t>(value); }
+    constexpr std::uint8_t a() const { return static_cast<std::uint8_t>(value >> 24); }
+
+    constexpr bool operator==(const ZColor32& other) const { return value == other.value; }
+    constexpr bool operator!=(const ZColor32& other) const { return value != other.value; }
+};
+
+/**
+ * @brief A 16-bit color packed as RGB 5:6:5, for 16 bpp graphics modes.
+ */
+struct ZColor565 {
+    std::uint16_t value; /**< Packed rrrrrggggggbbbbb value. */
+
+    ZColor565() = default;
+
+    /**
+     * @brief Constructs a color from a packed 5:6:5 value.
+     * @param rgb The packed value.
+     */
+    constexpr explicit ZColor565(std::uint16_t rgb) : value(rgb) {}
+
+    /**
+     * @brief Converts an 8888 color, truncating each channel and dropping alpha.
+     * @param color The color to convert.
+     */
+    constexpr explicit ZColor565(ZColor32 color)
+        : value(static_cast<std::uint16_t>(((color.r() & 0xF8) << 8) | ((color.g() & 0xFC) << 3) | (color.b() >> 3))) {}
+
+    /**
+     * @brief Expands to an opaque 8888 color, replicating high bits into the low ones.
+     * @return The equivalent ZColor32.
+     */
+    constexpr ZColor32 to8888() const {
+        std::uint32_t r5 = (value >> 11) & 0x1F;
+        std::uint32_t g6 = (value >> 5) & 0x3F;
+        std::uint32_t b5 = value & 0x1F;
+        return ZColor32(static_cast<std::uint8_t>((r5 << 3) | (r5 >> 2)),
+                        static_cast<std::uint8_t>((g6 << 2) | (g6 >> 4)),
+                        static_cast<std::uint8_t>((b5 << 3) | (b5 >> 2)));
+    }
+
+    constexpr bool operator==(const ZColor565& other) const { return value == other.value; }
+    constexpr bool operator!=(const ZColor565& other) const { return value != other.value; }
 };
 
 /**
  * @brief Represents a color with red, green, blue, and alpha components.
+ *
+ * Channels are stored as bytes, so a ZColor is 4 bytes and trivially copyable. Use packed()
+ * where a single 32-bit value is more convenient (command buffers, framebuffers).
  */
 struct ZColor {
-    int r; /**< Red component (0-255). */
-    int g; /**< Green component (0-255). */
-    int b; /**< Blue component (0-255). */
-    int a; /**< Alpha component (0-255), defaults to 255 (opaque). */
+    std::uint8_t r; /**< Red component (0-255). */
+    std::uint8_t g; /**< Green component (0-255). */
+    std::uint8_t b; /**< Blue component (0-255). */
+    std::uint8_t a; /**< Alpha component (0-255), defaults to 255 (opaque). */
 
     /**
-     * @brief Constructs a ZColor.
+     * @brief Constructs opaque black.
+     */
+    constexpr ZColor() : r(0), g(0), b(0), a(255) {}
+
+    /**
+     * @brief Constructs a ZColor; values outside 0-255 are clamped to that range.
      * @param red Red value.
      * @param green Green value.
      * @param blue Blue value.
      * @param alpha Alpha value, default is 255.
      */
-    ZColor(int red, int green, int blue, int alpha = 255)
-        : r(red), g(green), b(blue), a(alpha) {}
+    constexpr ZColor(int red, int green, int blue, int alpha = 255)
+        : r(channel(red)), g(channel(green)), b(channel(blue)), a(channel(alpha)) {}
+
+    /**
+     * @brief Constructs a ZColor from a packed 8888 color.
+     * @param color The packed color.
+     */
+    constexpr ZColor(ZColor32 color) : r(color.r()), g(color.g()), b(color.b()), a(color.a()) {}
+
+    /**
+     * @brief Returns the color packed as 0xAARRGGBB.
+     * @return The packed color.
+     */
+    constexpr ZColor32 packed() const { return ZColor32(r, g, b, a); }
+
+private:
+    static constexpr std::uint8_t channel(int value) {
+        return static_cast<std::uint8_t>(value < 0 ? 0 : value > 255 ? 255 : value);
+    }
 };
 
 /**
@@ -67,6 +174,8 @@ struct ZPadding {
     int top;    /**< Padding on the top side. */
     int right;  /**< Padding on the right side. */
     int bottom; /**< Padding on the bottom side. */
+
+    constexpr bool operator==(const ZPadding&) const = default;
 };
 
 /**
@@ -79,6 +188,8 @@ struct ZMargin {
     int top;    /**< Margin on the top side. */
     int right;  /**< Margin on the right side. */
     int bottom; /**< Margin on the bottom side. */
+
+    constexpr bool operator==(const ZMargin&) const = default;
 };
 
 /**
@@ -89,7 +200,9 @@ struct ZRect {
     int y;      /**< Y-coordinate of the top-left corner. */
     int width;  /**< Width of the rectangle. */
     int height; /**< Height of the rectangle. */
-    
+
+    constexpr bool operator==(const ZRect&) const = default;
+
     /**
      * @brief Returns a new rectangle reduced by the specified padding.
      *
@@ -99,13 +212,161 @@ struct ZRect {
      * @param padding The padding to apply.
      * @return A new ZRect after applying the padding.
      */
-    ZRect deflate(const ZPadding& padding) const {
+    constexpr ZRect deflate(const ZPadding& padding) const {
         return { x + padding.left, y + padding.top,
                  width - padding.left - padding.right,
                  height - padding.top - padding.bottom };
     }
+
+    /**
+     * @brief Checks whether the rectangle covers no area.
+     * @return True if the width or height is zero or negative.
+     */
+    constexpr bool isEmpty() const {
+        return width <= 0 || height <= 0;
+    }
+
+    /**
+     * @brief Determines if a given point lies within the rectangle.
+     * @param point The point to test.
+     * @return True if the point is inside the rectangle; false otherwise.
+     */
+    constexpr bool contains(const ZPoint& point) const {
+        return point.x >= x && point.x < x + width &&
+               point.y >= y && point.y < y + height;
+    }
+
+    /**
+     * @brief Determines if another rectangle lies entirely within this one.
+     * @param other The rectangle to test.
+     * @return True if other is non-empty and fully covered by this rectangle.
+     */
+    constexpr bool contains(const ZRect& other) const {
+        return !other.isEmpty() &&
+               other.x >= x && other.x + other.width <= x + width &&
+               other.y >= y && other.y + other.height <= y + height;
+    }
+
+    /**
+     * @brief Determines if two rectangles overlap.
+     * @param other The rectangle to test against.
+     * @return True if the rectangles share at least one point.
+     */
+    constexpr bool intersects(const ZRect& other) const {
+        return !isEmpty() && !other.isEmpty() &&
+               other.x < x + width && x < other.x + other.width &&
+               other.y < y + height && y < other.y + other.height;
+    }
+
+    /**
+     * @brief Returns the overlapping area of two rectangles.
+     * @param other The rectangle to intersect with.
+     * @return The intersection, or an empty rectangle if they do not overlap.
+     */
+    constexpr ZRect intersected(const ZRect& other) const {
+        int left = x > other.x ? x : other.x;
+        int top = y > other.y ? y : other.y;
+        int right = (x + width) < (other.x + other.width) ? (x + width) : (other.x + other.width);
+        int bottom = (y + height) < (other.y + other.height) ? (y + height) : (other.y + other.height);
+        if (right <= left || bottom <= top) return { 0, 0, 0, 0 };
+        return { left, top, right - left, bottom - top };
+    }
+
+    /**
+     * @brief Returns the smallest rectangle containing both rectangles.
+     *
+     * An empty rectangle does not contribute to the result.
+     *
+     * @param other The rectangle to unite with.
+     * @return The bounding rectangle of both.
+     */
+    constexpr ZRect united(const ZRect& other) const {
+        if (isEmpty()) return other;
+        if (other.isEmpty()) return *this;
+        int left = x < other.x ? x : other.x;
+        int top = y < other.y ? y : other.y;
+        int right = (x + width) > (other.x + other.width) ? (x + width) : (other.x + other.width);
+        int bottom = (y + height) > (other.y + other.height) ? (y + height) : (other.y + other.height);
+        return { left, top, right - left, bottom - top };
+    }
+
+    /**
+     * @brief Returns the area covered by the rectangle.
+     * @return width * height, or 0 for an empty rectangle.
+     */
+    constexpr long long area() const {
+        return isEmpty() ? 0 : static_cast<long long>(width) * height;
+    }
+};
+
+/**
+ * @brief A non-owning view over a contiguous run of pixels.
+ *
+ * Fill, blend and blit kernels take spans so they can run over one framebuffer row (or a whole
+ * contiguous surface) without per-pixel bounds or stride arithmetic.
+ *
+ * @tparam Pixel The pixel type, e.g. ZColor32 or ZColor565.
+ */
+template<typename Pixel>
+struct ZPixelSpan {
+    Pixel* data;      /**< First pixel of the span. */
+    std::size_t size; /**< Number of pixels. */
+
+    constexpr Pixel& operator[](std::size_t i) const { return data[i]; }
+    constexpr Pixel* begin() const { return data; }
+    constexpr Pixel* end() const { return data + size; }
+    constexpr bool empty() const { return size == 0; }
+
+    /**
+     * @brief Returns part of the span.
+     * @param offset Index of the first pixel.
+     * @param count Number of pixels; must not run past the end.
+     * @return The sub-span.
+     */
+    constexpr ZPixelSpan subspan(std::size_t offset, std::size_t count) const { return { data + offset, count }; }
+};
+
+/**
+ * @brief A non-owning 2D view over pixel memory with an arbitrary row stride.
+ *
+ * @tparam Pixel The pixel type, e.g. ZColor32 or ZColor565.
+ */
+template<typename Pixel>
+struct ZSurface {
+    Pixel* pixels; /**< Top-left pixel. */
+    int width;     /**< Width in pixels. */
+    int height;    /**< Height in pixels. */
+    int stride;    /**< Distance between rows, in pixels. */
+
+    constexpr Pixel* pixel(int x, int y) const { return pixels + static_cast<std::ptrdiff_t>(y) * stride + x; }
+
+    /**
+     * @brief Returns one row of the surface as a span.
+     * @param y The row index.
+     * @return A span of width pixels.
+     */
+    constexpr ZPixelSpan<Pixel> row(int y) const { return { pixel(0, y), static_cast<std::size_t>(width) }; }
+
+    /** @brief True if rows are packed back to back and the surface can be treated as one span. */
+    constexpr bool isContiguous() const { return stride == width; }
+
+    constexpr ZRect rect() const { return { 0, 0, width, height }; }
+
+    /**
+     * @brief Returns the part of the surface covered by a rectangle, clipped to the surface.
+     * @param area The area in surface coordinates.
+     * @return A surface sharing this surface's memory.
+     */
+    constexpr ZSurface sub(const ZRect& area) const {
+        ZRect clipped = area.intersected(rect());
+        if (clipped.isEmpty()) return { pixels, 0, 0, stride };
+        return { pixel(clipped.x, clipped.y), clipped.width, clipped.height, stride };
+    }
 };
 
+using ZSurface32 = ZSurface<ZColor32>;  /**< 32 bpp 8888 surface. */
+using ZSurface16 = ZSurface<ZColor565>; /**< 16 bpp 5:6:5 surface. */
+
 /**
  * @brief Represents a circle defined by a center point and a radius.
  */
@@ -150,6 +411,10 @@ struct ZVector2D {
  * @brief Represents a 3x3 matrix for 2D affine transformations.
  *
  * This matrix is used to perform transformations such as translation, rotation, and scaling in 2D space.
+ * Points are treated as column vectors, so (a * b).map(p) applies b first, then a. The bottom row
+ * always stays (0, 0, 1); every operation is straight-line float arithmetic on the top two rows
+ * with no branches or table lookups, which compilers turn into packed SIMD code, and everything
+ * except rotation() is constexpr.
  */
 struct ZMatrix {
     float m[3][3]; /**< Matrix elements in row-major order. */
@@ -157,12 +422,99 @@ struct ZMatrix {
     /**
      * @brief Constructs an identity matrix.
      */
-    ZMatrix() {
-        m[0][0] = 1; m[0][1] = 0; m[0][2] = 0;
-        m[1][0] = 0; m[1][1] = 1; m[1][2] = 0;
-        m[2][0] = 0; m[2][1] = 0; m[2][2] = 1;
+    constexpr ZMatrix() : m{ { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } } {}
+
+    /**
+     * @brief Constructs an affine matrix from its top two rows.
+     *
+     * x' = m00 * x + m01 * y + dx and y' = m10 * x + m11 * y + dy.
+     */
+    constexpr ZMatrix(float m00, float m01, float dx, float m10, float m11, float dy)
+        : m{ { m00, m01, dx }, { m10, m11, dy }, { 0, 0, 1 } } {}
+
+    static constexpr ZMatrix translation(float dx, float dy) { return { 1, 0, dx, 0, 1, dy }; }
+    static constexpr ZMatrix scaling(float sx, float sy) { return { sx, 0, 0, 0, sy, 0 }; }
+
+    /** @brief Rotation about the origin; positive angles turn +x toward +y (clockwise on screen). */
+    static ZMatrix rotation(float radians) {
+        const float c = std::cos(radians);
+        const float s = std::sin(radians);
+        return { c, -s, 0, s, c, 0 };
+    }
+
+    constexpr ZMatrix operator*(const ZMatrix& o) const {
+        return { m[0][0] * o.m[0][0] + m[0][1] * o.m[1][0], m[0][0] * o.m[0][1] + m[0][1] * o.m[1][1],
+                 m[0][0] * o.m[0][2] + m[0][1] * o.m[1][2] + m[0][2],
+                 m[1][0] * o.m[0][0] + m[1][1] * o.m[1][0], m[1][0] * o.m[0][1] + m[1][1] * o.m[1][1],
+                 m[1][0] * o.m[0][2] + m[1][1] * o.m[1][2] + m[1][2] };
+    }
+
+    constexpr ZMatrix& operator*=(const ZMatrix& o) { return *this = *this * o; }
+
+    constexpr bool operator==(const ZMatrix& o) const {
+        return m[0][0] == o.m[0][0] && m[0][1] == o.m[0][1] && m[0][2] == o.m[0][2] &&
+               m[1][0] == o.m[1][0] && m[1][1] == o.m[1][1] && m[1][2] == o.m[1][2];
+    }
+
+    constexpr float dx() const { return m[0][2]; }
+    constexpr float dy() const { return m[1][2]; }
+
+    constexpr bool isIdentity() const { return *this == ZMatrix(); }
+
+    /** @brief True if the matrix only translates. */
+    constexpr bool isTranslation() const { return m[0][0] == 1 && m[0][1] == 0 && m[1][0] == 0 && m[1][1] == 1; }
+
+    /** @brief True if the matrix maps axis-aligned rectangles to axis-aligned rectangles (no rotation or shear). */
+    constexpr bool isAxisAligned() const { return m[0][1] == 0 && m[1][0] == 0; }
+
+    constexpr float mapX(float x, float y) const { return m[0][0] * x + m[0][1] * y + m[0][2]; }
+    constexpr float mapY(float x, float y) const { return m[1][0] * x + m[1][1] * y + m[1][2]; }
+
+    /** @brief Maps a point, rounding to the nearest pixel. */
+    constexpr ZPoint map(const ZPoint& p) const {
+        const float x = static_cast<float>(p.x);
+        const float y = static_cast<float>(p.y);
+        return { floorToInt(mapX(x, y) + 0.5f), floorToInt(mapY(x, y) + 0.5f) };
+    }
+
+    /** @brief Returns the smallest pixel rectangle containing the mapped corners of @p r. */
+    constexpr ZRect mapRect(const ZRect& r) const {
+        const float x0 = static_cast<float>(r.x);
+        const float y0 = static_cast<float>(r.y);
+        const float x1 = static_cast<float>(r.x + r.width);
+        const float y1 = static_cast<float>(r.y + r.height);
+        // Each output coordinate is linear in x and y, so its extremes pick one end per input axis.
+        const float left = min(m[0][0] * x0, m[0][0] * x1) + min(m[0][1] * y0, m[0][1] * y1) + m[0][2];
+        const float right = max(m[0][0] * x0, m[0][0] * x1) + max(m[0][1] * y0, m[0][1] * y1) + m[0][2];
+        const float top = min(m[1][0] * x0, m[1][0] * x1) + min(m[1][1] * y0, m[1][1] * y1) + m[1][2];
+        const float bottom = max(m[1][0] * x0, m[1][0] * x1) + max(m[1][1] * y0, m[1][1] * y1) + m[1][2];
+        // Coordinates within rounding noise of a pixel edge snap to it instead of growing the rect.
+        constexpr float slack = 1.0f / 1024;
+        const int l = floorToInt(left + slack);
+        const int t = floorToInt(top + slack);
+        return { l, t, -floorToInt(slack - right) - l, -floorToInt(slack - bottom) - t };
+    }
+
+    /**
+     * @brief Returns the inverse transformation.
+     * @param invertible If non-null, receives false when the matrix is singular; the identity is returned then.
+     */
+    constexpr ZMatrix inverted(bool* invertible = nullptr) const {
+        const float det = m[0][0] * m[1][1] - m[0][1] * m[1][0];
+        if (invertible) *invertible = det != 0;
+        if (det == 0) return {};
+        const float a = m[1][1] / det, b = -m[0][1] / det;
+        const float c = -m[1][0] / det, d = m[0][0] / det;
+        return { a, b, -(a * m[0][2] + b * m[1][2]), c, d, -(c * m[0][2] + d * m[1][2]) };
+    }
+
+private:
+    static constexpr float min(float a, float b) { return b < a ? b : a; }
+    static constexpr float max(float a, float b) { return a < b ? b : a; }
+    static constexpr int floorToInt(float v) {
+        const int i = static_cast<int>(v);
+        return static_cast<float>(i) > v ? i - 1 : i;
     }
-    // Additional transformation methods (translate, rotate, scale) can be added here.
 };
 
 /*==================== Utility Functions ====================*/
@@ -229,6 +581,15 @@ struct ZTime {
         std::chrono::duration<double> diff = clock::now() - start;
         return diff.count();
     }
+
+    /**
+     * @brief Returns a monotonic timestamp, as used for ZEvent::timestamp.
+     * @return Microseconds since the steady clock's epoch; only differences are meaningful.
+     */
+    static std::uint64_t now() {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(clock::now().time_since_epoch()).count());
+    }
 };
 
 /**
@@ -12,6 +12,7 @@
  * - Event and input classifications (e.g., EventType, InputDeviceType)
  * - Compute and layout configurations (e.g., ComputeBackend, LayoutOrientation)
  * - Resource management states (e.g., LoadState)
+ * - Model cell roles (e.g., ModelRole)
  * - Styling options (e.g., BorderStyle, FontWeight)
  * - Internationalization and accessibility roles (e.g., Language, AccessibilityRole)
  * - Networking protocols and states (e.g., Protocol, ConnectionState)
@@ -83,9 +84,25 @@ enum class WidgetType {
  * This enum is crucial for event handling and dispatching.
  */
 enum class EventType {
-    MouseClick, ///< A mouse click event.
-    KeyPress,   ///< A key press event.
-    TouchStart  ///< A touch start event.
+    MouseClick,   ///< A mouse click event.
+    MouseRelease, ///< A mouse button release event.
+    MouseMove,    ///< The pointer moved with no button held.
+    MouseDrag,    ///< The pointer moved with a button held.
+    KeyPress,     ///< A key press event.
+    TouchStart,   ///< A touch start event.
+    TouchMove,    ///< A touch contact moved.
+    Network       ///< A ZNet connection changed state or received data.
+};
+
+/**
+ * @brief Selects how queued events of one type are merged before dispatch.
+ *
+ * Merging only applies to consecutive events of the same type from the same device.
+ */
+enum class CoalescePolicy {
+    KeepAll,     ///< Dispatch every event.
+    Coalesce,    ///< Dispatch only the newest event of each run.
+    KeepLatestN  ///< Dispatch the newest N events of each run.
 };
 
 /**
@@ -109,7 +126,8 @@ enum class KeyModifier {
 enum class InputDeviceType {
     Mouse,     ///< Mouse device.
     Keyboard,  ///< Keyboard device.
-    Touchpad   ///< Touchpad device.
+    Touchpad,  ///< Touchpad device.
+    Network    ///< A ZNet connection.
 };
 
 /**
@@ -168,6 +186,19 @@ enum class LayoutAlignment {
     Stretch  ///< Stretch to fill the layout.
 };
 
+/**
+ * @brief Selects the edge a ZDock child is attached to.
+ *
+ * Children are docked in insertion order, each taking a slice of the space left by the previous ones.
+ */
+enum class DockArea {
+    Left,   ///< Docked to the left edge, full remaining height.
+    Top,    ///< Docked to the top edge, full remaining width.
+    Right,  ///< Docked to the right edge, full remaining height.
+    Bottom, ///< Docked to the bottom edge, full remaining width.
+    Fill    ///< Takes all remaining space.
+};
+
 // Resource Management
 /**
  * @brief Categorizes different types of resources managed by the framework.
@@ -191,6 +222,21 @@ enum class LoadState {
     Failed   ///< Resource loading failed.
 };
 
+// MVC
+/**
+ * @brief Identifies an aspect of a model cell, for change notifications.
+ *
+ * ZModel::dataChanged reports the roles that changed as a bit mask of these, so a view can skip
+ * changes to aspects it does not show.
+ */
+enum class ModelRole {
+    Display,    ///< The text views show.
+    Decoration, ///< Icons and images shown beside the text.
+    ToolTip,    ///< Text shown on hover.
+    Style,      ///< Per-cell colors and fonts.
+    User        ///< First role free for application use.
+};
+
 // Style
 /**
  * @brief Defines styles for widget borders.
@@ -203,6 +249,31 @@ enum class BorderStyle {
     Dotted  ///< Dotted border.
 };
 
+/**
+ * @brief Names the layers a styled widget is drawn in, bottom to top.
+ *
+ * Layers are drawn and cached independently, so content that changes often (a caret, a
+ * progress bar) can sit on top of a costly background that is rendered once.
+ */
+enum class StyleLayer {
+    Background, ///< Shadow, fill and border.
+    Midground,  ///< The widget's content, such as its label.
+    Foreground  ///< Overlays such as focus marks and carets.
+};
+
+/**
+ * @brief Specifies the timing curve of an animation.
+ *
+ * Every curve is a cubic polynomial of the linear progress, so all running animations are eased
+ * by the same arithmetic.
+ */
+enum class Easing {
+    Linear,   ///< Constant speed.
+    EaseIn,   ///< Starts slowly and accelerates (cubic).
+    EaseOut,  ///< Starts fast and decelerates (cubic).
+    EaseInOut ///< Slow at both ends (smoothstep).
+};
+
 /**
  * @brief Specifies font weight options for text styling.
  *
@@ -294,7 +365,9 @@ enum class LogLevel {
 enum class ProfilingCategory {
     Rendering, ///< Rendering related profiling.
     Compute,   ///< Compute related profiling.
-    Input      ///< Input related profiling.
+    Input,     ///< Input related profiling.
+    Layout,    ///< Layout measure and arrange passes.
+    Resource   ///< Resource loading and decoding.
 };
 
 // General
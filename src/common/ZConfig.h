@@ -4,10 +4,76 @@
  *
  * This file defines global configuration constants and settings used throughout the ZincX UI
  * framework to ensure consistent behavior across subsystems.
+ *
+ * ZINCX_THREAD_SAFE (set by the ZINCX_THREAD_SAFE CMake option) selects the synchronized
+ * implementations of shared structures such as the event queue. DOS builds have no threads
+ * and always get the single-threaded versions.
  */
  #pragma once
+ #include "ZCommonEnums.h"
+ #include <cstddef>
+
+ #if defined(__DJGPP__) && defined(ZINCX_THREAD_SAFE)
+ #undef ZINCX_THREAD_SAFE
+ #endif
 
  namespace ZincX {
      constexpr int DEFAULT_WIDTH = 800;  // Default window width
      constexpr int DEFAULT_HEIGHT = 600; // Default window height
- }
\ No newline at end of file
+
+ #if defined(__DJGPP__) || defined(__MSDOS__)
+     constexpr Platform CURRENT_PLATFORM = Platform::DOS;
+ #elif defined(_WINDOWS) && !defined(_WIN32)
+     constexpr Platform CURRENT_PLATFORM = Platform::Win16;
+ #elif defined(_WIN32)
+     constexpr Platform CURRENT_PLATFORM = Platform::Windows;
+ #elif defined(__APPLE__)
+     constexpr Platform CURRENT_PLATFORM = Platform::MacOS;
+ #elif defined(__linux__)
+     constexpr Platform CURRENT_PLATFORM = Platform::Linux;
+ #else
+     constexpr Platform CURRENT_PLATFORM = Platform::Embedded;
+ #endif
+
+ #ifdef __DJGPP__
+     constexpr std::size_t EVENT_QUEUE_CAPACITY = 256;  // Pending events before posting fails
+ #else
+     constexpr std::size_t EVENT_QUEUE_CAPACITY = 4096; // Pending events before posting fails
+ #endif
+
+ #ifdef __DJGPP__
+     constexpr std::size_t RESOURCE_CACHE_BYTES = 64 * 1024;         // ZResourceManager budget
+     constexpr std::size_t RESOURCE_CACHE_SHARDS = 1;                // Independently locked LRU shards
+     constexpr std::size_t ASSET_PACK_READ_CHUNK = 4 * 1024;         // Bytes per read from an unmapped pack
+     constexpr int GLYPH_ATLAS_SIZE = 128;                           // Glyph atlas width and height in pixels
+     constexpr std::size_t TEXT_RUN_CACHE_ENTRIES = 64;              // Shaped strings kept per backend
+     constexpr std::size_t PROFILE_RING_EVENTS = 1024;               // Scope timings buffered per thread
+     constexpr std::size_t PROFILE_FRAME_HISTORY = 16;               // Frames kept by ZProfiler
+     constexpr std::size_t LOG_RING_RECORDS = 32;                    // Log messages buffered per thread
+     constexpr std::size_t LOG_RECORD_BYTES = 128;                   // Longest log message kept, in bytes
+     constexpr std::size_t GPU_FRAMES_IN_FLIGHT = 2;                 // Frames a GPU backend records ahead of the display
+     constexpr std::size_t GPU_VERTEX_RING_INSTANCES = 1024;         // Initial quads per frame's vertex buffer
+     constexpr std::size_t ARENA_BLOCK_BYTES = 4 * 1024;             // ZArena block size, incl. frame arenas
+     constexpr std::size_t POOL_SLAB_OBJECTS = 16;                   // Objects per ZPool slab
+     constexpr std::size_t NET_RECV_BUFFER_BYTES = 4 * 1024;         // Size of one ZNet receive buffer
+     constexpr std::size_t NET_RECV_BUFFERS = 4;                     // ZNet receive buffers, i.e. data per poll
+     constexpr std::size_t NET_MAX_DATAGRAM_BYTES = 1472;            // Longer UDP datagrams are truncated
+ #else
+     constexpr std::size_t RESOURCE_CACHE_BYTES = 16 * 1024 * 1024;  // ZResourceManager budget
+     constexpr std::size_t RESOURCE_CACHE_SHARDS = 16;               // Independently locked LRU shards
+     constexpr std::size_t ASSET_PACK_READ_CHUNK = 256 * 1024;       // Bytes per read from an unmapped pack
+     constexpr int GLYPH_ATLAS_SIZE = 1024;                          // Glyph atlas width and height in pixels
+     constexpr std::size_t TEXT_RUN_CACHE_ENTRIES = 2048;            // Shaped strings kept per backend
+     constexpr std::size_t PROFILE_RING_EVENTS = 65536;              // Scope timings buffered per thread
+     constexpr std::size_t PROFILE_FRAME_HISTORY = 240;              // Frames kept by ZProfiler
+     constexpr std::size_t LOG_RING_RECORDS = 256;                   // Log messages buffered per thread
+     constexpr std::size_t LOG_RECORD_BYTES = 256;                   // Longest log message kept, in bytes
+     constexpr std::size_t GPU_FRAMES_IN_FLIGHT = 3;                 // Frames a GPU backend records ahead of the display
+     constexpr std::size_t GPU_VERTEX_RING_INSTANCES = 16 * 1024;    // Initial quads per frame's vertex buffer
+     constexpr std::size_t ARENA_BLOCK_BYTES = 64 * 1024;            // ZArena block size, incl. frame arenas
+     constexpr std::size_t POOL_SLAB_OBJECTS = 64;                   // Objects per ZPool slab
+     constexpr std::size_t NET_RECV_BUFFER_BYTES = 64 * 1024;        // Size of one ZNet receive buffer
+     constexpr std::size_t NET_RECV_BUFFERS = 32;                    // ZNet receive buffers, i.e. data per poll
+     constexpr std::size_t NET_MAX_DATAGRAM_BYTES = 8 * 1024;        // Longer UDP datagrams are truncated
+ #endif
+ }
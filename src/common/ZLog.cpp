@@ -2,14 +2,335 @@
  * @file ZLog.cpp
  * @brief Implementation of logging utilities for the ZincX framework.
  *
- * This file implements the logging functions declared in ZLog.h, providing console output for
- * the ZincX UI framework.
+ * This file implements ZLogger and the ZincX::log() functions declared in ZLog.h. Each ring has
+ * one producer, the thread leasing it, and one consumer, whichever drain holds drainMutex_, so a
+ * message costs the formatting plus an acquire load and a release store. Rings of exited threads
+ * are handed to the next new thread instead of being freed, which keeps drains free of lifetime
+ * races and bounds memory by the peak thread count. A lease shares ownership of its ring, so a
+ * thread that exits after the logger is destroyed still releases a live ring. The writer wakes on
+ * a timer, or early when a ring passes half full.
  */
  #include "ZLog.h"
- #include <iostream>
- 
+ #include "ZCommon.h"
+ #include <algorithm>
+ #include <charconv>
+ #include <chrono>
+ #include <cstdio>
+ #include <cstring>
+
+ namespace {
+     constexpr const char* kLevelNames[] = { "[Debug] ", "[Info] ", "[Warning] ", "[Error] ", "[Fatal] " };
+
+ #ifdef ZINCX_THREAD_SAFE
+     constexpr auto kWriterInterval = std::chrono::milliseconds(10);
+
+     // The calling thread's ring; dropping it at thread exit marks the ring free for reuse.
+     struct Lease {
+         std::shared_ptr<void> ring;
+         std::atomic<bool>* owned = nullptr;
+         std::uint32_t thread = 0;
+
+         ~Lease() {
+             if (owned) owned->store(false, std::memory_order_release);
+         }
+     };
+
+     thread_local Lease tlsLease;
+     thread_local bool tlsDraining = false; // set while this thread runs the sink
+ #else
+     bool tlsDraining = false;
+ #endif
+
+     struct DrainingScope {
+         DrainingScope() { tlsDraining = true; }
+         ~DrainingScope() { tlsDraining = false; }
+     };
+
+     // Appends to a fixed buffer, cutting off with "..." when it runs out.
+     class TextWriter {
+     public:
+         TextWriter(char* out, std::size_t capacity) : out_(out), capacity_(capacity) {}
+
+         void put(char c) {
+             if (size_ < capacity_) {
+                 out_[size_++] = c;
+             } else if (!truncated_) {
+                 truncated_ = true;
+                 for (std::size_t i = capacity_ >= 3 ? capacity_ - 3 : 0; i < capacity_; ++i) out_[i] = '.';
+             }
+         }
+
+         void put(std::string_view text) {
+             for (char c : text) put(c);
+         }
+
+         template <typename T>
+         void putNumber(T value, int base = 10) {
+             char digits[32];
+             auto result = std::to_chars(digits, digits + sizeof digits, value, base);
+             put(std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)));
+         }
+
+         void putArg(const ZincX::ZLogArg& arg) {
+             switch (arg.kind()) {
+             case ZincX::ZLogArg::Kind::Bool: put(arg.asUnsigned() ? "true" : "false"); break;
+             case ZincX::ZLogArg::Kind::Char: put(arg.asChar()); break;
+             case ZincX::ZLogArg::Kind::Signed: putNumber(arg.asSigned()); break;
+             case ZincX::ZLogArg::Kind::Unsigned: putNumber(arg.asUnsigned()); break;
+             case ZincX::ZLogArg::Kind::Floating: {
+                 char digits[32];
+                 auto result = std::to_chars(digits, digits + sizeof digits, arg.asFloating());
+                 put(std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)));
+                 break;
+             }
+             case ZincX::ZLogArg::Kind::String: put(arg.asString()); break;
+             case ZincX::ZLogArg::Kind::Pointer:
+                 put("0x");
+                 putNumber(reinterpret_cast<std::uintptr_t>(arg.asPointer()), 16);
+                 break;
+             }
+         }
+
+         std::size_t size() const { return size_; }
+
+     private:
+         char* out_;
+         std::size_t capacity_;
+         std::size_t size_ = 0;
+         bool truncated_ = false;
+     };
+
+     std::size_t formatMessage(char* out, std::size_t capacity, std::string_view format,
+                               std::initializer_list<ZincX::ZLogArg> args) {
+         TextWriter writer(out, capacity);
+         auto next = args.begin();
+         for (std::size_t i = 0; i < format.size(); ++i) {
+             const char c = format[i];
+             if (c == '{') {
+                 if (i + 1 < format.size() && format[i + 1] == '{') {
+                     writer.put('{');
+                     ++i;
+                     continue;
+                 }
+                 const std::size_t close = format.find('}', i);
+                 if (close == std::string_view::npos) {
+                     writer.put(format.substr(i));
+                     break;
+                 }
+                 // Placeholders without an argument are printed as written.
+                 if (next != args.end()) {
+                     writer.putArg(*next++);
+                 } else {
+                     writer.put(format.substr(i, close - i + 1));
+                 }
+                 i = close;
+             } else if (c == '}' && i + 1 < format.size() && format[i + 1] == '}') {
+                 writer.put('}');
+                 ++i;
+             } else {
+                 writer.put(c);
+             }
+         }
+         return writer.size();
+     }
+ }
+
  namespace ZincX {
+     ZLogger& ZLogger::instance() {
+         static ZLogger logger;
+         return logger;
+     }
+
+ #ifdef ZINCX_THREAD_SAFE
+     ZLogger::ZLogger() : writer_([this] { run(); }) {}
+
+     ZLogger::~ZLogger() {
+         {
+             std::lock_guard<std::mutex> lock(wakeMutex_);
+             stopping_ = true;
+         }
+         wake_.notify_one();
+         writer_.join();
+         drainAll();
+     }
+
+     void ZLogger::run() {
+         std::unique_lock<std::mutex> lock(wakeMutex_);
+         while (!stopping_) {
+             // Producers notify without the mutex, so a wake-up can be missed; the timeout bounds that.
+             wake_.wait_for(lock, kWriterInterval,
+                            [this] { return stopping_ || wakeRequested_.load(std::memory_order_relaxed); });
+             wakeRequested_.store(false, std::memory_order_relaxed);
+             lock.unlock();
+             drainAll();
+             lock.lock();
+         }
+     }
+
+     ZLogger::Ring& ZLogger::localRing(std::uint32_t& thread) {
+         if (!tlsLease.ring) {
+             std::lock_guard<std::mutex> lock(registryMutex_);
+             std::shared_ptr<Ring> ring;
+             for (const auto& candidate : rings_) {
+                 if (!candidate->owned.load(std::memory_order_acquire)) {
+                     ring = candidate;
+                     ring->owned.store(true, std::memory_order_relaxed);
+                     break;
+                 }
+             }
+             if (!ring) {
+                 ring = std::make_shared<Ring>();
+                 rings_.push_back(ring);
+             }
+             tlsLease.owned = &ring->owned;
+             tlsLease.ring = std::move(ring);
+             tlsLease.thread = ++threads_;
+         }
+         thread = tlsLease.thread;
+         return *static_cast<Ring*>(tlsLease.ring.get());
+     }
+
+     ZLogger::Slot* ZLogger::beginSlot(Ring*& ring) {
+         std::uint32_t thread = 0;
+         Ring& local = localRing(thread);
+         const std::size_t capacity = local.slots.size();
+         const std::size_t tail = local.tail.load(std::memory_order_relaxed);
+         const std::size_t used = tail - local.head.load(std::memory_order_acquire);
+         if (used >= capacity) return nullptr;
+         if (used + 1 >= capacity / 2 && !wakeRequested_.exchange(true, std::memory_order_relaxed)) wake_.notify_one();
+         ring = &local;
+         Slot& slot = local.slots[tail % capacity];
+         slot.thread = thread;
+         return &slot;
+     }
+ #else
+     ZLogger::ZLogger() = default;
+
+     ZLogger::~ZLogger() {
+         drainAll();
+     }
+
+     ZLogger::Slot* ZLogger::beginSlot(Ring*& ring) {
+         const std::size_t capacity = ring_.slots.size();
+         if (ring_.tail - ring_.head >= capacity && !tlsDraining) drainAll();
+         if (ring_.tail - ring_.head >= capacity) return nullptr;
+         ring = &ring_;
+         Slot& slot = ring_.slots[ring_.tail % capacity];
+         slot.thread = 1;
+         return &slot;
+     }
+ #endif
+
+     void ZLogger::setLevel(LogLevel level) {
+ #ifdef ZINCX_THREAD_SAFE
+         threshold_.store(static_cast<int>(level), std::memory_order_relaxed);
+ #else
+         threshold_ = static_cast<int>(level);
+ #endif
+     }
+
+     LogLevel ZLogger::level() {
+ #ifdef ZINCX_THREAD_SAFE
+         return static_cast<LogLevel>(threshold_.load(std::memory_order_relaxed));
+ #else
+         return static_cast<LogLevel>(threshold_);
+ #endif
+     }
+
+     void ZLogger::setSink(Sink sink) {
+         flush();
+ #ifdef ZINCX_THREAD_SAFE
+         std::lock_guard<std::mutex> lock(drainMutex_);
+ #endif
+         sink_ = std::move(sink);
+     }
+
+     void ZLogger::write(LogLevel level, std::string_view format, std::initializer_list<ZLogArg> args) {
+         Ring* ring = nullptr;
+         Slot* slot = beginSlot(ring);
+         if (!slot) {
+ #ifdef ZINCX_THREAD_SAFE
+             dropped_.fetch_add(1, std::memory_order_relaxed);
+ #else
+             ++dropped_;
+ #endif
+             return;
+         }
+         slot->timestamp = ZTime::now();
+         slot->level = level;
+         slot->length = static_cast<std::uint16_t>(formatMessage(slot->text, sizeof slot->text, format, args));
+ #ifdef ZINCX_THREAD_SAFE
+         ring->tail.store(ring->tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+ #else
+         ++ring->tail;
+ #endif
+         if (level == LogLevel::Fatal) flush();
+     }
+
+     void ZLogger::flush() {
+         // A sink that logs must not drain from inside itself.
+         if (!tlsDraining) drainAll();
+     }
+
+     void ZLogger::drainAll() {
+ #ifdef ZINCX_THREAD_SAFE
+         std::lock_guard<std::mutex> drain(drainMutex_);
+ #endif
+         copies_.clear();
+         auto take = [this](Ring& ring) {
+             const std::size_t capacity = ring.slots.size();
+ #ifdef ZINCX_THREAD_SAFE
+             const std::size_t head = ring.head.load(std::memory_order_relaxed);
+             const std::size_t tail = ring.tail.load(std::memory_order_acquire);
+ #else
+             const std::size_t head = ring.head;
+             const std::size_t tail = ring.tail;
+ #endif
+             for (std::size_t i = head; i != tail; ++i) copies_.push_back(ring.slots[i % capacity]);
+ #ifdef ZINCX_THREAD_SAFE
+             ring.head.store(tail, std::memory_order_release);
+ #else
+             ring.head = tail;
+ #endif
+         };
+ #ifdef ZINCX_THREAD_SAFE
+         {
+             std::lock_guard<std::mutex> lock(registryMutex_);
+             for (const auto& ring : rings_) take(*ring);
+         }
+ #else
+         take(ring_);
+ #endif
+         if (copies_.empty()) return;
+
+         order_.clear();
+         for (const Slot& slot : copies_) order_.push_back(&slot);
+         std::stable_sort(order_.begin(), order_.end(),
+                          [](const Slot* a, const Slot* b) { return a->timestamp < b->timestamp; });
+
+         DrainingScope draining;
+         for (const Slot* slot : order_) {
+             ZLogRecord record{ slot->timestamp, slot->level, slot->thread, std::string_view(slot->text, slot->length) };
+             if (sink_) {
+                 sink_(record);
+             } else {
+                 std::fputs(kLevelNames[static_cast<std::size_t>(record.level)], stdout);
+                 std::fwrite(record.message.data(), 1, record.message.size(), stdout);
+                 std::fputc('\n', stdout);
+             }
+         }
+         if (!sink_) std::fflush(stdout);
+     }
+
+     std::uint64_t ZLogger::droppedMessages() const {
+ #ifdef ZINCX_THREAD_SAFE
+         return dropped_.load(std::memory_order_relaxed);
+ #else
+         return dropped_;
+ #endif
+     }
+
      void log(const char* message) {
-         std::cout << message << "\n";
+         if (ZLogger::isEnabled(LogLevel::Info)) ZLogger::instance().write(LogLevel::Info, "{}", { ZLogArg(message) });
      }
- }
\ No newline at end of file
+ }
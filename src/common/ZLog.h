@@ -0,0 +1,244 @@
+/**
+ * @file ZLog.h
+ * @brief Logging utilities for the ZincX framework.
+ *
+ * This file declares ZLogger, the process-wide log, the ZINCX_LOG_* macros and the
+ * ZincX::log() functions. A log call never performs I/O and never takes a lock on the calling
+ * thread: the message is formatted straight into a slot of the thread's own ring and published
+ * with one atomic store. A background writer drains every ring, in timestamp order, to the sink
+ * (stdout by default) a few times per frame's worth of time, so enabling logging leaves frame
+ * timing alone. Single-threaded builds (DOS) have no writer; their ring is drained by flush(),
+ * which they call once per frame, or when it fills.
+ *
+ * Messages use std::format-style placeholders: "{}" is replaced by the next argument and "{{"
+ * and "}}" stand for literal braces; format specifications are accepted and ignored. The macros
+ * check the level before evaluating any argument, and levels below ZINCX_LOG_MIN_LEVEL (Info
+ * when NDEBUG is defined, Debug otherwise) are removed at compile time.
+ */
+ #pragma once
+ #include "ZCommonEnums.h"
+ #include "ZConfig.h"
+ #include <cstddef>
+ #include <cstdint>
+ #include <functional>
+ #include <initializer_list>
+ #include <memory>
+ #include <string_view>
+ #include <type_traits>
+ #include <vector>
+
+ #ifdef ZINCX_THREAD_SAFE
+ #include <atomic>
+ #include <condition_variable>
+ #include <mutex>
+ #include <thread>
+ #endif
+
+ #ifndef ZINCX_LOG_MIN_LEVEL
+ #ifdef NDEBUG
+ #define ZINCX_LOG_MIN_LEVEL 1 // LogLevel::Info
+ #else
+ #define ZINCX_LOG_MIN_LEVEL 0 // LogLevel::Debug
+ #endif
+ #endif
+
+ namespace ZincX {
+     /** @brief A message as handed to a ZLogger::Sink. */
+     struct ZLogRecord {
+         std::uint64_t timestamp;  ///< ZTime::now() when the message was logged, in microseconds.
+         LogLevel level;
+         std::uint32_t thread;     ///< Logger thread number, in order of first use, from 1.
+         std::string_view message; ///< Formatted text; valid only during the sink call.
+     };
+
+     /** @brief One log argument with its type erased; built implicitly by ZincX::log(). */
+     class ZLogArg {
+     public:
+         enum class Kind : std::uint8_t { Bool, Char, Signed, Unsigned, Floating, String, Pointer };
+
+         template <typename T>
+         ZLogArg(const T& value) {
+             if constexpr (std::is_same_v<T, bool>) {
+                 kind_ = Kind::Bool;
+                 unsigned_ = value;
+             } else if constexpr (std::is_same_v<T, char>) {
+                 kind_ = Kind::Char;
+                 char_ = value;
+             } else if constexpr (std::is_enum_v<T>) {
+                 *this = ZLogArg(static_cast<std::underlying_type_t<T>>(value));
+             } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+                 kind_ = Kind::Signed;
+                 signed_ = value;
+             } else if constexpr (std::is_integral_v<T>) {
+                 kind_ = Kind::Unsigned;
+                 unsigned_ = value;
+             } else if constexpr (std::is_floating_point_v<T>) {
+                 kind_ = Kind::Floating;
+                 floating_ = static_cast<double>(value);
+             } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+                 kind_ = Kind::String;
+                 if constexpr (std::is_pointer_v<T>) {
+                     string_ = value ? std::string_view(value) : std::string_view("(null)");
+                 } else {
+                     string_ = value;
+                 }
+             } else if constexpr (std::is_pointer_v<T> || std::is_null_pointer_v<T>) {
+                 kind_ = Kind::Pointer;
+                 pointer_ = static_cast<const void*>(value);
+             } else {
+                 static_assert(std::is_pointer_v<T>, "ZincX::log: unsupported argument type");
+             }
+         }
+
+         Kind kind() const { return kind_; }
+         char asChar() const { return char_; }
+         long long asSigned() const { return signed_; }
+         unsigned long long asUnsigned() const { return unsigned_; }
+         double asFloating() const { return floating_; }
+         std::string_view asString() const { return string_; }
+         const void* asPointer() const { return pointer_; }
+
+     private:
+         Kind kind_ = Kind::Unsigned;
+         union {
+             char char_;
+             long long signed_;
+             unsigned long long unsigned_ = 0;
+             double floating_;
+             std::string_view string_;
+             const void* pointer_;
+         };
+     };
+
+     class ZLogger {
+     public:
+         /** @brief Receives drained messages on the writer thread, one call per message, in order. */
+         using Sink = std::function<void(const ZLogRecord& record)>;
+
+         /** @brief The process-wide log; created, and its writer started, on first use. */
+         static ZLogger& instance();
+
+         ~ZLogger();
+
+         ZLogger(const ZLogger&) = delete;
+         ZLogger& operator=(const ZLogger&) = delete;
+
+         /** @brief True if messages at a level pass the runtime threshold; one relaxed load. */
+         static bool isEnabled(LogLevel level) {
+ #ifdef ZINCX_THREAD_SAFE
+             return static_cast<int>(level) >= threshold_.load(std::memory_order_relaxed);
+ #else
+             return static_cast<int>(level) >= threshold_;
+ #endif
+         }
+
+         /** @brief Sets the runtime threshold; messages below it are discarded before formatting. */
+         static void setLevel(LogLevel level);
+         static LogLevel level();
+
+         /** @brief Replaces the sink; an empty sink restores stdout. Pending messages are flushed first. */
+         void setSink(Sink sink);
+
+         /**
+          * @brief Formats a message into the calling thread's ring.
+          *
+          * Text beyond ZincX::LOG_RECORD_BYTES is cut and ends in "...". If the ring is full the
+          * message is dropped and counted, so a stalled sink never blocks the caller; Fatal
+          * messages are flushed before returning.
+          */
+         void write(LogLevel level, std::string_view format, std::initializer_list<ZLogArg> args);
+
+         /** @brief Hands every message published so far to the sink before returning. */
+         void flush();
+
+         /** @brief Messages lost to full rings. */
+         std::uint64_t droppedMessages() const;
+
+     private:
+         struct Slot {
+             std::uint64_t timestamp;
+             LogLevel level;
+             std::uint32_t thread;
+             std::uint16_t length;
+             char text[LOG_RECORD_BYTES];
+         };
+
+         /** @brief Ring written by one thread at a time and drained under drainMutex_. */
+         struct Ring {
+             Ring() : slots(LOG_RING_RECORDS) {}
+
+             std::vector<Slot> slots;
+ #ifdef ZINCX_THREAD_SAFE
+             std::atomic<std::size_t> head{ 0 };    ///< Next slot to drain.
+             std::atomic<std::size_t> tail{ 0 };    ///< Next slot to fill.
+             std::atomic<bool> owned{ true };       ///< False once its thread has exited; reused by the next new thread.
+ #else
+             std::size_t head = 0;
+             std::size_t tail = 0;
+ #endif
+         };
+
+         ZLogger();
+
+         /** @brief Reserves the calling thread's next slot and numbers it. @return Null if the ring is full. */
+         Slot* beginSlot(Ring*& ring);
+
+         /** @brief Copies every published slot out of the rings and hands them to the sink. */
+         void drainAll();
+
+ #ifdef ZINCX_THREAD_SAFE
+         Ring& localRing(std::uint32_t& thread);
+         void run();
+
+         static inline std::atomic<int> threshold_{ ZINCX_LOG_MIN_LEVEL };
+
+         std::vector<std::shared_ptr<Ring>> rings_; ///< Shared with the leasing threads, which may outlive the logger.
+         std::uint32_t threads_ = 0;
+         std::mutex registryMutex_;           ///< Guards rings_ and threads_.
+         std::mutex drainMutex_;              ///< Serializes drains; guards sink_, copies_ and order_.
+         std::mutex wakeMutex_;
+         std::condition_variable wake_;
+         std::atomic<bool> wakeRequested_{ false };
+         bool stopping_ = false;              ///< Guarded by wakeMutex_.
+         std::atomic<std::uint64_t> dropped_{ 0 };
+ #else
+         static inline int threshold_ = ZINCX_LOG_MIN_LEVEL;
+
+         Ring ring_;
+         std::uint64_t dropped_ = 0;
+ #endif
+         Sink sink_;
+         std::vector<Slot> copies_;           ///< Drained slots, copied out so rings can refill meanwhile.
+         std::vector<const Slot*> order_;     ///< copies_ sorted by timestamp.
+ #ifdef ZINCX_THREAD_SAFE
+         std::thread writer_;                 ///< Declared last: started once everything else exists.
+ #endif
+     };
+
+     /** @brief Logs a message verbatim at LogLevel::Info; a null message logs "(null)". */
+     void log(const char* message);
+
+     /** @brief Formats and logs a message if @p level passes the runtime threshold. */
+     template <typename... Args>
+     void log(LogLevel level, std::string_view format, const Args&... args) {
+         if (ZLogger::isEnabled(level)) ZLogger::instance().write(level, format, { ZLogArg(args)... });
+     }
+ }
+
+ /**
+  * @brief Logs at a LogLevel enumerator; the arguments are evaluated only if the level is enabled,
+  * and the whole statement is discarded below ZINCX_LOG_MIN_LEVEL.
+  */
+ #define ZINCX_LOG(level, ...)                                                                   \
+     do {                                                                                        \
+         if constexpr (static_cast<int>(ZincX::LogLevel::level) >= ZINCX_LOG_MIN_LEVEL) {        \
+             if (ZincX::ZLogger::isEnabled(ZincX::LogLevel::level))                              \
+                 ZincX::log(ZincX::LogLevel::level, __VA_ARGS__);                                \
+         }                                                                                       \
+     } while (false)
+
+ #define ZINCX_LOG_DEBUG(...) ZINCX_LOG(Debug, __VA_ARGS__)
+ #define ZINCX_LOG_INFO(...) ZINCX_LOG(Info, __VA_ARGS__)
+ #define ZINCX_LOG_WARNING(...) ZINCX_LOG(Warning, __VA_ARGS__)
+ #define ZINCX_LOG_ERROR(...) ZINCX_LOG(Error, __VA_ARGS__)
+ #define ZINCX_LOG_FATAL(...) ZINCX_LOG(Fatal, __VA_ARGS__)
@@ -0,0 +1,231 @@
+/**
+ * @file ZPool.h
+ * @brief Defines the type-segregated object pools used by the ZincX framework.
+ *
+ * This file contains ZPool, a fixed-size-slot allocator for one type, and ZPoolSet, a collection
+ * of pools keyed by type. A pool carves objects out of slabs of POOL_SLAB_OBJECTS slots, so
+ * objects of a type created together sit next to each other in memory, and freed slots are
+ * chained into a free list that the next create() pops. Because every slot of a slab has the
+ * same size, freeing and reallocating never fragments the heap; the slabs themselves are only
+ * returned by clear(), which destroys all live objects of the pool in one pass.
+ *
+ * Pools are not synchronized; like the scene graph they belong to, they are used from one thread.
+ */
+#pragma once
+#include "ZCommon.h"
+#include "ZConfig.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#ifdef ZINCX_THREAD_SAFE
+#include <atomic>
+#endif
+
+namespace ZincX {
+
+/** @brief Type-erased view of a ZPool, as held by a ZPoolSet. */
+class ZPoolBase {
+public:
+    virtual ~ZPoolBase() = default;
+
+    /**
+     * @brief Destroys one object of the pool.
+     * @param object The object's address as its most-derived type, e.g. from dynamic_cast<void*>.
+     */
+    virtual void destroyObject(void* object) = 0;
+
+    /** @brief Destroys every live object and returns the slabs to the heap. */
+    virtual void clear() = 0;
+
+    /** @brief Number of live objects. */
+    virtual std::size_t size() const = 0;
+};
+
+template <typename T>
+class ZPool final : public ZPoolBase {
+public:
+    ZPool() = default;
+    ~ZPool() override { clear(); }
+
+    ZPool(const ZPool&) = delete;
+    ZPool& operator=(const ZPool&) = delete;
+
+    /** @brief Constructs an object in a free slot, adding a slab if there is none. */
+    template <typename... Args>
+    T* create(Args&&... args) {
+        if (!free_) addSlab();
+        Slot* slot = free_;
+        free_ = slot->next;
+        T* object;
+        try {
+            object = ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            slot->next = free_;
+            free_ = slot;
+            throw;
+        }
+        Located at = locate(object);
+        at.slab->live[at.index / 64] |= std::uint64_t(1) << (at.index % 64);
+        ++size_;
+        return object;
+    }
+
+    /** @brief Destroys an object created by this pool and recycles its slot. */
+    void destroy(T* object) {
+        Located at = locate(object);
+        const std::uint64_t bit = std::uint64_t(1) << (at.index % 64);
+        if (!at.slab || !(at.slab->live[at.index / 64] & bit)) {
+            throw ZException("ZPool::destroy: object is not live in this pool");
+        }
+        at.slab->live[at.index / 64] &= ~bit;
+        object->~T();
+        Slot* slot = &at.slab->slots[at.index];
+        slot->next = free_;
+        free_ = slot;
+        --size_;
+    }
+
+    void destroyObject(void* object) override { destroy(static_cast<T*>(object)); }
+
+    void clear() override {
+        // Destroying an object may destroy others in this pool; take each live bit before running it.
+        for (std::size_t s = 0; s < slabs_.size(); ++s) {
+            for (std::size_t i = 0; i < POOL_SLAB_OBJECTS; ++i) {
+                Slab& slab = *slabs_[s];
+                const std::uint64_t bit = std::uint64_t(1) << (i % 64);
+                if (!(slab.live[i / 64] & bit)) continue;
+                slab.live[i / 64] &= ~bit;
+                --size_;
+                std::launder(reinterpret_cast<T*>(slab.slots[i].storage))->~T();
+            }
+        }
+        slabs_.clear();
+        free_ = nullptr;
+    }
+
+    std::size_t size() const override { return size_; }
+
+    /** @brief Number of slots in all slabs. */
+    std::size_t capacity() const { return slabs_.size() * POOL_SLAB_OBJECTS; }
+
+    /** @brief True if @p object is a live object of this pool. */
+    bool owns(const T* object) const {
+        Located at = locate(object);
+        return at.slab && (at.slab->live[at.index / 64] & (std::uint64_t(1) << (at.index % 64)));
+    }
+
+private:
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    struct Slab {
+        Slot slots[POOL_SLAB_OBJECTS];
+        std::uint64_t live[(POOL_SLAB_OBJECTS + 63) / 64] = {};
+    };
+
+    struct Located {
+        Slab* slab;
+        std::size_t index;
+    };
+
+    void addSlab() {
+        auto slab = std::make_unique<Slab>();
+        for (std::size_t i = POOL_SLAB_OBJECTS; i-- > 0;) {
+            slab->slots[i].next = free_;
+            free_ = &slab->slots[i];
+        }
+        // Sorted by address so locate() can binary search.
+        auto at = std::upper_bound(slabs_.begin(), slabs_.end(), slab.get(),
+                                   [](const Slab* a, const std::unique_ptr<Slab>& b) { return std::less<const Slab*>()(a, b.get()); });
+        slabs_.insert(at, std::move(slab));
+    }
+
+    Located locate(const T* object) const {
+        const auto* address = reinterpret_cast<const unsigned char*>(object);
+        auto after = std::upper_bound(slabs_.begin(), slabs_.end(), address,
+                                      [](const unsigned char* a, const std::unique_ptr<Slab>& b) {
+                                          return std::less<const unsigned char*>()(a, reinterpret_cast<const unsigned char*>(b.get()));
+                                      });
+        if (after == slabs_.begin()) return { nullptr, 0 };
+        Slab* slab = std::prev(after)->get();
+        const auto* first = reinterpret_cast<const unsigned char*>(slab->slots);
+        const std::size_t offset = static_cast<std::size_t>(address - first);
+        if (std::greater_equal<const unsigned char*>()(address, first + sizeof(slab->slots)) || offset % sizeof(Slot) != 0) {
+            return { nullptr, 0 };
+        }
+        return { slab, offset / sizeof(Slot) };
+    }
+
+    std::vector<std::unique_ptr<Slab>> slabs_;
+    Slot* free_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+/** @brief One ZPool per type, created on first use and cleared together. */
+class ZPoolSet {
+public:
+    ZPoolSet() = default;
+    ~ZPoolSet() { clear(); }
+
+    ZPoolSet(const ZPoolSet&) = delete;
+    ZPoolSet& operator=(const ZPoolSet&) = delete;
+
+    /** @brief Returns the pool for T, creating it on first use. */
+    template <typename T>
+    ZPool<T>& get() {
+        const std::size_t id = typeId<T>();
+        if (id >= byType_.size()) byType_.resize(id + 1);
+        if (!byType_[id]) {
+            byType_[id] = std::make_unique<ZPool<T>>();
+            order_.push_back(byType_[id].get());
+        }
+        return static_cast<ZPool<T>&>(*byType_[id]);
+    }
+
+    /** @brief True if @p pool is one of this set's pools. */
+    bool contains(const ZPoolBase* pool) const {
+        return pool && std::find(order_.begin(), order_.end(), pool) != order_.end();
+    }
+
+    /** @brief Destroys the objects of every pool, newest pool first; the pools stay usable. */
+    void clear() {
+        for (auto it = order_.rbegin(); it != order_.rend(); ++it) (*it)->clear();
+    }
+
+    /** @brief Live objects across all pools. */
+    std::size_t size() const {
+        std::size_t total = 0;
+        for (const ZPoolBase* pool : order_) total += pool->size();
+        return total;
+    }
+
+private:
+    static std::size_t nextTypeId() {
+#ifdef ZINCX_THREAD_SAFE
+        static std::atomic<std::size_t> next{ 0 };
+        return next.fetch_add(1, std::memory_order_relaxed);
+#else
+        static std::size_t next = 0;
+        return next++;
+#endif
+    }
+
+    template <typename T>
+    static std::size_t typeId() {
+        static const std::size_t id = nextTypeId();
+        return id;
+    }
+
+    std::vector<std::unique_ptr<ZPoolBase>> byType_; ///< Indexed by typeId(); sparse.
+    std::vector<ZPoolBase*> order_;                  ///< Pools in order of first use.
+};
+
+} // namespace ZincX
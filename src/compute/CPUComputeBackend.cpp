@@ -0,0 +1,154 @@
+/**
+ * @file CPUComputeBackend.cpp
+ * @brief Implementation of the CPU compute backend for the ZincX framework.
+ *
+ * Every queue is a mutex-guarded deque, but each worker mostly touches only its own, so the locks
+ * are uncontended except while stealing. queued_ counts tasks across all queues; workers sleep on
+ * wake_ only when it is zero, and submitters notify after taking sleepMutex_ so a wake-up cannot
+ * slip between a worker's last scan and its wait.
+ */
+#include "CPUComputeBackend.h"
+#include "../common/ZConfig.h"
+
+#ifdef ZINCX_THREAD_SAFE
+namespace {
+    // Identifies the pool and worker slot the current thread belongs to, if any.
+    thread_local const CPUComputeBackend* tlsPool = nullptr;
+    thread_local std::size_t tlsWorker = 0;
+}
+#endif
+
+std::size_t CPUComputeBackend::defaultWorkerCount() {
+    if (ZincX::CURRENT_PLATFORM == ZincX::Platform::DOS || ZincX::CURRENT_PLATFORM == ZincX::Platform::Win16) return 0;
+#ifdef ZINCX_THREAD_SAFE
+    unsigned hardware = std::thread::hardware_concurrency();
+    return hardware > 1 ? hardware - 1 : 1;
+#else
+    return 0;
+#endif
+}
+
+#ifdef ZINCX_THREAD_SAFE
+
+CPUComputeBackend::CPUComputeBackend(std::size_t workers) {
+    local_.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i) local_.push_back(std::make_unique<TaskQueues>());
+    threads_.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i) threads_.emplace_back([this, i] { workerLoop(i); });
+}
+
+CPUComputeBackend::~CPUComputeBackend() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& t : threads_) t.join();
+    // Anything submitted after the workers drained (or with no workers) still runs.
+    while (runPendingTask()) {}
+}
+
+std::size_t CPUComputeBackend::concurrency() const {
+    return threads_.size();
+}
+
+void CPUComputeBackend::submit(Task task, ZincX::TaskPriority priority) {
+    if (threads_.empty()) {
+        task();
+        return;
+    }
+    auto p = static_cast<std::size_t>(priority);
+    TaskQueues& queues = tlsPool == this ? *local_[tlsWorker] : shared_;
+    {
+        std::lock_guard<std::mutex> lock(queues.mutex);
+        queues.tasks[p].push_back(std::move(task));
+    }
+    queued_.fetch_add(1, std::memory_order_release);
+    { std::lock_guard<std::mutex> lock(sleepMutex_); }
+    wake_.notify_one();
+}
+
+bool CPUComputeBackend::popOwn(std::size_t self, std::size_t priority, Task& out) {
+    TaskQueues& queues = *local_[self];
+    std::lock_guard<std::mutex> lock(queues.mutex);
+    auto& tasks = queues.tasks[priority];
+    if (tasks.empty()) return false;
+    out = std::move(tasks.back());
+    tasks.pop_back();
+    return true;
+}
+
+bool CPUComputeBackend::popShared(std::size_t priority, Task& out) {
+    std::lock_guard<std::mutex> lock(shared_.mutex);
+    auto& tasks = shared_.tasks[priority];
+    if (tasks.empty()) return false;
+    out = std::move(tasks.front());
+    tasks.pop_front();
+    return true;
+}
+
+bool CPUComputeBackend::steal(std::size_t self, std::size_t priority, Task& out) {
+    const std::size_t count = local_.size();
+    for (std::size_t k = 1; k <= count; ++k) {
+        std::size_t victim = (self + k) % count;
+        if (victim == self && tlsPool == this) continue;
+        TaskQueues& queues = *local_[victim];
+        std::lock_guard<std::mutex> lock(queues.mutex);
+        auto& tasks = queues.tasks[priority];
+        if (tasks.empty()) continue;
+        out = std::move(tasks.front());
+        tasks.pop_front();
+        return true;
+    }
+    return false;
+}
+
+bool CPUComputeBackend::tryRun(std::size_t self) {
+    if (queued_.load(std::memory_order_acquire) == 0) return false;
+    const bool worker = tlsPool == this;
+    Task task;
+    for (std::size_t p = kPriorityCount; p-- > 0;) {
+        if ((worker && popOwn(self, p, task)) || popShared(p, task) || steal(self, p, task)) {
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            task();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CPUComputeBackend::runPendingTask() {
+    return tryRun(tlsPool == this ? tlsWorker : 0);
+}
+
+void CPUComputeBackend::workerLoop(std::size_t index) {
+    tlsPool = this;
+    tlsWorker = index;
+    for (;;) {
+        if (tryRun(index)) continue;
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        wake_.wait(lock, [this] { return stopping_ || queued_.load(std::memory_order_acquire) != 0; });
+        if (stopping_ && queued_.load(std::memory_order_acquire) == 0) break;
+    }
+    tlsPool = nullptr;
+}
+
+#else // !ZINCX_THREAD_SAFE: single-threaded targets run everything inline.
+
+CPUComputeBackend::CPUComputeBackend(std::size_t) {}
+
+CPUComputeBackend::~CPUComputeBackend() = default;
+
+std::size_t CPUComputeBackend::concurrency() const {
+    return 0;
+}
+
+void CPUComputeBackend::submit(Task task, ZincX::TaskPriority) {
+    task();
+}
+
+bool CPUComputeBackend::runPendingTask() {
+    return false;
+}
+
+#endif
@@ -0,0 +1,73 @@
+/**
+ * @file CPUComputeBackend.h
+ * @brief Defines the CPU compute backend for the ZincX framework.
+ *
+ * This file contains CPUComputeBackend, a work-stealing thread pool. Each worker owns one deque
+ * per TaskPriority: it pushes and pops its own work at the back (LIFO, cache-warm) and idle
+ * workers steal from the front of other workers' deques. Tasks submitted from outside the pool
+ * go to shared per-priority injection queues. High-priority work anywhere is taken before
+ * lower-priority work, so layout requested by the UI thread is not stuck behind image decodes.
+ *
+ * Built without ZINCX_THREAD_SAFE (DOS, Win16), or constructed with zero workers, the backend
+ * runs every task inline in submit().
+ */
+#pragma once
+#include "IZComputeBackend.h"
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#ifdef ZINCX_THREAD_SAFE
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+class CPUComputeBackend : public IZComputeBackend {
+public:
+    /**
+     * @brief Starts the worker threads.
+     * @param workers Number of worker threads; 0 executes tasks inline on the submitting thread.
+     */
+    explicit CPUComputeBackend(std::size_t workers);
+
+    /** @brief Runs the tasks still queued, then joins the workers. */
+    ~CPUComputeBackend() override;
+
+    CPUComputeBackend(const CPUComputeBackend&) = delete;
+    CPUComputeBackend& operator=(const CPUComputeBackend&) = delete;
+
+    ZincX::ComputeBackend type() const override { return ZincX::ComputeBackend::CPU; }
+    std::size_t concurrency() const override;
+    void submit(Task task, ZincX::TaskPriority priority) override;
+    bool runPendingTask() override;
+
+    /** @brief Default worker count for this platform: hardware threads minus the UI thread, 0 on DOS/Win16. */
+    static std::size_t defaultWorkerCount();
+
+private:
+    static constexpr std::size_t kPriorityCount = 3;
+
+#ifdef ZINCX_THREAD_SAFE
+    struct TaskQueues {
+        std::mutex mutex;
+        std::deque<Task> tasks[kPriorityCount]; ///< Indexed by TaskPriority.
+    };
+
+    void workerLoop(std::size_t index);
+    bool tryRun(std::size_t self);
+    bool popOwn(std::size_t self, std::size_t priority, Task& out);
+    bool popShared(std::size_t priority, Task& out);
+    bool steal(std::size_t self, std::size_t priority, Task& out);
+
+    std::vector<std::unique_ptr<TaskQueues>> local_; ///< One per worker.
+    TaskQueues shared_;                              ///< Submissions from non-worker threads.
+    std::vector<std::thread> threads_;
+    std::atomic<std::size_t> queued_{0};             ///< Tasks in any queue, for sleep decisions.
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;                          ///< Guarded by sleepMutex_.
+#endif
+};
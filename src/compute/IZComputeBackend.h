@@ -0,0 +1,47 @@
+/**
+ * @file IZComputeBackend.h
+ * @brief Defines the interface implemented by ZincX compute backends.
+ *
+ * This file contains IZComputeBackend, the minimal contract ZCompute builds its task, future and
+ * parallel_for API on: accept a task at a priority and, for callers that would otherwise block,
+ * run one pending task on the calling thread. The CPU backend implements it with a work-stealing
+ * pool; a GPU backend would implement it for the host-side part of its work.
+ */
+#pragma once
+#include "../common/ZCommonEnums.h"
+#include <cstddef>
+#include <functional>
+
+class IZComputeBackend {
+public:
+    /** @brief A unit of work; may own move-only state. */
+    using Task = std::move_only_function<void()>;
+
+    virtual ~IZComputeBackend() = default;
+
+    /** @brief Identifies the backend. */
+    virtual ZincX::ComputeBackend type() const = 0;
+
+    /** @brief Number of threads that execute tasks, 0 if tasks run inline in submit(). */
+    virtual std::size_t concurrency() const = 0;
+
+    /**
+     * @brief Schedules a task. Higher priorities are always picked before lower ones.
+     *
+     * Tasks must not throw; ZCompute wraps user work so exceptions reach the matching future.
+     *
+     * @param task The work to run.
+     * @param priority Scheduling priority.
+     */
+    virtual void submit(Task task, ZincX::TaskPriority priority) = 0;
+
+    /**
+     * @brief Runs one queued task on the calling thread, if any is available.
+     *
+     * Waiting code calls this in a loop so a thread blocked on a result keeps the pool busy
+     * instead of idling, and so nested waits inside tasks cannot starve the pool.
+     *
+     * @return True if a task was run.
+     */
+    virtual bool runPendingTask() = 0;
+};
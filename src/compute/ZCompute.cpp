@@ -0,0 +1,76 @@
+/**
+ * @file ZCompute.cpp
+ * @brief Implementation of the ZCompute class for the ZincX compute subsystem.
+ *
+ * parallelFor() hands out chunks through an atomic counter rather than pre-assigning them, so
+ * uneven chunks (e.g. layout subtrees of very different sizes) still balance across threads.
+ * Helper tasks share the loop state through a shared_ptr because one may start only after the
+ * loop has already finished; it then finds no chunk left and returns without touching the body.
+ */
+#include "ZCompute.h"
+#include "CPUComputeBackend.h"
+#include <algorithm>
+
+#ifdef ZINCX_THREAD_SAFE
+#include <thread>
+#endif
+
+ZCompute::ZCompute(std::unique_ptr<IZComputeBackend> backend)
+    : backend_(std::move(backend)) {
+    if (!backend_) throw ZincX::ZException("ZCompute requires a backend");
+}
+
+ZCompute& ZCompute::shared() {
+    static ZCompute instance(std::make_unique<CPUComputeBackend>(CPUComputeBackend::defaultWorkerCount()));
+    return instance;
+}
+
+void ZCompute::parallelForImpl(std::size_t begin, std::size_t end, std::size_t grain, ZincX::TaskPriority priority,
+                               void (*invoke)(void*, std::size_t, std::size_t), void* context) {
+    if (end <= begin) return;
+    const std::size_t count = end - begin;
+    const std::size_t threads = backend_->concurrency();
+    if (grain == 0) grain = std::max<std::size_t>(1, count / ((threads + 1) * 4));
+    if (threads == 0 || count <= grain) {
+        invoke(context, begin, end);
+        return;
+    }
+
+#ifdef ZINCX_THREAD_SAFE
+    struct Loop {
+        std::atomic<std::size_t> next{0};
+        std::atomic<std::size_t> done{0};
+        std::size_t chunks = 0;
+        std::mutex errorMutex;
+        std::exception_ptr error;
+    };
+    auto loop = std::make_shared<Loop>();
+    loop->chunks = (count + grain - 1) / grain;
+
+    auto work = [loop, begin, end, grain, invoke, context] {
+        for (;;) {
+            std::size_t chunk = loop->next.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= loop->chunks) return;
+            std::size_t first = begin + chunk * grain;
+            try {
+                invoke(context, first, std::min(first + grain, end));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(loop->errorMutex);
+                if (!loop->error) loop->error = std::current_exception();
+            }
+            loop->done.fetch_add(1, std::memory_order_release);
+        }
+    };
+
+    std::size_t helpers = std::min(threads, loop->chunks - 1);
+    for (std::size_t i = 0; i < helpers; ++i) backend_->submit(work, priority);
+    work();
+    while (loop->done.load(std::memory_order_acquire) < loop->chunks) {
+        if (!backend_->runPendingTask()) std::this_thread::yield();
+    }
+    if (loop->error) std::rethrow_exception(loop->error);
+#else
+    (void)priority;
+    invoke(context, begin, end);
+#endif
+}
@@ -0,0 +1,242 @@
+/**
+ * @file ZCompute.h
+ * @brief Defines the unified task API of the ZincX compute subsystem.
+ *
+ * This file contains ZCompute, which runs work on an IZComputeBackend, and ZFuture, the handle to
+ * a task's result. Futures support blocking get() as well as then() continuations; a thread that
+ * waits on a future helps run queued tasks instead of idling, so waiting from inside a task is
+ * safe. parallelFor() splits an index range into chunks that the calling thread and the pool
+ * claim dynamically. One shared instance (ZCompute::shared()) serves layout, image filtering and
+ * text shaping, so subsystems do not spawn their own threads.
+ */
+#pragma once
+#include "IZComputeBackend.h"
+#include "../common/ZCommon.h"
+#include "../common/ZConfig.h"
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#ifdef ZINCX_THREAD_SAFE
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#endif
+
+/** @brief Shared completion state behind a ZFuture. */
+template <typename T>
+struct ZFutureState {
+    using Stored = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+    explicit ZFutureState(IZComputeBackend* owner) : backend(owner) {}
+
+    bool isReady() const {
+#ifdef ZINCX_THREAD_SAFE
+        return ready.load(std::memory_order_acquire);
+#else
+        return ready;
+#endif
+    }
+
+    /** @brief Publishes the value or error and schedules the continuations. */
+    void complete() {
+        std::vector<IZComputeBackend::Task> pending;
+        {
+#ifdef ZINCX_THREAD_SAFE
+            std::lock_guard<std::mutex> lock(mutex);
+            ready.store(true, std::memory_order_release);
+#else
+            ready = true;
+#endif
+            pending.swap(continuations);
+        }
+#ifdef ZINCX_THREAD_SAFE
+        readyChanged.notify_all();
+#endif
+        for (auto& task : pending) task();
+    }
+
+    /** @brief Runs task once the state is complete: now if it already is, otherwise from complete(). */
+    void whenReady(IZComputeBackend::Task task) {
+        {
+#ifdef ZINCX_THREAD_SAFE
+            std::lock_guard<std::mutex> lock(mutex);
+#endif
+            if (!isReady()) {
+                continuations.push_back(std::move(task));
+                return;
+            }
+        }
+        task();
+    }
+
+    IZComputeBackend* backend;
+    std::optional<Stored> value;
+    std::exception_ptr error;
+    std::vector<IZComputeBackend::Task> continuations;
+#ifdef ZINCX_THREAD_SAFE
+    std::atomic<bool> ready{false};
+    std::mutex mutex;
+    std::condition_variable readyChanged;
+#else
+    bool ready = false;
+#endif
+};
+
+/**
+ * @brief Stores the result of calling fn (or the exception it threw) and completes the state.
+ */
+template <typename T, typename F>
+void zFulfill(ZFutureState<T>& state, F&& fn) {
+    try {
+        if constexpr (std::is_void_v<T>) {
+            std::forward<F>(fn)();
+            state.value.emplace();
+        } else {
+            state.value.emplace(std::forward<F>(fn)());
+        }
+    } catch (...) {
+        state.error = std::current_exception();
+    }
+    state.complete();
+}
+
+/** @brief Result type of a continuation taking the antecedent's value (or nothing, for void). */
+template <typename T, typename F>
+struct ZContinuationResult { using type = std::invoke_result_t<F, const T&>; };
+
+template <typename F>
+struct ZContinuationResult<void, F> { using type = std::invoke_result_t<F>; };
+
+/**
+ * @brief A copyable handle to the eventual result of a compute task.
+ */
+template <typename T>
+class ZFuture {
+public:
+    ZFuture() = default;
+    explicit ZFuture(std::shared_ptr<ZFutureState<T>> state) : state_(std::move(state)) {}
+
+    bool isValid() const { return state_ != nullptr; }
+    bool isReady() const { return state_ && state_->isReady(); }
+
+    /** @brief Blocks until the result is available, running queued tasks meanwhile. */
+    void wait() const {
+        while (!state_->isReady()) {
+            if (state_->backend && state_->backend->runPendingTask()) continue;
+#ifdef ZINCX_THREAD_SAFE
+            std::unique_lock<std::mutex> lock(state_->mutex);
+            state_->readyChanged.wait_for(lock, std::chrono::milliseconds(1), [this] { return state_->isReady(); });
+#else
+            throw ZincX::ZException("ZFuture::wait: result can never become ready on a single-threaded build");
+#endif
+        }
+    }
+
+    /**
+     * @brief Waits for and returns the result, rethrowing the task's exception if it failed.
+     * @return A reference to the stored value, valid while any copy of this future exists.
+     */
+    decltype(auto) get() const {
+        wait();
+        if (state_->error) std::rethrow_exception(state_->error);
+        if constexpr (!std::is_void_v<T>) return static_cast<const T&>(*state_->value);
+    }
+
+    /**
+     * @brief Schedules fn to run with this future's result once it is available.
+     *
+     * If this future failed, fn is skipped and the returned future carries the same exception.
+     *
+     * @param fn Called as fn(const T&), or fn() for ZFuture<void>.
+     * @param priority Priority of the continuation task.
+     * @return A future for fn's result.
+     */
+    template <typename F>
+    auto then(F&& fn, ZincX::TaskPriority priority = ZincX::TaskPriority::Medium) const {
+        using R = typename ZContinuationResult<T, F>::type;
+        auto next = std::make_shared<ZFutureState<R>>(state_->backend);
+        state_->whenReady([prev = state_, next, priority, fn = std::forward<F>(fn)]() mutable {
+            next->backend->submit([prev, next, fn = std::move(fn)]() mutable {
+                if (prev->error) {
+                    next->error = prev->error;
+                    next->complete();
+                } else if constexpr (std::is_void_v<T>) {
+                    zFulfill(*next, fn);
+                } else {
+                    zFulfill(*next, [&] { return fn(static_cast<const T&>(*prev->value)); });
+                }
+            }, priority);
+        });
+        return ZFuture<R>(std::move(next));
+    }
+
+private:
+    std::shared_ptr<ZFutureState<T>> state_;
+};
+
+class ZCompute {
+public:
+    /**
+     * @brief Constructs a compute front end over a backend.
+     * @param backend The backend that executes tasks; must not be null.
+     */
+    explicit ZCompute(std::unique_ptr<IZComputeBackend> backend);
+
+    /**
+     * @brief Returns the process-wide instance, created on first use.
+     *
+     * It runs on a CPUComputeBackend with CPUComputeBackend::defaultWorkerCount() workers, which
+     * is zero (inline execution) on DOS and Win16.
+     */
+    static ZCompute& shared();
+
+    IZComputeBackend& backend() { return *backend_; }
+
+    /**
+     * @brief Runs fn on the backend and returns a future for its result.
+     * @param fn Callable taking no arguments; exceptions are captured in the future.
+     * @param priority Scheduling priority.
+     */
+    template <typename F>
+    auto submit(F&& fn, ZincX::TaskPriority priority = ZincX::TaskPriority::Medium) {
+        using R = std::invoke_result_t<F>;
+        auto state = std::make_shared<ZFutureState<R>>(backend_.get());
+        backend_->submit([state, fn = std::forward<F>(fn)]() mutable { zFulfill(*state, fn); }, priority);
+        return ZFuture<R>(std::move(state));
+    }
+
+    /**
+     * @brief Calls body(first, last) over disjoint chunks covering [begin, end), in parallel.
+     *
+     * The calling thread works on chunks too and returns once all are done. If any chunk
+     * throws, the first exception is rethrown after the remaining chunks finish.
+     *
+     * @param begin First index.
+     * @param end One past the last index.
+     * @param body Callable invoked as body(std::size_t first, std::size_t last).
+     * @param grain Indices per chunk; 0 picks about four chunks per thread.
+     * @param priority Priority of the helper tasks.
+     */
+    template <typename Body>
+    void parallelFor(std::size_t begin, std::size_t end, Body&& body, std::size_t grain = 0,
+                     ZincX::TaskPriority priority = ZincX::TaskPriority::High) {
+        auto invoke = [](void* context, std::size_t first, std::size_t last) {
+            (*static_cast<std::remove_reference_t<Body>*>(context))(first, last);
+        };
+        parallelForImpl(begin, end, grain, priority, invoke, const_cast<void*>(static_cast<const void*>(std::addressof(body))));
+    }
+
+private:
+    void parallelForImpl(std::size_t begin, std::size_t end, std::size_t grain, ZincX::TaskPriority priority,
+                         void (*invoke)(void*, std::size_t, std::size_t), void* context);
+
+    std::unique_ptr<IZComputeBackend> backend_;
+};
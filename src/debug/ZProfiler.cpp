@@ -0,0 +1,262 @@
+/**
+ * @file ZProfiler.cpp
+ * @brief Implementation of the ZProfiler class for the ZincX debug subsystem.
+ *
+ * A thread's ring is written only by that thread and read only by a drain, which holds the
+ * registry mutex, so one acquire/release pair per side is all the synchronization it needs. The
+ * recording thread never waits: when the drainer has fallen a full ring behind, the scope is
+ * counted as dropped rather than overwriting events the drainer may be copying. Each thread
+ * shares ownership of its ring, so a thread still recording after the profiler is destroyed writes
+ * into memory that stays alive until the thread exits.
+ */
+#include "ZProfiler.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+    thread_local std::shared_ptr<void> tlsRing;
+
+    constexpr const char* kCategoryNames[] = { "Rendering", "Compute", "Input", "Layout", "Resource" };
+    constexpr const char* kCounterNames[kProfileCounterCount] = {
+        "DrawCalls", "EventsDispatched", "ItemsCulled", "LayoutPasses", "ResourceLoads"
+    };
+
+    void writeJsonString(std::ostream& out, const char* text) {
+        out << '"';
+        for (const char* c = text ? text : ""; *c; ++c) {
+            if (*c == '"' || *c == '\\') {
+                out << '\\' << *c;
+            } else if (static_cast<unsigned char>(*c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof escaped, "\\u%04x", static_cast<unsigned>(*c));
+                out << escaped;
+            } else {
+                out << *c;
+            }
+        }
+        out << '"';
+    }
+}
+
+ZProfiler& ZProfiler::instance() {
+    static ZProfiler profiler;
+    return profiler;
+}
+
+ZProfiler::ZProfiler() : frameBegin_(ZincX::ZTime::now()) {
+    history_.reserve(ZincX::PROFILE_FRAME_HISTORY);
+}
+
+void ZProfiler::setEnabled(bool enabled) {
+#ifdef ZINCX_THREAD_SAFE
+    enabled_.store(enabled, std::memory_order_relaxed);
+#else
+    enabled_ = enabled;
+#endif
+}
+
+bool ZProfiler::isEnabled() const {
+#ifdef ZINCX_THREAD_SAFE
+    return enabled_.load(std::memory_order_relaxed);
+#else
+    return enabled_;
+#endif
+}
+
+ZProfiler::ThreadRing& ZProfiler::localRing() {
+    if (tlsRing) return *static_cast<ThreadRing*>(tlsRing.get());
+#ifdef ZINCX_THREAD_SAFE
+    std::lock_guard<std::mutex> lock(registryMutex_);
+#endif
+    rings_.push_back(std::make_shared<ThreadRing>(static_cast<std::uint32_t>(rings_.size() + 1)));
+    tlsRing = rings_.back();
+    return *rings_.back();
+}
+
+void ZProfiler::record(const char* name, ZincX::ProfilingCategory category, std::uint64_t begin, std::uint64_t end) {
+    if (!isEnabled()) return;
+    ThreadRing& ring = localRing();
+    const std::size_t capacity = ring.events.size();
+#ifdef ZINCX_THREAD_SAFE
+    const std::size_t tail = ring.tail.load(std::memory_order_relaxed);
+    if (tail - ring.head.load(std::memory_order_acquire) >= capacity) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    ring.events[tail % capacity] = { name, category, ring.thread, begin, end };
+    ring.tail.store(tail + 1, std::memory_order_release);
+#else
+    if (ring.tail - ring.head >= capacity) {
+        ++dropped_;
+        return;
+    }
+    ring.events[ring.tail++ % capacity] = { name, category, ring.thread, begin, end };
+#endif
+}
+
+void ZProfiler::count(ZProfileCounter counter, std::uint64_t amount) {
+    if (!isEnabled()) return;
+#ifdef ZINCX_THREAD_SAFE
+    counters_[static_cast<std::size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+#else
+    counters_[static_cast<std::size_t>(counter)] += amount;
+#endif
+}
+
+void ZProfiler::endFrame() {
+#ifdef ZINCX_THREAD_SAFE
+    std::lock_guard<std::mutex> lock(historyMutex_);
+#endif
+    ZFrameStats stats;
+    stats.begin = frameBegin_;
+    stats.end = ZincX::ZTime::now();
+    for (std::size_t i = 0; i < kProfileCounterCount; ++i) {
+#ifdef ZINCX_THREAD_SAFE
+        stats.counters[i] = counters_[i].exchange(0, std::memory_order_relaxed);
+#else
+        stats.counters[i] = counters_[i];
+        counters_[i] = 0;
+#endif
+    }
+    frameBegin_ = stats.end;
+    stats.frame = frame_++;
+    if (history_.size() < ZincX::PROFILE_FRAME_HISTORY) {
+        history_.push_back(stats);
+    } else {
+        history_[historyNext_] = stats;
+    }
+    historyNext_ = (historyNext_ + 1) % ZincX::PROFILE_FRAME_HISTORY;
+}
+
+ZFrameStats ZProfiler::lastFrame() const {
+#ifdef ZINCX_THREAD_SAFE
+    std::lock_guard<std::mutex> lock(historyMutex_);
+#endif
+    if (history_.empty()) return {};
+    return history_[(historyNext_ + ZincX::PROFILE_FRAME_HISTORY - 1) % ZincX::PROFILE_FRAME_HISTORY];
+}
+
+std::vector<ZFrameStats> ZProfiler::frames() const {
+#ifdef ZINCX_THREAD_SAFE
+    std::lock_guard<std::mutex> lock(historyMutex_);
+#endif
+    std::vector<ZFrameStats> out;
+    out.reserve(history_.size());
+    // Until the history is full historyNext_ equals its size and the first loop copies nothing.
+    for (std::size_t i = historyNext_; i < history_.size(); ++i) out.push_back(history_[i]);
+    for (std::size_t i = 0; i < std::min(historyNext_, history_.size()); ++i) out.push_back(history_[i]);
+    return out;
+}
+
+std::string ZProfiler::frameSummary() const {
+    std::string out;
+    char line[64];
+    for (const ZFrameStats& stats : frames()) {
+        std::snprintf(line, sizeof line, "frame %llu: %.3f ms", static_cast<unsigned long long>(stats.frame),
+                      stats.milliseconds());
+        out += line;
+        for (std::size_t i = 0; i < kProfileCounterCount; ++i) {
+            std::snprintf(line, sizeof line, ", %s %llu", kCounterNames[i],
+                          static_cast<unsigned long long>(stats.counters[i]));
+            out += line;
+        }
+        out += '\n';
+    }
+    return out;
+}
+
+void ZProfiler::drainInto(std::vector<ZProfileEvent>& out) {
+    for (const auto& ring : rings_) {
+        const std::size_t capacity = ring->events.size();
+#ifdef ZINCX_THREAD_SAFE
+        const std::size_t head = ring->head.load(std::memory_order_relaxed);
+        const std::size_t tail = ring->tail.load(std::memory_order_acquire);
+#else
+        const std::size_t head = ring->head;
+        const std::size_t tail = ring->tail;
+#endif
+        for (std::size_t i = head; i != tail; ++i) out.push_back(ring->events[i % capacity]);
+#ifdef ZINCX_THREAD_SAFE
+        ring->head.store(tail, std::memory_order_release);
+#else
+        ring->head = tail;
+#endif
+    }
+}
+
+std::vector<ZProfileEvent> ZProfiler::drain() {
+    std::vector<ZProfileEvent> events;
+    {
+#ifdef ZINCX_THREAD_SAFE
+        std::lock_guard<std::mutex> lock(registryMutex_);
+#endif
+        drainInto(events);
+    }
+    std::sort(events.begin(), events.end(),
+              [](const ZProfileEvent& a, const ZProfileEvent& b) { return a.begin < b.begin; });
+    return events;
+}
+
+void ZProfiler::writeChromeTrace(std::ostream& out) {
+    const std::vector<ZProfileEvent> events = drain();
+    const std::vector<ZFrameStats> history = frames();
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const ZProfileEvent& event : events) {
+        out << (first ? "\n" : ",\n") << "{\"name\":";
+        writeJsonString(out, event.name);
+        out << ",\"cat\":\"" << kCategoryNames[static_cast<std::size_t>(event.category)] << "\",\"ph\":\"X\",\"ts\":"
+            << event.begin << ",\"dur\":" << (event.end - event.begin) << ",\"pid\":1,\"tid\":" << event.thread << '}';
+        first = false;
+    }
+    // Counter tracks: one sample per closed frame, stamped at its start.
+    for (const ZFrameStats& stats : history) {
+        out << (first ? "\n" : ",\n") << "{\"name\":\"Frame\",\"ph\":\"C\",\"ts\":" << stats.begin
+            << ",\"pid\":1,\"args\":{";
+        for (std::size_t i = 0; i < kProfileCounterCount; ++i) {
+            out << (i ? ",\"" : "\"") << kCounterNames[i] << "\":" << stats.counters[i];
+        }
+        out << "}}";
+        first = false;
+    }
+    out << "\n]}\n";
+}
+
+void ZProfiler::saveChromeTrace(const std::string& path) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) throw ZincX::ZException("ZProfiler: cannot create " + path);
+    writeChromeTrace(file);
+    file.flush();
+    if (!file) throw ZincX::ZException("ZProfiler: failed writing " + path);
+}
+
+std::uint64_t ZProfiler::droppedEvents() const {
+#ifdef ZINCX_THREAD_SAFE
+    return dropped_.load(std::memory_order_relaxed);
+#else
+    return dropped_;
+#endif
+}
+
+void ZProfiler::reset() {
+    drain();
+    for (std::size_t i = 0; i < kProfileCounterCount; ++i) {
+#ifdef ZINCX_THREAD_SAFE
+        counters_[i].store(0, std::memory_order_relaxed);
+#else
+        counters_[i] = 0;
+#endif
+    }
+#ifdef ZINCX_THREAD_SAFE
+    dropped_.store(0, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(historyMutex_);
+#else
+    dropped_ = 0;
+#endif
+    history_.clear();
+    historyNext_ = 0;
+    frame_ = 0;
+    frameBegin_ = ZincX::ZTime::now();
+}
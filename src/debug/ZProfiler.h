@@ -0,0 +1,193 @@
+/**
+ * @file ZProfiler.h
+ * @brief Defines the scope timers and frame counters of the ZincX debug subsystem.
+ *
+ * This file contains ZProfiler, which collects timed scopes and per-frame counters, ZProfileScope,
+ * the RAII timer behind ZINCX_PROFILE_SCOPE, and the ZINCX_PROFILE_* macros the framework is
+ * instrumented with. Each thread writes its scope timings into its own fixed-size ring with no
+ * locks and no allocation; the rings are drained on demand, typically once per frame or when a
+ * trace is saved, and written out as Chrome trace JSON (chrome://tracing, Perfetto). Counters such
+ * as draw calls and events dispatched accumulate until endFrame() closes the frame into a short
+ * history of ZFrameStats.
+ *
+ * The macros expand to nothing unless ZINCX_PROFILE is defined (CMake option ZINCX_PROFILING),
+ * so release builds carry neither the timer calls nor the evaluation of their arguments.
+ */
+#pragma once
+#include "../common/ZCommon.h"
+#include "../common/ZCommonEnums.h"
+#include "../common/ZConfig.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#ifdef ZINCX_THREAD_SAFE
+#include <atomic>
+#include <mutex>
+#endif
+
+/** @brief Per-frame counters; see ZFrameStats. */
+enum class ZProfileCounter : std::uint8_t {
+    DrawCalls,         ///< Draw commands submitted to the backend.
+    EventsDispatched,  ///< Events delivered to listeners, after coalescing.
+    ItemsCulled,       ///< Scene items skipped by the spatial index, summed over damage rectangles.
+    LayoutPasses,      ///< ZLayoutNode::layout calls.
+    ResourceLoads      ///< Resources loaded by ZResourceManager, whether they succeeded or not.
+};
+
+inline constexpr std::size_t kProfileCounterCount = 5;
+
+/** @brief One timed scope. */
+struct ZProfileEvent {
+    const char* name;                  ///< Static string given to ZINCX_PROFILE_SCOPE.
+    ZincX::ProfilingCategory category;
+    std::uint32_t thread;              ///< Profiler thread number, in order of first use, from 1.
+    std::uint64_t begin;               ///< ZincX::ZTime::now() at scope entry, in microseconds.
+    std::uint64_t end;                 ///< ZincX::ZTime::now() at scope exit.
+};
+
+/** @brief Counters of one closed frame. */
+struct ZFrameStats {
+    std::uint64_t frame = 0;   ///< Frame number, from 0.
+    std::uint64_t begin = 0;   ///< Time the frame was opened, in microseconds.
+    std::uint64_t end = 0;     ///< Time endFrame() closed it.
+    std::array<std::uint64_t, kProfileCounterCount> counters{};
+
+    std::uint64_t count(ZProfileCounter counter) const { return counters[static_cast<std::size_t>(counter)]; }
+    double milliseconds() const { return static_cast<double>(end - begin) / 1000.0; }
+};
+
+class ZProfiler {
+public:
+    /** @brief The process-wide profiler the macros report to. */
+    static ZProfiler& instance();
+
+    ZProfiler(const ZProfiler&) = delete;
+    ZProfiler& operator=(const ZProfiler&) = delete;
+
+    /** @brief Pauses or resumes recording of scopes and counters; enabled by default. */
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+
+    /**
+     * @brief Appends a timed scope to the calling thread's ring; lock-free.
+     *
+     * If the ring is full the scope is dropped and counted in droppedEvents(), so drain at least
+     * once every ZincX::PROFILE_RING_EVENTS scopes per thread.
+     */
+    void record(const char* name, ZincX::ProfilingCategory category, std::uint64_t begin, std::uint64_t end);
+
+    /** @brief Adds to a counter of the current frame; safe from any thread. */
+    void count(ZProfileCounter counter, std::uint64_t amount = 1);
+
+    /** @brief Closes the current frame into the history and opens the next one. */
+    void endFrame();
+
+    /** @brief The most recently closed frame; all zero before the first endFrame(). */
+    ZFrameStats lastFrame() const;
+
+    /** @brief Closed frames, oldest first, at most ZincX::PROFILE_FRAME_HISTORY of them. */
+    std::vector<ZFrameStats> frames() const;
+
+    /** @brief One line per recent frame: duration and each counter. */
+    std::string frameSummary() const;
+
+    /**
+     * @brief Removes and returns every scope recorded so far, from all threads.
+     *
+     * Threads keep recording while this runs; their newest scopes are returned by the next call.
+     */
+    std::vector<ZProfileEvent> drain();
+
+    /**
+     * @brief Drains all scopes and writes them, with the frame history as counter tracks, as a
+     * Chrome trace JSON object.
+     */
+    void writeChromeTrace(std::ostream& out);
+
+    /** @brief Drains and writes a Chrome trace to a file. @throws ZincX::ZException on I/O failure. */
+    void saveChromeTrace(const std::string& path);
+
+    /** @brief Scopes lost to full rings since the last reset(). */
+    std::uint64_t droppedEvents() const;
+
+    /** @brief Discards recorded scopes, counters and frame history. */
+    void reset();
+
+private:
+    /** @brief Single-producer ring owned by one thread and drained under registryMutex_. */
+    struct ThreadRing {
+        explicit ThreadRing(std::uint32_t thread) : thread(thread), events(ZincX::PROFILE_RING_EVENTS) {}
+
+        std::uint32_t thread;
+        std::vector<ZProfileEvent> events;
+#ifdef ZINCX_THREAD_SAFE
+        std::atomic<std::size_t> head{ 0 };   ///< Next slot to drain; written by the drainer.
+        std::atomic<std::size_t> tail{ 0 };   ///< Next slot to fill; written by the owning thread.
+#else
+        std::size_t head = 0;
+        std::size_t tail = 0;
+#endif
+    };
+
+    ZProfiler();
+
+    /** @brief The calling thread's ring, registering it on first use. */
+    ThreadRing& localRing();
+
+    void drainInto(std::vector<ZProfileEvent>& out);
+
+    std::vector<std::shared_ptr<ThreadRing>> rings_;   ///< Kept after their threads exit; shared with them.
+    std::vector<ZFrameStats> history_;                 ///< Circular once full.
+    std::size_t historyNext_ = 0;
+    std::uint64_t frame_ = 0;
+    std::uint64_t frameBegin_;
+#ifdef ZINCX_THREAD_SAFE
+    std::atomic<bool> enabled_{ true };
+    std::array<std::atomic<std::uint64_t>, kProfileCounterCount> counters_{};
+    std::atomic<std::uint64_t> dropped_{ 0 };
+    std::mutex registryMutex_;          ///< Guards rings_ and serializes drains.
+    mutable std::mutex historyMutex_;   ///< Guards the frame history.
+#else
+    bool enabled_ = true;
+    std::array<std::uint64_t, kProfileCounterCount> counters_{};
+    std::uint64_t dropped_ = 0;
+#endif
+};
+
+/** @brief Times the enclosing scope and records it with ZProfiler::instance() on exit. */
+class ZProfileScope {
+public:
+    ZProfileScope(const char* name, ZincX::ProfilingCategory category)
+        : name_(name), category_(category), begin_(ZincX::ZTime::now()) {}
+    ~ZProfileScope() { ZProfiler::instance().record(name_, category_, begin_, ZincX::ZTime::now()); }
+
+    ZProfileScope(const ZProfileScope&) = delete;
+    ZProfileScope& operator=(const ZProfileScope&) = delete;
+
+private:
+    const char* name_;
+    ZincX::ProfilingCategory category_;
+    std::uint64_t begin_;
+};
+
+#define ZINCX_PROFILE_JOIN_(a, b) a##b
+#define ZINCX_PROFILE_JOIN(a, b) ZINCX_PROFILE_JOIN_(a, b)
+
+#ifdef ZINCX_PROFILE
+/** @brief Times the rest of the enclosing block. @p category is a ProfilingCategory enumerator name. */
+#define ZINCX_PROFILE_SCOPE(name, category) \
+    ZProfileScope ZINCX_PROFILE_JOIN(zincxProfileScope, __LINE__)(name, ZincX::ProfilingCategory::category)
+/** @brief Adds @p amount to a ZProfileCounter, named without its enum prefix. */
+#define ZINCX_PROFILE_COUNT(counter, amount) ZProfiler::instance().count(ZProfileCounter::counter, (amount))
+/** @brief Closes the current frame. */
+#define ZINCX_PROFILE_FRAME() ZProfiler::instance().endFrame()
+#else
+#define ZINCX_PROFILE_SCOPE(name, category) static_cast<void>(0)
+#define ZINCX_PROFILE_COUNT(counter, amount) static_cast<void>(0)
+#define ZINCX_PROFILE_FRAME() static_cast<void>(0)
+#endif
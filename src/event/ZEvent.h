@@ -4,25 +4,124 @@
  *
  * This file contains the foundational event types used in the ZincX UI framework, including the base
  * ZEvent structure and derived types like ZMouseEvent, facilitating event handling and dispatching.
+ * Events are plain values without virtual functions: ZEventRecord stores any of them inline, so
+ * queuing an event never allocates, and ZEvent::as() recovers the concrete type from the
+ * EventType tag instead of RTTI.
  */
  #pragma once
  #include "../common/ZCommon.h"
  #include "../common/ZCommonEnums.h"
+ #include <cstddef>
  #include <cstdint>
- 
+ #include <type_traits>
+ #include <variant>
+
+ /** @brief Number of ZincX::EventType enumerators; keep in sync with the last one. */
+ inline constexpr std::size_t kEventTypeCount = static_cast<std::size_t>(ZincX::EventType::Network) + 1;
+
  struct ZEvent {
      ZincX::EventType type;
-     uint64_t timestamp;
+     uint64_t timestamp;        ///< ZincX::ZTime::now() at construction, in microseconds.
      ZincX::InputDeviceType deviceType;
-     virtual ~ZEvent() = default;
+     mutable bool accepted;     ///< Set by accept(); stops the event bubbling to parent items.
      explicit ZEvent(ZincX::EventType t, ZincX::InputDeviceType device = ZincX::InputDeviceType::Mouse)
-         : type(t), timestamp(0), deviceType(device) {} // Add proper timestamp later
+         : type(t), timestamp(ZincX::ZTime::now()), deviceType(device), accepted(false) {}
+
+     /** @brief Marks the event as handled so no further item receives it. */
+     void accept() const { accepted = true; }
+
+     /**
+      * @brief Returns this event as a concrete event type, or nullptr if the tag says otherwise.
+      * @tparam E ZMouseEvent, ZKeyEvent, ZTouchEvent or ZNetEvent.
+      */
+     template <typename E>
+     const E* as() const { return E::matches(type) ? static_cast<const E*>(this) : nullptr; }
  };
- 
+
  struct ZMouseEvent : ZEvent {
-     ZPoint position;
+     ZincX::ZPoint position;
      int button;
      ZincX::KeyModifier modifiers;
-     ZMouseEvent(ZincX::EventType t, ZPoint pos, int btn, ZincX::KeyModifier mod = ZincX::KeyModifier::None)
+     ZMouseEvent(ZincX::EventType t, ZincX::ZPoint pos, int btn, ZincX::KeyModifier mod = ZincX::KeyModifier::None)
          : ZEvent(t, ZincX::InputDeviceType::Mouse), position(pos), button(btn), modifiers(mod) {}
- };
\ No newline at end of file
+
+     static constexpr bool matches(ZincX::EventType t) {
+         return t == ZincX::EventType::MouseClick || t == ZincX::EventType::MouseRelease ||
+                t == ZincX::EventType::MouseMove || t == ZincX::EventType::MouseDrag;
+     }
+ };
+
+ struct ZKeyEvent : ZEvent {
+     int keyCode;                  ///< Platform-independent key code.
+     char32_t character;           ///< Translated character, or 0 for non-printing keys.
+     ZincX::KeyModifier modifiers;
+     ZKeyEvent(ZincX::EventType t, int key, char32_t ch = 0, ZincX::KeyModifier mod = ZincX::KeyModifier::None)
+         : ZEvent(t, ZincX::InputDeviceType::Keyboard), keyCode(key), character(ch), modifiers(mod) {}
+
+     static constexpr bool matches(ZincX::EventType t) { return t == ZincX::EventType::KeyPress; }
+ };
+
+ struct ZTouchEvent : ZEvent {
+     ZincX::ZPoint position;
+     int touchId;                  ///< Identifies the contact across a touch sequence.
+     ZTouchEvent(ZincX::EventType t, ZincX::ZPoint pos, int id = 0)
+         : ZEvent(t, ZincX::InputDeviceType::Touchpad), position(pos), touchId(id) {}
+
+     static constexpr bool matches(ZincX::EventType t) {
+         return t == ZincX::EventType::TouchStart || t == ZincX::EventType::TouchMove;
+     }
+ };
+
+ /**
+  * @brief A state change of a ZNet connection, or data it received.
+  *
+  * Data stays in ZNet's receive buffers; the event only locates it, and ZNet::data() returns the
+  * bytes without copying them. They remain valid until the next ZNet::poll().
+  */
+ struct ZNetEvent : ZEvent {
+     std::uint32_t connection;        ///< The connection the event is about.
+     ZincX::ConnectionState state;    ///< The connection's state after the event.
+     std::uint32_t listener = 0;      ///< For a connection accepted by ZNet::listen(), the listening one.
+     std::uint32_t buffer = 0;        ///< Receive buffer holding the data.
+     std::uint32_t offset = 0;        ///< Start of the data in the buffer.
+     std::uint32_t size = 0;          ///< Bytes received; 0 for a pure state change.
+     int error = 0;                   ///< System error code if state is Failed, else 0.
+     ZNetEvent(std::uint32_t id, ZincX::ConnectionState s)
+         : ZEvent(ZincX::EventType::Network, ZincX::InputDeviceType::Network), connection(id), state(s) {}
+
+     static constexpr bool matches(ZincX::EventType t) { return t == ZincX::EventType::Network; }
+ };
+
+ /**
+  * @brief A fixed-size, trivially copyable holder for any concrete event.
+  *
+  * The event manager queues records by value, so posting and dispatching an event costs no
+  * heap traffic. A default-constructed record is empty and only used for unfilled queue slots.
+  */
+ class ZEventRecord {
+ public:
+     ZEventRecord() = default;
+     ZEventRecord(const ZMouseEvent& event) : data_(event) {}
+     ZEventRecord(const ZKeyEvent& event) : data_(event) {}
+     ZEventRecord(const ZTouchEvent& event) : data_(event) {}
+     ZEventRecord(const ZNetEvent& event) : data_(event) {}
+
+     bool isEmpty() const { return data_.index() == 0; }
+
+     /** @brief Returns the common event header; the record must not be empty. */
+     const ZEvent& event() const {
+         if (auto* mouse = std::get_if<ZMouseEvent>(&data_)) return *mouse;
+         if (auto* key = std::get_if<ZKeyEvent>(&data_)) return *key;
+         if (auto* net = std::get_if<ZNetEvent>(&data_)) return *net;
+         return std::get<ZTouchEvent>(data_);
+     }
+
+     ZEvent& event() { return const_cast<ZEvent&>(static_cast<const ZEventRecord*>(this)->event()); }
+
+     ZincX::EventType type() const { return event().type; }
+
+ private:
+     std::variant<std::monostate, ZMouseEvent, ZKeyEvent, ZTouchEvent, ZNetEvent> data_;
+ };
+
+ static_assert(std::is_trivially_copyable_v<ZEventRecord>, "ZEventRecord must stay memcpy-able");
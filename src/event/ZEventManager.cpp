@@ -4,32 +4,219 @@
  *
  * This file provides the implementation for the ZEventManager class, handling event queuing and
  * dispatching to registered listeners, including state updates for graphics items in the ZincX UI framework.
+ * Only the hit item changes to Pressed; it is remembered so the matching release restores it even
+ * if the pointer has left the item by then.
+ * Listener registrations and unregistrations made by listeners are queued and applied when the
+ * outermost dispatch returns, so the lists being walked never change underneath it.
+ * The consumer clears the wake flag before draining, so an event posted mid-drain either gets
+ * dispatched by the current pass or triggers a fresh wake-up; it is never stranded.
  */
  #include "ZEventManager.h"
  #include "../graphics/ZGraphicsItem.h"
- 
- void ZEventManager::queueEvent(std::unique_ptr<ZEvent> event) {
-     eventQueue_.push(std::move(event));
+ #include "../graphics/ZGraphicsScene.h"
+ #include "../debug/ZProfiler.h"
+ #include <algorithm>
+
+ namespace {
+     // True if two events belong to the same input stream for coalescing purposes.
+     bool sameStream(const ZEvent& a, const ZEvent& b) {
+         if (a.type != b.type || a.deviceType != b.deviceType) return false;
+         if (auto* ta = a.as<ZTouchEvent>()) return ta->touchId == b.as<ZTouchEvent>()->touchId;
+         return true;
+     }
+ }
+
+ ZEventManager::ZEventManager(std::size_t queueCapacity)
+     : eventQueue_(queueCapacity) {
+     setCoalescePolicy(ZincX::EventType::MouseMove, ZincX::CoalescePolicy::Coalesce);
+     setCoalescePolicy(ZincX::EventType::MouseDrag, ZincX::CoalescePolicy::Coalesce);
+     setCoalescePolicy(ZincX::EventType::TouchMove, ZincX::CoalescePolicy::Coalesce);
+ }
+
+ void ZEventManager::setCoalescePolicy(ZincX::EventType type, ZincX::CoalescePolicy policy, std::size_t keep) {
+     Coalescing& entry = coalescing_[static_cast<std::size_t>(type)];
+     entry.policy = policy;
+     entry.keep = policy == ZincX::CoalescePolicy::KeepLatestN ? std::max<std::size_t>(keep, 1) : 1;
+ }
+
+ bool ZEventManager::queueEvent(const ZEventRecord& event) {
+     if (!eventQueue_.tryPush(ZEventRecord(event))) {
+ #ifdef ZINCX_THREAD_SAFE
+         dropped_.fetch_add(1, std::memory_order_relaxed);
+ #else
+         ++dropped_;
+ #endif
+         return false;
+     }
+ #ifdef ZINCX_THREAD_SAFE
+     bool wake = !wakePending_.exchange(true, std::memory_order_acq_rel);
+ #else
+     bool wake = !wakePending_;
+     wakePending_ = true;
+ #endif
+     if (wake && wakeHandler_) wakeHandler_();
+     return true;
  }
- 
+
  void ZEventManager::dispatchEvents() {
-     while (!eventQueue_.empty()) {
-         auto event = std::move(eventQueue_.front());
-         eventQueue_.pop();
-         for (auto& [item, callback] : listeners_) {
-             callback(*event);
-             // Example: Update item state based on event
-             if (auto* mouseEvent = dynamic_cast<ZMouseEvent*>(event.get())) {
-                 if (mouseEvent->type == ZincX::EventType::MouseClick) {
-                     item->setState(ZincX::WidgetState::Pressed);
-                 } else if (mouseEvent->type == ZincX::EventType::MouseRelease) {
-                     item->setState(ZincX::WidgetState::Normal);
-                 }
+     ZINCX_PROFILE_SCOPE("ZEventManager::dispatchEvents", Input);
+ #ifdef ZINCX_THREAD_SAFE
+     wakePending_.store(false, std::memory_order_release);
+ #else
+     wakePending_ = false;
+ #endif
+     // Drain in passes so events posted by listeners are still handled in this call.
+     ZEventRecord record;
+     while (eventQueue_.tryPop(record)) {
+         batch_.clear();
+         do {
+             batch_.push_back(record);
+         } while (eventQueue_.tryPop(record));
+         coalesceBatch();
+         ZINCX_PROFILE_COUNT(EventsDispatched, batch_.size());
+         for (const ZEventRecord& queued : batch_) dispatch(queued.event());
+     }
+ }
+
+ void ZEventManager::coalesceBatch() {
+     std::size_t out = 0;
+     std::size_t i = 0;
+     while (i < batch_.size()) {
+         const ZEvent& first = batch_[i].event();
+         const Coalescing& entry = coalescing_[static_cast<std::size_t>(first.type)];
+         std::size_t end = i + 1;
+         if (entry.policy != ZincX::CoalescePolicy::KeepAll) {
+             while (end < batch_.size() && sameStream(first, batch_[end].event())) ++end;
+         }
+         // Keep the newest entries of the run; KeepAll runs have length one.
+         std::size_t keep = entry.policy == ZincX::CoalescePolicy::KeepAll ? end - i : std::min(entry.keep, end - i);
+         coalesced_ += end - i - keep;
+         for (std::size_t k = end - keep; k < end; ++k) batch_[out++] = batch_[k];
+         i = end;
+     }
+     batch_.resize(out);
+ }
+
+ void ZEventManager::endPress() {
+     // Listeners that changed the state during the press, e.g. disabled the item, keep their change.
+     if (pressedItem_ && pressedItem_->state() == ZincX::WidgetState::Pressed) pressedItem_->setState(pressedFrom_);
+     pressedItem_ = nullptr;
+ }
+
+ ZGraphicsItem* ZEventManager::targetOf(const ZEvent& event) const {
+     if (auto* mouse = event.as<ZMouseEvent>()) {
+         if (event.type == ZincX::EventType::MouseRelease && pressedItem_) return pressedItem_;
+         return scene_ ? scene_->itemAt(mouse->position) : nullptr;
+     }
+     if (auto* touch = event.as<ZTouchEvent>()) {
+         return scene_ ? scene_->itemAt(touch->position) : nullptr;
+     }
+     if (event.as<ZNetEvent>()) return nullptr;
+     return focusItem_;
+ }
+
+ void ZEventManager::dispatch(const ZEvent& event) {
+     // A listener may have moved items by their transformation; hit-test against where they are now.
+     if (scene_) scene_->updateTransforms();
+     ZGraphicsItem* target = targetOf(event);
+     switch (event.type) {
+         case ZincX::EventType::MouseClick:
+             if (target != pressedItem_) {
+                 endPress();
+                 pressedItem_ = target;
+                 if (target) pressedFrom_ = target->state();
+             }
+             // A disabled item still receives its release, but does not look pressed.
+             if (target && pressedFrom_ != ZincX::WidgetState::Disabled) target->setState(ZincX::WidgetState::Pressed);
+             break;
+         case ZincX::EventType::MouseRelease:
+             endPress();
+             break;
+         default: break;
+     }
+
+     // Listeners may register or unregister listeners; those changes wait in pending_ so that no
+     // list is reallocated or erased while it is being walked.
+     struct Depth {
+         ZEventManager& manager;
+         explicit Depth(ZEventManager& m) : manager(m) { ++manager.dispatchDepth_; }
+         ~Depth() {
+             if (--manager.dispatchDepth_ == 0 && !manager.pending_.empty()) manager.applyPending();
+         }
+     } depth(*this);
+
+     if (!itemListeners_.empty()) {
+         for (ZGraphicsItem* item = target; item && !event.accepted; item = item->parentItem()) {
+             auto it = itemListeners_.find(item);
+             if (it == itemListeners_.end()) continue;
+             for (auto& callback : it->second) {
+                 callback(event);
+                 if (unregistering(item)) break;
              }
+             // An item unregistered by its listener may already be gone; do not ask it for a parent.
+             if (unregistering(item)) break;
+         }
+     }
+     for (auto& callback : typeListeners_[static_cast<std::size_t>(event.type)]) callback(event);
+     for (auto& callback : anyListeners_) callback(event);
+ }
+
+ bool ZEventManager::unregistering(ZGraphicsItem* item) const {
+     for (const PendingChange& change : pending_) {
+         if (change.kind == PendingChange::Unregister && change.item == item) return true;
+     }
+     return false;
+ }
+
+ void ZEventManager::applyPending() {
+     // Changes made by listeners running here land in pending_ again and are applied next round.
+     std::vector<PendingChange> changes;
+     changes.swap(pending_);
+     for (PendingChange& change : changes) {
+         switch (change.kind) {
+             case PendingChange::AddItem: registerListener(change.item, std::move(change.callback)); break;
+             case PendingChange::AddType: subscribe(change.type, std::move(change.callback)); break;
+             case PendingChange::Unregister: itemListeners_.erase(change.item); break;
          }
      }
  }
- 
- void ZEventManager::registerListener(ZGraphicsItem* item, std::function<void(const ZEvent&)> callback) {
-     listeners_.emplace_back(item, std::move(callback));
- }
\ No newline at end of file
+
+ void ZEventManager::registerListener(ZGraphicsItem* item, Listener callback) {
+     if (dispatchDepth_ > 0) {
+         pending_.push_back({ PendingChange::AddItem, item, ZincX::EventType{}, std::move(callback) });
+     } else if (item) {
+         itemListeners_[item].push_back(std::move(callback));
+     } else {
+         anyListeners_.push_back(std::move(callback));
+     }
+ }
+
+ void ZEventManager::subscribe(ZincX::EventType type, Listener callback) {
+     if (dispatchDepth_ > 0) {
+         pending_.push_back({ PendingChange::AddType, nullptr, type, std::move(callback) });
+         return;
+     }
+     typeListeners_[static_cast<std::size_t>(type)].push_back(std::move(callback));
+ }
+
+ void ZEventManager::unregisterItem(ZGraphicsItem* item) {
+     if (dispatchDepth_ > 0) {
+         pending_.push_back({ PendingChange::Unregister, item, ZincX::EventType{}, {} });
+     } else {
+         itemListeners_.erase(item);
+     }
+     if (pressedItem_ == item) pressedItem_ = nullptr;
+     if (focusItem_ == item) focusItem_ = nullptr;
+ }
+
+ void ZEventManager::setWakeHandler(std::function<void()> handler) {
+     wakeHandler_ = std::move(handler);
+ }
+
+ std::size_t ZEventManager::droppedEvents() const {
+ #ifdef ZINCX_THREAD_SAFE
+     return dropped_.load(std::memory_order_relaxed);
+ #else
+     return dropped_;
+ #endif
+ }
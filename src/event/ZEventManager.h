@@ -4,21 +4,161 @@
  *
  * This file contains the ZEventManager class, responsible for queuing and dispatching events to
  * registered listeners within the ZincX UI framework, enabling responsive user interaction.
+ * Events may be queued from any thread when ZINCX_THREAD_SAFE is enabled; dispatchEvents() and
+ * listener registration belong to the UI thread.
+ *
+ * Dispatch is targeted rather than broadcast: pointer events go to the topmost item under the
+ * pointer (found through the scene's spatial index), key events to the focus item, and from there
+ * bubble up the parent chain until a listener accepts them; network events from ZNet have no target
+ * item. Global subscribers are kept in one list per EventType, so an event only visits the
+ * listeners that asked for it.
+ *
+ * Before dispatch, runs of consecutive move events from the same device are coalesced according
+ * to a per-type CoalescePolicy, so a slow frame handles one pointer sample instead of dozens.
  */
  #pragma once
  #include "ZEvent.h"
- #include <queue>
+ #include "ZEventQueue.h"
+ #include <array>
+ #include <cstddef>
  #include <functional>
- 
+ #include <unordered_map>
+ #include <vector>
+
+ #ifdef ZINCX_THREAD_SAFE
+ #include <atomic>
+ #endif
+
  class ZGraphicsItem;
- 
+ class ZGraphicsScene;
+
  class ZEventManager {
  public:
-     void queueEvent(std::unique_ptr<ZEvent> event);
+     using Listener = std::function<void(const ZEvent&)>;
+
+     /**
+      * @brief Constructs an event manager.
+      * @param queueCapacity Maximum number of undispatched events, rounded up to a power of two.
+      */
+     explicit ZEventManager(std::size_t queueCapacity = ZincX::EVENT_QUEUE_CAPACITY);
+
+     /**
+      * @brief Posts an event for the next dispatchEvents() call without blocking or allocating.
+      * @param event The event to queue; concrete event types convert implicitly.
+      * @return False if the queue was full and the event was dropped.
+      */
+     bool queueEvent(const ZEventRecord& event);
+
+     /**
+      * @brief Dispatches every queued event. Call from the UI thread.
+      *
+      * Each event is delivered to the listeners of its target item and that item's ancestors, in
+      * bubbling order, stopping once one calls ZEvent::accept(). Subscribers for the event's type
+      * are notified afterwards regardless. Listeners use ZEvent::as() to reach the payload.
+      */
      void dispatchEvents();
-     void registerListener(ZGraphicsItem* item, std::function<void(const ZEvent&)> callback);
- 
+
+     /**
+      * @brief Sets the scene used to find the item under the pointer.
+      * @param scene The scene to hit-test, or nullptr to route pointer events to subscribers only.
+      */
+     void setScene(ZGraphicsScene* scene) { scene_ = scene; }
+
+     /**
+      * @brief Adds a listener for events targeted at an item or bubbling through it.
+      *
+      * Called from a listener, it takes effect once the event being dispatched has been delivered.
+      * @param item The item to listen on; nullptr subscribes to every event of every type.
+      * @param callback The function to call.
+      */
+     void registerListener(ZGraphicsItem* item, Listener callback);
+
+     /**
+      * @brief Adds a global listener for one event type, independent of the target item.
+      * @param type The event type to receive.
+      * @param callback The function to call.
+      */
+     void subscribe(ZincX::EventType type, Listener callback);
+
+     /**
+      * @brief Drops an item's listeners and any press or focus state referring to it.
+      *
+      * Call before destroying an item that was registered or could have been pressed or focused.
+      * Called from a listener, the item receives nothing more of the event being dispatched.
+      */
+     void unregisterItem(ZGraphicsItem* item);
+
+     /** @brief Sets the item that receives key events; nullptr sends them to subscribers only. */
+     void setFocusItem(ZGraphicsItem* item) { focusItem_ = item; }
+     ZGraphicsItem* focusItem() const { return focusItem_; }
+
+     /**
+      * @brief Chooses how runs of consecutive events of one type are merged before dispatch.
+      *
+      * MouseMove, MouseDrag and TouchMove default to Coalesce; every other type to KeepAll.
+      *
+      * @param type The event type the policy applies to.
+      * @param policy The merge policy.
+      * @param keep For KeepLatestN, how many of the newest events of a run survive (at least 1).
+      */
+     void setCoalescePolicy(ZincX::EventType type, ZincX::CoalescePolicy policy, std::size_t keep = 1);
+
+     /** @brief Number of events merged away by coalescing so far. */
+     std::size_t coalescedEvents() const { return coalesced_; }
+
+     /**
+      * @brief Sets a hook that wakes the UI loop when events arrive.
+      *
+      * The hook runs on the posting thread, once per batch: after it fires it is not called again
+      * until dispatchEvents() has started draining. Install it before producer threads start.
+      *
+      * @param handler Callback such as a condition-variable notify or a PostMessage; may be empty.
+      */
+     void setWakeHandler(std::function<void()> handler);
+
+     /** @brief Number of events discarded so far because the queue was full. */
+     std::size_t droppedEvents() const;
+
  private:
-     std::queue<std::unique_ptr<ZEvent>> eventQueue_;
-     std::vector<std::pair<ZGraphicsItem*, std::function<void(const ZEvent&)>>> listeners_;
- };
\ No newline at end of file
+     struct Coalescing {
+         ZincX::CoalescePolicy policy = ZincX::CoalescePolicy::KeepAll;
+         std::size_t keep = 1;
+     };
+
+     /** @brief A listener change requested while an event was being dispatched. */
+     struct PendingChange {
+         enum Kind { AddItem, AddType, Unregister } kind;
+         ZGraphicsItem* item;
+         ZincX::EventType type;
+         Listener callback;
+     };
+
+     void dispatch(const ZEvent& event);
+     void applyPending();
+     bool unregistering(ZGraphicsItem* item) const;
+     void endPress();
+     ZGraphicsItem* targetOf(const ZEvent& event) const;
+     void coalesceBatch();
+
+     ZEventQueue<ZEventRecord> eventQueue_;
+     ZGraphicsScene* scene_ = nullptr;
+     ZGraphicsItem* focusItem_ = nullptr;
+     ZGraphicsItem* pressedItem_ = nullptr;   ///< Receives the release that ends the current press.
+     ZincX::WidgetState pressedFrom_ = ZincX::WidgetState::Normal; ///< pressedItem_'s state before the press.
+     std::unordered_map<ZGraphicsItem*, std::vector<Listener>> itemListeners_;
+     std::array<std::vector<Listener>, kEventTypeCount> typeListeners_;
+     std::vector<Listener> anyListeners_;
+     std::array<Coalescing, kEventTypeCount> coalescing_{};
+     std::vector<ZEventRecord> batch_;        ///< Events drained from the queue for one pass.
+     int dispatchDepth_ = 0;                  ///< Listener lists must not change while above 0.
+     std::vector<PendingChange> pending_;     ///< Applied when the outermost dispatch ends.
+     std::size_t coalesced_ = 0;
+     std::function<void()> wakeHandler_;
+ #ifdef ZINCX_THREAD_SAFE
+     std::atomic<bool> wakePending_{false};
+     std::atomic<std::size_t> dropped_{0};
+ #else
+     bool wakePending_ = false;
+     std::size_t dropped_ = 0;
+ #endif
+ };
@@ -0,0 +1,133 @@
+/**
+ * @file ZEventQueue.h
+ * @brief Defines the bounded event ring used by ZEventManager in the ZincX event subsystem.
+ *
+ * This file contains ZEventQueue, a fixed-capacity FIFO with many producers and one consumer.
+ * With ZINCX_THREAD_SAFE it is a lock-free ring in the style of Dmitry Vyukov's bounded queue:
+ * each slot carries a sequence number, producers claim a slot with one compare-and-swap on the
+ * tail, and the consumer never touches the tail — so input or network threads can post without
+ * blocking each other or the UI thread. Single-threaded builds (DOS, Win16) compile the same API
+ * down to a plain ring buffer with no atomics.
+ */
+#pragma once
+#include "../common/ZConfig.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#ifdef ZINCX_THREAD_SAFE
+#include <atomic>
+#endif
+
+template <typename T>
+class ZEventQueue {
+public:
+    /**
+     * @brief Constructs an empty queue.
+     * @param capacity Maximum number of queued elements, rounded up to a power of two.
+     */
+    explicit ZEventQueue(std::size_t capacity = ZincX::EVENT_QUEUE_CAPACITY)
+        : mask_(roundUp(capacity) - 1), slots_(new Slot[mask_ + 1]) {
+#ifdef ZINCX_THREAD_SAFE
+        for (std::size_t i = 0; i <= mask_; ++i) slots_[i].sequence.store(i, std::memory_order_relaxed);
+#endif
+    }
+
+    ZEventQueue(const ZEventQueue&) = delete;
+    ZEventQueue& operator=(const ZEventQueue&) = delete;
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+    /**
+     * @brief Appends an element; safe to call from any number of threads concurrently.
+     * @param value The element to move into the queue. Left untouched if the queue is full.
+     * @return False if the queue is full.
+     */
+    bool tryPush(T&& value) {
+#ifdef ZINCX_THREAD_SAFE
+        std::size_t pos = tail_.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots_[pos & mask_];
+            std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false; // the consumer has not freed this slot yet: full
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        slot->value = std::move(value);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+#else
+        if (tail_ - head_ > mask_) return false;
+        slots_[tail_++ & mask_].value = std::move(value);
+#endif
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest element; must only be called from the consuming thread.
+     * @param out Receives the element.
+     * @return False if the queue is empty.
+     */
+    bool tryPop(T& out) {
+#ifdef ZINCX_THREAD_SAFE
+        std::size_t pos = head_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[pos & mask_];
+        std::size_t seq = slot.sequence.load(std::memory_order_acquire);
+        if (static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1) < 0) return false;
+        out = std::move(slot.value);
+        slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        head_.store(pos + 1, std::memory_order_relaxed);
+#else
+        if (head_ == tail_) return false;
+        out = std::move(slots_[head_++ & mask_].value);
+#endif
+        return true;
+    }
+
+    /** @brief Returns true if nothing is queued; only a hint while producers are active. */
+    bool empty() const { return size() == 0; }
+
+    /** @brief Number of queued elements; only a hint while producers are active. */
+    std::size_t size() const {
+#ifdef ZINCX_THREAD_SAFE
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+#else
+        return tail_ - head_;
+#endif
+    }
+
+private:
+    static std::size_t roundUp(std::size_t n) {
+        std::size_t p = 2;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    struct Slot {
+#ifdef ZINCX_THREAD_SAFE
+        std::atomic<std::size_t> sequence{0};
+#endif
+        T value{};
+    };
+
+    /** Keeps the producer and consumer indices on separate cache lines. */
+    static constexpr std::size_t kCacheLine = 64;
+
+    const std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+#ifdef ZINCX_THREAD_SAFE
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};
+#else
+    std::size_t head_ = 0;
+    std::size_t tail_ = 0;
+#endif
+};
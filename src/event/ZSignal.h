@@ -0,0 +1,501 @@
+/**
+ * @file ZSignal.h
+ * @brief Defines the typed signal/slot mechanism of the ZincX event subsystem.
+ *
+ * This file contains ZSignal, a multi-observer signal templated on its argument types,
+ * ZConnection, the RAII handle that disconnects its slot when destroyed, and ZSlotFunction, the
+ * type-erased callable slots are kept in. A slot whose captures fit in
+ * ZSlotFunction::kInlineBytes (a pointer and a few references, or an object and a member
+ * function) is stored inside the signal's slot vector without a heap allocation, so emit() is a
+ * linear walk over contiguous slots with one indirect call each.
+ *
+ * Slots connected or disconnected while the signal is emitting never reallocate or shift the
+ * vector being walked: a disconnected slot is only marked dead and a new slot waits in a pending
+ * list, and both are settled when the signal's outermost emit returns, or when its next emit
+ * starts. A slot connected during an emit is first called by the next emit.
+ *
+ * With ZINCX_THREAD_SAFE, emits take a std::shared_mutex in shared mode, so several threads can
+ * emit the same signal at once, and connect and disconnect take it exclusively, except inside a
+ * slot, where they defer instead of waiting. A slot that emits its own signal again walks the slots
+ * under the lock its outer emit holds. After disconnect() returns, emits that start later
+ * skip the slot; one already running on another thread may still be calling it. Single-threaded
+ * builds compile the same API without any lock or atomic.
+ */
+#pragma once
+#include "../common/ZConfig.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef ZINCX_THREAD_SAFE
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#endif
+
+template <typename Signature>
+class ZSlotFunction;
+
+/**
+ * @brief A move-only callable with inline storage for small function objects.
+ *
+ * Function objects larger than kInlineBytes, over-aligned, or with a throwing move constructor
+ * are allocated on the heap instead.
+ */
+template <typename... Args>
+class ZSlotFunction<void(Args...)> {
+public:
+    static constexpr std::size_t kInlineBytes = 4 * sizeof(void*);
+
+    ZSlotFunction() = default;
+
+    template <typename F>
+        requires(!std::is_same_v<std::decay_t<F>, ZSlotFunction> && std::is_invocable_v<std::decay_t<F>&, Args&...>)
+    ZSlotFunction(F&& fn) {
+        using Fn = std::decay_t<F>;
+        if constexpr (fitsInline<Fn>) {
+            ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(fn));
+            ops_ = &kInlineOps<Fn>;
+        } else {
+            *reinterpret_cast<Fn**>(storage_) = new Fn(std::forward<F>(fn));
+            ops_ = &kHeapOps<Fn>;
+        }
+    }
+
+    ZSlotFunction(ZSlotFunction&& other) noexcept { take(other); }
+
+    ZSlotFunction& operator=(ZSlotFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    ~ZSlotFunction() { reset(); }
+
+    void reset() {
+        if (ops_) ops_->destroy(storage_);
+        ops_ = nullptr;
+    }
+
+    explicit operator bool() const { return ops_ != nullptr; }
+
+    /** @brief True if the function object lives in the inline buffer. */
+    bool isInline() const { return ops_ && !ops_->heap; }
+
+    void operator()(Args&... args) const { ops_->invoke(storage_, args...); }
+
+private:
+    struct Ops {
+        void (*invoke)(void* object, Args&... args);
+        void (*relocate)(void* to, void* from) noexcept;   ///< Move-constructs into @p to and destroys @p from.
+        void (*destroy)(void* object) noexcept;
+        bool heap;
+    };
+
+    template <typename Fn>
+    static constexpr bool fitsInline = sizeof(Fn) <= kInlineBytes && alignof(Fn) <= alignof(std::max_align_t) &&
+                                       std::is_nothrow_move_constructible_v<Fn>;
+
+    template <typename Fn>
+    static constexpr Ops kInlineOps = {
+        [](void* object, Args&... args) { (*static_cast<Fn*>(object))(args...); },
+        [](void* to, void* from) noexcept {
+            Fn* source = static_cast<Fn*>(from);
+            ::new (to) Fn(std::move(*source));
+            source->~Fn();
+        },
+        [](void* object) noexcept { static_cast<Fn*>(object)->~Fn(); },
+        false
+    };
+
+    template <typename Fn>
+    static constexpr Ops kHeapOps = {
+        [](void* object, Args&... args) { (**static_cast<Fn**>(object))(args...); },
+        [](void* to, void* from) noexcept { *static_cast<Fn**>(to) = *static_cast<Fn**>(from); },
+        [](void* object) noexcept { delete *static_cast<Fn**>(object); },
+        true
+    };
+
+    void take(ZSlotFunction& other) noexcept {
+        if (other.ops_) other.ops_->relocate(storage_, other.storage_);
+        ops_ = std::exchange(other.ops_, nullptr);
+    }
+
+    alignas(std::max_align_t) mutable unsigned char storage_[kInlineBytes];
+    const Ops* ops_ = nullptr;
+};
+
+/** @brief The type-independent part of a signal that ZConnection talks to. */
+class ZSignalBase {
+public:
+    virtual ~ZSignalBase() = default;
+
+protected:
+    friend class ZConnection;
+
+    virtual void disconnectSlot(std::uint64_t id) = 0;
+    virtual bool isSlotConnected(std::uint64_t id) const = 0;
+
+#ifdef ZINCX_THREAD_SAFE
+    /** @brief One emit in progress on the current thread; the frames form a stack. */
+    struct EmitFrame {
+        const ZSignalBase* signal;
+        const EmitFrame* previous;
+    };
+
+    /** @brief True if the current thread is inside a slot of this signal, so holds its lock shared. */
+    bool emittingHere() const {
+        for (const EmitFrame* frame = frames_; frame; frame = frame->previous) {
+            if (frame->signal == this) return true;
+        }
+        return false;
+    }
+
+    static inline thread_local const EmitFrame* frames_ = nullptr;
+#endif
+};
+
+/**
+ * @brief Keeps a slot connected for as long as it lives.
+ *
+ * Destroying or reassigning the connection disconnects the slot; release() keeps it connected
+ * for the signal's lifetime instead. Outliving the signal is safe.
+ */
+class ZConnection {
+public:
+    ZConnection() = default;
+    ~ZConnection() { disconnect(); }
+
+    ZConnection(ZConnection&& other) noexcept : signal_(std::move(other.signal_)), id_(std::exchange(other.id_, 0)) {}
+
+    ZConnection& operator=(ZConnection&& other) noexcept {
+        if (this != &other) {
+            disconnect();
+            signal_ = std::move(other.signal_);
+            id_ = std::exchange(other.id_, 0);
+        }
+        return *this;
+    }
+
+    ZConnection(const ZConnection&) = delete;
+    ZConnection& operator=(const ZConnection&) = delete;
+
+    /** @brief Disconnects the slot; does nothing if it is already disconnected. */
+    void disconnect() {
+        if (auto signal = signal_.lock()) signal->disconnectSlot(id_);
+        signal_.reset();
+        id_ = 0;
+    }
+
+    bool isConnected() const {
+        auto signal = signal_.lock();
+        return signal && signal->isSlotConnected(id_);
+    }
+
+    /** @brief Lets go of the slot without disconnecting it. */
+    void release() {
+        signal_.reset();
+        id_ = 0;
+    }
+
+private:
+    template <typename... Args>
+    friend class ZSignal;
+
+    ZConnection(std::weak_ptr<ZSignalBase> signal, std::uint64_t id) : signal_(std::move(signal)), id_(id) {}
+
+    std::weak_ptr<ZSignalBase> signal_;
+    std::uint64_t id_ = 0;
+};
+
+template <typename... Args>
+class ZSignal : public ZSignalBase {
+public:
+    using Slot = ZSlotFunction<void(Args...)>;
+
+    ZSignal() : self_(this, [](ZSignalBase*) {}) {}
+
+    ZSignal(const ZSignal&) = delete;
+    ZSignal& operator=(const ZSignal&) = delete;
+
+    /**
+     * @brief Connects a callable invoked with the emitted arguments.
+     * @return The connection; discarding it disconnects the slot again.
+     */
+    template <typename F>
+    [[nodiscard]] ZConnection connect(F&& slot) {
+        return ZConnection(self_, add(Slot(std::forward<F>(slot))));
+    }
+
+    /** @brief Connects a member function of an object that must outlive the connection. */
+    template <typename T>
+    [[nodiscard]] ZConnection connect(T* object, void (T::*method)(Args...)) {
+        return connect([object, method](Args&... args) { (object->*method)(args...); });
+    }
+
+    /** @brief Calls every connected slot in connection order. */
+    void emit(Args... args) {
+#ifdef ZINCX_THREAD_SAFE
+        // A re-emit from one of this signal's slots already holds the lock shared; taking it again
+        // on the same thread is undefined, and deadlocks behind a waiting writer.
+        const bool outermost = !emittingHere();
+        const EmitFrame frame{ this, frames_ };
+        if (outermost && dirty_.load(std::memory_order_acquire)) settleOutermost();
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_, std::defer_lock);
+            if (outermost) lock.lock();
+            struct Scope {
+                explicit Scope(const EmitFrame* f) { frames_ = f; }
+                ~Scope() { frames_ = frames_->previous; }
+            } scope(&frame);
+            for (const Entry& entry : slots_) {
+                if (entry.alive.load(std::memory_order_acquire)) entry.slot(args...);
+            }
+        }
+        if (outermost && dirty_.load(std::memory_order_acquire)) settleOutermost();
+#else
+        struct Scope {
+            explicit Scope(ZSignal& s) : signal(s) { ++signal.depth_; }
+            ~Scope() {
+                if (--signal.depth_ == 0 && signal.dirty_) signal.settle();
+            }
+            ZSignal& signal;
+        } scope(*this);
+        // Indexing, not iterators: a slot may disconnect others, which only marks them dead.
+        const std::size_t count = slots_.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            if (slots_[i].alive) slots_[i].slot(args...);
+        }
+#endif
+    }
+
+    void operator()(Args... args) { emit(args...); }
+
+    /** @brief Disconnects every slot; existing ZConnection objects become inert. */
+    void disconnectAll() {
+#ifdef ZINCX_THREAD_SAFE
+        const bool inSlot = frames_ != nullptr;
+        {
+            std::unique_lock<std::mutex> pending(pendingMutex_);
+            pending_.clear();
+        }
+        auto markAll = [this] {
+            for (Entry& entry : slots_) entry.alive.store(false, std::memory_order_release);
+        };
+        if (emittingHere()) {
+            markAll();
+        } else {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            markAll();
+        }
+        dirty_.store(true, std::memory_order_release);
+        if (!inSlot) settle();
+#else
+        pending_.clear();
+        for (Entry& entry : slots_) entry.alive = false;
+        dirty_ = true;
+        if (depth_ == 0) settle();
+#endif
+    }
+
+    /** @brief Number of connected slots, including ones that have not been called yet. */
+    std::size_t slotCount() const {
+        auto count = [this] {
+            std::size_t live = 0;
+            for (const Entry& entry : slots_) live += entry.isAlive();
+            return live;
+        };
+#ifdef ZINCX_THREAD_SAFE
+        std::size_t live = 0;
+        if (emittingHere()) {
+            live = count();
+        } else {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            live = count();
+        }
+        std::unique_lock<std::mutex> pending(pendingMutex_);
+        return live + pending_.size();
+#else
+        return count() + pending_.size();
+#endif
+    }
+
+    bool empty() const { return slotCount() == 0; }
+
+private:
+    struct Entry {
+        Entry(std::uint64_t id, Slot&& slot) : id(id), slot(std::move(slot)) {}
+
+#ifdef ZINCX_THREAD_SAFE
+        Entry(Entry&& other) noexcept
+            : id(other.id), slot(std::move(other.slot)), alive(other.alive.load(std::memory_order_relaxed)) {}
+        Entry& operator=(Entry&& other) noexcept {
+            id = other.id;
+            slot = std::move(other.slot);
+            alive.store(other.alive.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+
+        bool isAlive() const { return alive.load(std::memory_order_acquire); }
+#else
+        bool isAlive() const { return alive; }
+#endif
+
+        std::uint64_t id;
+        Slot slot;
+#ifdef ZINCX_THREAD_SAFE
+        std::atomic<bool> alive{ true };
+#else
+        bool alive = true;
+#endif
+    };
+
+    /** @brief Ids only grow and pending slots are appended in order, so slots_ stays sorted by id. */
+    template <typename Entries>
+    static auto findEntry(Entries& entries, std::uint64_t id) -> decltype(entries.data()) {
+        auto it = std::lower_bound(entries.begin(), entries.end(), id,
+                                   [](const Entry& entry, std::uint64_t key) { return entry.id < key; });
+        return it != entries.end() && it->id == id ? &*it : nullptr;
+    }
+
+    std::uint64_t add(Slot&& slot) {
+#ifdef ZINCX_THREAD_SAFE
+        const std::uint64_t id = nextId_.fetch_add(1, std::memory_order_relaxed);
+        if (frames_) {
+            // Inside a slot: waiting for the exclusive lock could deadlock, so defer.
+            std::unique_lock<std::mutex> pending(pendingMutex_);
+            pending_.emplace_back(id, std::move(slot));
+            dirty_.store(true, std::memory_order_release);
+        } else {
+            std::unique_lock<std::shared_mutex> lock(mutex_);
+            settleLocked();
+            slots_.emplace_back(id, std::move(slot));
+        }
+#else
+        const std::uint64_t id = nextId_++;
+        if (depth_ > 0) {
+            pending_.emplace_back(id, std::move(slot));
+            dirty_ = true;
+        } else {
+            slots_.emplace_back(id, std::move(slot));
+        }
+#endif
+        return id;
+    }
+
+    void disconnectSlot(std::uint64_t id) override {
+#ifdef ZINCX_THREAD_SAFE
+        const bool inSlot = frames_ != nullptr;
+        bool found = false;
+        auto mark = [&] {
+            if (Entry* entry = findEntry(slots_, id)) {
+                found = entry->alive.exchange(false, std::memory_order_acq_rel);
+            }
+        };
+        if (emittingHere()) {
+            mark();
+        } else {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            mark();
+        }
+        if (found) {
+            dirty_.store(true, std::memory_order_release);
+            if (!inSlot) settle();
+            return;
+        }
+        std::unique_lock<std::mutex> pending(pendingMutex_);
+        if (Entry* entry = findEntry(pending_, id)) pending_.erase(pending_.begin() + (entry - pending_.data()));
+#else
+        if (Entry* entry = findEntry(slots_, id)) {
+            if (!entry->alive) return;
+            entry->alive = false;
+            dirty_ = true;
+            if (depth_ == 0) settle();
+        } else if (Entry* entry = findEntry(pending_, id)) {
+            pending_.erase(pending_.begin() + (entry - pending_.data()));
+        }
+#endif
+    }
+
+    bool isSlotConnected(std::uint64_t id) const override {
+#ifdef ZINCX_THREAD_SAFE
+        bool alive = false;
+        auto look = [&] {
+            const Entry* entry = findEntry(slots_, id);
+            alive = entry && entry->isAlive();
+        };
+        if (emittingHere()) {
+            look();
+        } else {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            look();
+        }
+        if (alive) return true;
+        std::unique_lock<std::mutex> pending(pendingMutex_);
+        return findEntry(pending_, id) != nullptr;
+#else
+        const Entry* entry = findEntry(slots_, id);
+        return entry ? entry->alive : findEntry(pending_, id) != nullptr;
+#endif
+    }
+
+    /** @brief Drops dead slots and appends pending ones; no emit may be walking slots_. */
+    void settleLocked() {
+#ifdef ZINCX_THREAD_SAFE
+        std::unique_lock<std::mutex> pending(pendingMutex_);
+        dirty_.store(false, std::memory_order_relaxed);
+#else
+        dirty_ = false;
+#endif
+        slots_.erase(std::remove_if(slots_.begin(), slots_.end(), [](const Entry& entry) { return !entry.isAlive(); }),
+                     slots_.end());
+        for (Entry& entry : pending_) slots_.push_back(std::move(entry));
+        pending_.clear();
+    }
+
+    void settle() {
+#ifdef ZINCX_THREAD_SAFE
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+#endif
+        settleLocked();
+    }
+
+#ifdef ZINCX_THREAD_SAFE
+    /**
+     * @brief Settles when this signal's outermost emit on the thread begins or ends.
+     *
+     * Inside another signal's slot the thread holds that signal's lock, so waiting here could
+     * deadlock against a thread doing the reverse; the settle is then only tried, and left to a
+     * later emit if another thread is emitting.
+     */
+    void settleOutermost() {
+        if (!frames_) {
+            settle();
+            return;
+        }
+        std::unique_lock<std::shared_mutex> lock(mutex_, std::try_to_lock);
+        if (lock.owns_lock()) settleLocked();
+    }
+#endif
+
+    std::vector<Entry> slots_;
+    std::vector<Entry> pending_;   ///< Connected during an emit; appended by settle().
+#ifdef ZINCX_THREAD_SAFE
+    mutable std::shared_mutex mutex_;      ///< Shared by emits, exclusive for changing slots_.
+    mutable std::mutex pendingMutex_;      ///< Guards pending_.
+    std::atomic<std::uint64_t> nextId_{ 1 };
+    std::atomic<bool> dirty_{ false };     ///< Dead or pending slots await settle().
+#else
+    std::uint64_t nextId_ = 1;
+    std::size_t depth_ = 0;                ///< Nesting of emits in progress.
+    bool dirty_ = false;
+#endif
+    std::shared_ptr<ZSignalBase> self_;    ///< Owns nothing; ZConnections watch it to outlive the signal.
+};
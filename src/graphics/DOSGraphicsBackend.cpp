@@ -2,68 +2,418 @@
  * @file DOSGraphicsBackend.cpp
  * @brief Implementation of the DOS-specific graphics backend for the ZincX framework.
  *
- * This file provides the implementation for the DOSGraphicsBackend class, offering rendering
- * functionality for DOS environments using placeholder console output in the ZincX UI framework.
+ * This file provides the implementation for the DOSGraphicsBackend class. Every primitive is
+ * rasterized into a back buffer of packed VGA text cells (character in the low byte, attribute
+ * in the high byte). present() diffs the back buffer against a shadow of text memory and copies
+ * only the changed runs to 0xB800 with movedata() under DJGPP. Host builds keep the shadow
+ * buffer as the "display" so the same code path can be exercised off-target.
  */
  #include "DOSGraphicsBackend.h"
- #include <iostream>
- 
+ #include "ZLayerCache.h"
+ #include <algorithm>
+ #include <cmath>
+ #include <cstdlib>
+
+ #ifdef __DJGPP__
+ #include <dpmi.h>
+ #include <go32.h>
+ #include <sys/movedata.h>
+ #include <sys/segments.h>
+ #endif
+
+ namespace {
+     constexpr std::uint32_t kTextMemory = 0xB8000;
+
+     // CP437 line-drawing glyphs.
+     constexpr std::uint8_t kHorizontal = 0xC4;
+     constexpr std::uint8_t kVertical = 0xB3;
+     constexpr std::uint8_t kTopLeft = 0xDA;
+     constexpr std::uint8_t kTopRight = 0xBF;
+     constexpr std::uint8_t kBottomLeft = 0xC0;
+     constexpr std::uint8_t kBottomRight = 0xD9;
+     constexpr std::uint8_t kFullBlock = 0xDB;
+
+     struct PaletteEntry { int r, g, b; };
+
+     // Default VGA text-mode palette, indexed by attribute nibble.
+     constexpr PaletteEntry kPalette[16] = {
+         {0, 0, 0},       {0, 0, 170},     {0, 170, 0},     {0, 170, 170},
+         {170, 0, 0},     {170, 0, 170},   {170, 85, 0},    {170, 170, 170},
+         {85, 85, 85},    {85, 85, 255},   {85, 255, 85},   {85, 255, 255},
+         {255, 85, 85},   {255, 85, 255},  {255, 255, 85},  {255, 255, 255}
+     };
+
+     constexpr std::uint16_t makeCell(std::uint8_t ch, std::uint8_t attr) {
+         return static_cast<std::uint16_t>(ch | (attr << 8));
+     }
+
+     // NUL on black on black: never produced by rasterizing, so it marks layer cells left untouched.
+     constexpr std::uint16_t kTransparentCell = 0;
+ }
+
+ DOSGraphicsBackend::DOSGraphicsBackend(int columns, int rows)
+     : columns_(columns), rows_(rows), clip_{0, 0, columns, rows},
+       back_(static_cast<std::size_t>(columns * rows), makeCell(' ', 0x07)),
+       front_(static_cast<std::size_t>(columns * rows)) {
+     invalidateScreen();
+ }
+
  void DOSGraphicsBackend::initialize(ZincX::RenderMode mode) {
-     std::cout << "DOS Graphics Backend Initialized with mode: ";
-     switch (mode) {
-         case ZincX::RenderMode::Text: std::cout << "Text\n"; break;
-         case ZincX::RenderMode::Graphics16: std::cout << "Graphics16\n"; break;
-         case ZincX::RenderMode::Vulkan: std::cout << "Vulkan (not supported on DOS)\n"; break;
-     }
- }
- 
- void DOSGraphicsBackend::fillRect(const ZRect& rect, const ZColor& color) {
-     std::cout << "Filling rect at " << rect.x << "," << rect.y << " with size "
-               << rect.width << "x" << rect.height << " and color ("
-               << color.r << "," << color.g << "," << color.b << ")\n";
- }
- 
- void DOSGraphicsBackend::drawRect(const ZRect& rect, const ZColor& color) {
-     std::cout << "Drawing rect outline at " << rect.x << "," << rect.y << " with size "
-               << rect.width << "x" << rect.height << " and color ("
-               << color.r << "," << color.g << "," << color.b << ")\n";
- }
- 
- void DOSGraphicsBackend::drawLine(const ZPoint& start, const ZPoint& end, const ZColor& color) {
-     std::cout << "Drawing line from (" << start.x << "," << start.y << ") to ("
-               << end.x << "," << end.y << ") with color ("
-               << color.r << "," << color.g << "," << color.b << ")\n";
- }
- 
- void DOSGraphicsBackend::drawCircle(const ZPoint& center, int radius, const ZColor& color, bool filled) {
-     std::cout << "Drawing " << (filled ? "filled " : "") << "circle at ("
-               << center.x << "," << center.y << ") with radius " << radius
-               << " and color (" << color.r << "," << color.g << "," << color.b << ")\n";
- }
- 
- void DOSGraphicsBackend::drawEllipse(const ZPoint& center, int width, int height, const ZColor& color, bool filled) {
-     std::cout << "Drawing " << (filled ? "filled " : "") << "ellipse at ("
-               << center.x << "," << center.y << ") with size " << width << "x" << height
-               << " and color (" << color.r << "," << color.g << "," << color.b << ")\n";
- }
- 
- void DOSGraphicsBackend::drawPolygon(const std::vector<ZPoint>& points, const ZColor& color, bool filled) {
-     std::cout << "Drawing " << (filled ? "filled " : "") << "polygon with " << points.size() << " points and color ("
-               << color.r << "," << color.g << "," << color.b << ")\n";
-     for (const auto& point : points) {
-         std::cout << "Point: (" << point.x << "," << point.y << ") ";
-     }
-     std::cout << "\n";
- }
- 
- void DOSGraphicsBackend::drawText(const std::string& text, const ZRect& bounds, const ZColor& color, ZincX::TextAlignment alignment) {
-     std::cout << "Drawing text '" << text << "' at bounds " << bounds.x << "," << bounds.y << " with size "
-               << bounds.width << "x" << bounds.height << " and color ("
-               << color.r << "," << color.g << "," << color.b << ") aligned ";
-     switch (alignment) {
-         case ZincX::TextAlignment::Left: std::cout << "Left\n"; break;
-         case ZincX::TextAlignment::Center: std::cout << "Center\n"; break;
-         case ZincX::TextAlignment::Right: std::cout << "Right\n"; break;
-         case ZincX::TextAlignment::Justified: std::cout << "Justified\n"; break;
-     }
- }
\ No newline at end of file
+     if (mode != ZincX::RenderMode::Text) {
+         throw ZincX::ZException("DOSGraphicsBackend only supports RenderMode::Text");
+     }
+ #ifdef __DJGPP__
+     __dpmi_regs regs{};
+     regs.x.ax = 0x0003; // 80x25 color text
+     __dpmi_int(0x10, &regs);
+     if (rows_ == 50) {
+         regs = {};
+         regs.x.ax = 0x1112; // load 8x8 ROM font -> 50 rows on VGA
+         regs.h.bl = 0;
+         __dpmi_int(0x10, &regs);
+     }
+     regs = {};
+     regs.x.ax = 0x1003; // attribute bit 7 selects bright background instead of blink
+     regs.h.bl = 0;
+     __dpmi_int(0x10, &regs);
+     regs = {};
+     regs.h.ah = 0x01;   // hide the hardware cursor
+     regs.x.cx = 0x2000;
+     __dpmi_int(0x10, &regs);
+ #endif
+     invalidateScreen();
+ }
+
+ void DOSGraphicsBackend::setClipRect(const ZincX::ZRect& clip) {
+     clip_ = clip.intersected({0, 0, columns_, rows_});
+ }
+
+ void DOSGraphicsBackend::invalidateScreen() {
+     // 0xFFFF never matches a rasterized cell, so the next present() copies everything.
+     std::fill(front_.begin(), front_.end(), static_cast<std::uint16_t>(0xFFFF));
+ }
+
+ std::uint8_t DOSGraphicsBackend::paletteIndex(const ZincX::ZColor& color) {
+     std::uint8_t best = 0;
+     int bestDistance = 0x7FFFFFFF;
+     for (std::uint8_t i = 0; i < 16; ++i) {
+         int dr = color.r - kPalette[i].r;
+         int dg = color.g - kPalette[i].g;
+         int db = color.b - kPalette[i].b;
+         int d = dr * dr + dg * dg + db * db;
+         if (d < bestDistance) {
+             bestDistance = d;
+             best = i;
+         }
+     }
+     return best;
+ }
+
+ void DOSGraphicsBackend::putCell(int x, int y, std::uint8_t ch, std::uint8_t fg) {
+     if (!clip_.contains(ZincX::ZPoint{x, y})) return;
+     std::uint16_t& cell = back_[y * columns_ + x];
+     std::uint8_t attr = static_cast<std::uint8_t>(((cell >> 8) & 0xF0) | fg);
+     cell = makeCell(ch, attr);
+ }
+
+ void DOSGraphicsBackend::fillCells(int x0, int x1, int y, std::uint8_t bg) {
+     if (y < clip_.y || y >= clip_.y + clip_.height) return;
+     x0 = std::max(x0, clip_.x);
+     x1 = std::min(x1, clip_.x + clip_.width - 1);
+     std::uint16_t* row = &back_[y * columns_];
+     for (int x = x0; x <= x1; ++x) {
+         std::uint8_t attr = static_cast<std::uint8_t>((bg << 4) | ((row[x] >> 8) & 0x0F));
+         row[x] = makeCell(' ', attr);
+     }
+ }
+
+ void DOSGraphicsBackend::rasterFill(const ZincX::ZRect& rect, std::uint8_t bg) {
+     for (int y = rect.y; y < rect.y + rect.height; ++y) {
+         fillCells(rect.x, rect.x + rect.width - 1, y, bg);
+     }
+ }
+
+ void DOSGraphicsBackend::rasterFrame(const ZincX::ZRect& rect, std::uint8_t fg) {
+     if (rect.width <= 0 || rect.height <= 0) return;
+     int right = rect.x + rect.width - 1;
+     int bottom = rect.y + rect.height - 1;
+     for (int x = rect.x + 1; x < right; ++x) {
+         putCell(x, rect.y, kHorizontal, fg);
+         putCell(x, bottom, kHorizontal, fg);
+     }
+     for (int y = rect.y + 1; y < bottom; ++y) {
+         putCell(rect.x, y, kVertical, fg);
+         putCell(right, y, kVertical, fg);
+     }
+     putCell(rect.x, rect.y, kTopLeft, fg);
+     putCell(right, rect.y, kTopRight, fg);
+     putCell(rect.x, bottom, kBottomLeft, fg);
+     putCell(right, bottom, kBottomRight, fg);
+ }
+
+ void DOSGraphicsBackend::rasterLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, std::uint8_t fg) {
+     int dx = std::abs(end.x - start.x);
+     int dy = -std::abs(end.y - start.y);
+     int sx = start.x < end.x ? 1 : -1;
+     int sy = start.y < end.y ? 1 : -1;
+     std::uint8_t glyph = dy == 0 ? kHorizontal
+                        : dx == 0 ? kVertical
+                        : (sx == sy ? '\\' : '/');
+     int err = dx + dy;
+     int x = start.x, y = start.y;
+     for (;;) {
+         putCell(x, y, glyph, fg);
+         if (x == end.x && y == end.y) break;
+         int e2 = 2 * err;
+         if (e2 >= dy) { err += dy; x += sx; }
+         if (e2 <= dx) { err += dx; y += sy; }
+     }
+ }
+
+ void DOSGraphicsBackend::rasterEllipse(const ZincX::ZPoint& center, int width, int height, std::uint8_t index, bool filled) {
+     int a = width / 2;
+     int b = height / 2;
+     if (a < 0 || b < 0) return;
+     auto halfWidth = [a, b](int dy) {
+         if (b == 0) return a;
+         double t = static_cast<double>(dy) / b;
+         return static_cast<int>(std::lround(a * std::sqrt(std::max(0.0, 1.0 - t * t))));
+     };
+     for (int dy = -b; dy <= b; ++dy) {
+         int hw = halfWidth(dy);
+         int y = center.y + dy;
+         if (filled) {
+             fillCells(center.x - hw, center.x + hw, y, index);
+             continue;
+         }
+         // Plot from this row's edge inward to the next row's edge so steep parts stay closed.
+         int inner = std::abs(dy) == b ? 0 : halfWidth(std::abs(dy) + 1);
+         for (int x = inner; x <= hw; ++x) {
+             putCell(center.x - x, y, kFullBlock, index);
+             putCell(center.x + x, y, kFullBlock, index);
+         }
+     }
+ }
+
+ void DOSGraphicsBackend::rasterPolygon(const ZincX::ZPoint* points, std::size_t count, std::uint8_t index, bool filled) {
+     if (count == 0) return;
+     if (!filled) {
+         for (std::size_t i = 0; i < count; ++i) {
+             rasterLine(points[i], points[(i + 1) % count], index);
+         }
+         return;
+     }
+     auto [minIt, maxIt] = std::minmax_element(points, points + count,
+         [](const ZincX::ZPoint& l, const ZincX::ZPoint& r) { return l.y < r.y; });
+     for (int y = std::max(minIt->y, clip_.y); y < std::min(maxIt->y + 1, clip_.y + clip_.height); ++y) {
+         // Even-odd scanline through the cell centers.
+         double sy = y + 0.5;
+         crossings_.clear();
+         for (std::size_t i = 0, j = count - 1; i < count; j = i++) {
+             const ZincX::ZPoint& p = points[i];
+             const ZincX::ZPoint& q = points[j];
+             if ((p.y <= sy) != (q.y <= sy)) {
+                 crossings_.push_back(p.x + (sy - p.y) * (q.x - p.x) / (q.y - p.y));
+             }
+         }
+         std::sort(crossings_.begin(), crossings_.end());
+         for (std::size_t i = 0; i + 1 < crossings_.size(); i += 2) {
+             int x0 = static_cast<int>(std::ceil(crossings_[i] - 0.5));
+             int x1 = static_cast<int>(std::floor(crossings_[i + 1] - 0.5));
+             fillCells(x0, x1, y, index);
+         }
+     }
+ }
+
+ void DOSGraphicsBackend::rasterText(std::string_view text, const ZincX::ZRect& bounds, std::uint8_t fg, ZincX::TextAlignment alignment) {
+     if (bounds.width <= 0 || bounds.height <= 0) return;
+
+     int lineCount = static_cast<int>(std::count(text.begin(), text.end(), '\n')) + 1;
+     int visibleLines = std::min(lineCount, bounds.height);
+     int y = bounds.y;
+     if (alignment == ZincX::TextAlignment::Center) {
+         y += (bounds.height - visibleLines) / 2;
+     }
+
+     std::size_t begin = 0;
+     for (int i = 0; i < visibleLines; ++i, ++y) {
+         std::size_t end = text.find('\n', begin);
+         std::string_view line = text.substr(begin, end == std::string_view::npos ? std::string_view::npos : end - begin);
+         begin = end + 1;
+
+         int length = std::min(static_cast<int>(line.size()), bounds.width);
+         int x = bounds.x;
+         switch (alignment) {
+             case ZincX::TextAlignment::Left: break;
+             case ZincX::TextAlignment::Center: x += (bounds.width - length) / 2; break;
+             case ZincX::TextAlignment::Right: x += bounds.width - length; break;
+             case ZincX::TextAlignment::Justified: {
+                 int gaps = static_cast<int>(std::count(line.begin(), line.begin() + length, ' '));
+                 bool lastLine = i + 1 == lineCount;
+                 if (!lastLine && gaps > 0 && length < bounds.width) {
+                     // Spread the slack over the word gaps, leftmost gaps taking the remainder.
+                     int slack = bounds.width - length;
+                     int gap = 0;
+                     for (int c = 0; c < length; ++c) {
+                         putCell(x++, y, static_cast<std::uint8_t>(line[c]), fg);
+                         if (line[c] == ' ') {
+                             int extra = slack / gaps + (gap < slack % gaps ? 1 : 0);
+                             for (int e = 0; e < extra; ++e) putCell(x++, y, ' ', fg);
+                             ++gap;
+                         }
+                     }
+                     continue;
+                 }
+                 break;
+             }
+         }
+         for (int c = 0; c < length; ++c) {
+             putCell(x + c, y, static_cast<std::uint8_t>(line[c]), fg);
+         }
+     }
+ }
+
+ void DOSGraphicsBackend::fillRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) {
+     rasterFill(rect, paletteIndex(color));
+ }
+
+ void DOSGraphicsBackend::drawRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) {
+     rasterFrame(rect, paletteIndex(color));
+ }
+
+ void DOSGraphicsBackend::drawLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, const ZincX::ZColor& color) {
+     rasterLine(start, end, paletteIndex(color));
+ }
+
+ void DOSGraphicsBackend::drawCircle(const ZincX::ZPoint& center, int radius, const ZincX::ZColor& color, bool filled) {
+     rasterEllipse(center, radius * 2, radius * 2, paletteIndex(color), filled);
+ }
+
+ void DOSGraphicsBackend::drawEllipse(const ZincX::ZPoint& center, int width, int height, const ZincX::ZColor& color, bool filled) {
+     rasterEllipse(center, width, height, paletteIndex(color), filled);
+ }
+
+ void DOSGraphicsBackend::drawPolygon(const std::vector<ZincX::ZPoint>& points, const ZincX::ZColor& color, bool filled) {
+     rasterPolygon(points.data(), points.size(), paletteIndex(color), filled);
+ }
+
+ void DOSGraphicsBackend::drawText(const std::string& text, const ZincX::ZRect& bounds, const ZincX::ZColor& color, ZincX::TextAlignment alignment) {
+     rasterText(text, bounds, paletteIndex(color), alignment);
+ }
+
+ void DOSGraphicsBackend::drawLayer(ZLayerCache& layer, const ZincX::ZPoint& at) {
+     const ZincX::ZRect& area = layer.area();
+     if (area.isEmpty()) return;
+     ZLayerCache::Raster<std::uint16_t>& raster = layer.cells();
+     if (raster.generation != layer.generation()) rasterLayer(layer);
+     ZincX::ZRect target = ZincX::ZRect{ at.x, at.y, area.width, area.height }.intersected(clip_);
+     for (int y = target.y; y < target.y + target.height; ++y) {
+         const std::uint16_t* src = &raster.data[static_cast<std::size_t>((y - at.y) * area.width + (target.x - at.x))];
+         std::uint16_t* dst = &back_[y * columns_ + target.x];
+         if (raster.opaque) {
+             std::copy_n(src, target.width, dst);
+             continue;
+         }
+         for (int x = 0; x < target.width; ++x) {
+             if (src[x] != kTransparentCell) dst[x] = src[x];
+         }
+     }
+ }
+
+ void DOSGraphicsBackend::rasterLayer(ZLayerCache& layer) {
+     const ZincX::ZRect& area = layer.area();
+     ZLayerCache::Raster<std::uint16_t>& raster = layer.cells();
+     raster.data.assign(static_cast<std::size_t>(area.width) * static_cast<std::size_t>(area.height), kTransparentCell);
+
+     // Rasterize with the back buffer swapped for the layer's cells.
+     ZDrawList local;
+     local.append(layer.commands(), ZincX::ZMatrix::translation(static_cast<float>(-area.x), static_cast<float>(-area.y)));
+     const int columns = columns_;
+     const int rows = rows_;
+     const ZincX::ZRect clip = clip_;
+     auto restore = [&] {
+         back_.swap(raster.data);
+         columns_ = columns;
+         rows_ = rows;
+         clip_ = clip;
+     };
+     back_.swap(raster.data);
+     columns_ = area.width;
+     rows_ = area.height;
+     clip_ = { 0, 0, area.width, area.height };
+     try {
+         submit(local);
+     } catch (...) {
+         restore();
+         throw;
+     }
+     restore();
+     raster.opaque = std::find(raster.data.begin(), raster.data.end(), kTransparentCell) == raster.data.end();
+     raster.generation = layer.generation();
+ }
+
+ void DOSGraphicsBackend::submit(const ZDrawList& commands) {
+     // Lists arrive sorted by color, so the palette lookup is usually reused across commands.
+     ZincX::ZColor32 lastColor(0u);
+     std::uint8_t index = 0;
+     bool haveColor = false;
+     for (const ZDrawCommand& cmd : commands.commands()) {
+         if (cmd.op == ZDrawOp::SetClip) {
+             setClipRect(cmd.rect);
+             continue;
+         }
+         if (!haveColor || cmd.color != lastColor) {
+             index = paletteIndex(cmd.color);
+             lastColor = cmd.color;
+             haveColor = true;
+         }
+         const ZincX::ZRect& r = cmd.rect;
+         switch (cmd.op) {
+             case ZDrawOp::SetClip: break;
+             case ZDrawOp::FillRect: rasterFill(r, index); break;
+             case ZDrawOp::DrawRect: rasterFrame(r, index); break;
+             case ZDrawOp::DrawLine: rasterLine({ r.x, r.y }, { r.width, r.height }, index); break;
+             case ZDrawOp::DrawCircle: rasterEllipse({ r.x, r.y }, r.width * 2, r.width * 2, index, cmd.filled != 0); break;
+             case ZDrawOp::DrawEllipse: rasterEllipse({ r.x, r.y }, r.width, r.height, index, cmd.filled != 0); break;
+             case ZDrawOp::DrawPolygon: rasterPolygon(commands.points(cmd), cmd.count, index, cmd.filled != 0); break;
+             case ZDrawOp::DrawText: rasterText(commands.text(cmd), r, index, cmd.alignment()); break;
+             case ZDrawOp::DrawLayer: drawLayer(commands.layer(cmd), { r.x, r.y }); break;
+         }
+     }
+ }
+
+ void DOSGraphicsBackend::copyRun(int start, int count) {
+     std::copy_n(back_.begin() + start, count, front_.begin() + start);
+ #ifdef __DJGPP__
+     movedata(_my_ds(), reinterpret_cast<unsigned>(&back_[start]),
+              _dos_ds, kTextMemory + static_cast<unsigned>(start) * 2,
+              static_cast<std::size_t>(count) * 2);
+ #else
+     (void)kTextMemory;
+ #endif
+     lastPresentBytes_ += static_cast<std::size_t>(count) * 2;
+ }
+
+ void DOSGraphicsBackend::present() {
+     lastPresentBytes_ = 0;
+     const int cells = columns_ * rows_;
+     int i = 0;
+     while (i < cells) {
+         if (back_[i] == front_[i]) {
+             ++i;
+             continue;
+         }
+         int end = i + 1;
+         int gap = 0;
+         for (int j = end; j < cells && gap < kRunMergeGap; ++j) {
+             if (back_[j] != front_[j]) {
+                 end = j + 1;
+                 gap = 0;
+             } else {
+                 ++gap;
+             }
+         }
+         copyRun(i, end - i);
+         i = end;
+     }
+ }
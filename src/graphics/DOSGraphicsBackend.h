@@ -0,0 +1,92 @@
+/**
+ * @file DOSGraphicsBackend.h
+ * @brief Defines the DOS-specific graphics backend for the ZincX framework.
+ *
+ * This file contains the DOSGraphicsBackend class, implementing the IZGraphicsBackend interface
+ * to provide rendering capabilities tailored for DOS environments in the ZincX UI framework.
+ * Primitives are rasterized into an off-screen character/attribute buffer laid out exactly like
+ * VGA text memory; present() copies only the cells that changed since the previous frame.
+ */
+ #pragma once
+ #include "IZGraphicsBackend.h"
+ #include <cstddef>
+ #include <cstdint>
+ #include <string_view>
+
+ class DOSGraphicsBackend : public IZGraphicsBackend {
+ public:
+     /**
+      * @brief Constructs a text-mode backend.
+      * @param columns Number of text columns, 80 on standard VGA.
+      * @param rows Number of text rows; 25 (8x16 font) or 50 (8x8 font).
+      */
+     explicit DOSGraphicsBackend(int columns = 80, int rows = 25);
+
+     void initialize(ZincX::RenderMode mode) override;
+     ZincX::ZSize surfaceSize() const override { return { columns_, rows_ }; }
+     void setClipRect(const ZincX::ZRect& clip) override;
+     void fillRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) override;
+     void drawRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) override;
+     void drawLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, const ZincX::ZColor& color) override;
+     void drawCircle(const ZincX::ZPoint& center, int radius, const ZincX::ZColor& color, bool filled = true) override;
+     void drawEllipse(const ZincX::ZPoint& center, int width, int height, const ZincX::ZColor& color, bool filled = true) override;
+     void drawPolygon(const std::vector<ZincX::ZPoint>& points, const ZincX::ZColor& color, bool filled = true) override;
+     void drawText(const std::string& text, const ZincX::ZRect& bounds, const ZincX::ZColor& color, ZincX::TextAlignment alignment = ZincX::TextAlignment::Center) override;
+
+     /**
+      * @brief Copies the layer's cell raster, rendering it first if the layer was recorded again.
+      *
+      * Cells the layer never wrote are left showing what is beneath; written cells replace the
+      * screen cell whole, so text in a layer takes its background from the layer.
+      */
+     void drawLayer(ZLayerCache& layer, const ZincX::ZPoint& at) override;
+
+     /** @brief Rasterizes a recorded frame without per-primitive virtual dispatch. */
+     void submit(const ZDrawList& commands) override;
+
+     /**
+      * @brief Copies every changed cell run from the back buffer into text memory at 0xB800.
+      *
+      * Runs separated by fewer than kRunMergeGap unchanged cells are merged so that a frame with
+      * scattered edits still costs only a handful of block copies.
+      */
+     void present() override;
+
+     /** @brief Forces the next present() to copy the whole screen (e.g. after a mode switch). */
+     void invalidateScreen();
+
+     int columns() const { return columns_; }
+     int rows() const { return rows_; }
+
+     /** @brief Returns the packed cell (character | attribute << 8) last copied to the display. */
+     std::uint16_t displayedCell(int column, int row) const { return front_[row * columns_ + column]; }
+
+     /** @brief Number of bytes copied to text memory by the last present() call. */
+     std::size_t lastPresentBytes() const { return lastPresentBytes_; }
+
+     /** @brief Maps an RGB color to the nearest entry of the 16-color VGA text palette. */
+     static std::uint8_t paletteIndex(const ZincX::ZColor& color);
+
+ private:
+     static constexpr int kRunMergeGap = 4;
+
+     void putCell(int x, int y, std::uint8_t ch, std::uint8_t fg);
+     void fillCells(int x0, int x1, int y, std::uint8_t bg);
+     void copyRun(int start, int count);
+
+     void rasterFill(const ZincX::ZRect& rect, std::uint8_t bg);
+     void rasterFrame(const ZincX::ZRect& rect, std::uint8_t fg);
+     void rasterLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, std::uint8_t fg);
+     void rasterEllipse(const ZincX::ZPoint& center, int width, int height, std::uint8_t index, bool filled);
+     void rasterPolygon(const ZincX::ZPoint* points, std::size_t count, std::uint8_t index, bool filled);
+     void rasterText(std::string_view text, const ZincX::ZRect& bounds, std::uint8_t fg, ZincX::TextAlignment alignment);
+     void rasterLayer(ZLayerCache& layer);
+
+     int columns_;
+     int rows_;
+     ZincX::ZRect clip_;
+     std::vector<std::uint16_t> back_;  ///< Frame being rasterized.
+     std::vector<std::uint16_t> front_; ///< Shadow copy of what text memory currently holds.
+     std::size_t lastPresentBytes_ = 0;
+     std::vector<double> crossings_;    ///< Scanline scratch for polygon fills.
+ };
@@ -1,21 +1,69 @@
 /**
- * @file DOSGraphicsBackend.h
- * @brief Defines the DOS-specific graphics backend for the ZincX framework.
+ * @file IZGraphicsBackend.h
+ * @brief Defines the abstract rendering backend interface for the ZincX graphics subsystem.
  *
- * This file contains the DOSGraphicsBackend class, implementing the IZGraphicsBackend interface
- * to provide rendering capabilities tailored for DOS environments in the ZincX UI framework.
+ * This file contains the IZGraphicsBackend interface that every rendering backend (DOS text,
+ * 16-bit graphics, Vulkan) implements. ZGraphicsItem only ever talks to this interface, keeping
+ * drawing code independent of the platform it runs on; ZGraphicsView<> does too, while
+ * ZGraphicsView<Backend> calls one backend's overrides directly on single-backend builds.
  */
- #pragma once
- #include "IZGraphicsBackend.h"
- 
- class DOSGraphicsBackend : public IZGraphicsBackend {
- public:
-     void initialize(ZincX::RenderMode mode) override;
-     void fillRect(const ZRect& rect, const ZColor& color) override;
-     void drawRect(const ZRect& rect, const ZColor& color) override;
-     void drawLine(const ZPoint& start, const ZPoint& end, const ZColor& color) override;
-     void drawCircle(const ZPoint& center, int radius, const ZColor& color, bool filled = true) override;
-     void drawEllipse(const ZPoint& center, int width, int height, const ZColor& color, bool filled = true) override;
-     void drawPolygon(const std::vector<ZPoint>& points, const ZColor& color, bool filled = true) override;
-     void drawText(const std::string& text, const ZRect& bounds, const ZColor& color, ZincX::TextAlignment alignment = ZincX::TextAlignment::Center) override;
- };
\ No newline at end of file
+#pragma once
+#include "../common/ZCommon.h"
+#include "../common/ZCommonEnums.h"
+#include "ZDrawList.h"
+#include <string>
+#include <vector>
+
+class ZLayerCache;
+
+class IZGraphicsBackend {
+public:
+    virtual ~IZGraphicsBackend() = default;
+
+    virtual void initialize(ZincX::RenderMode mode) = 0;
+
+    /** @brief Returns the drawable area in backend units (text cells or pixels). */
+    virtual ZincX::ZSize surfaceSize() const = 0;
+
+    /**
+     * @brief Restricts all following primitives to the given rectangle.
+     *
+     * ZGraphicsView sets the clip to each damaged rectangle before redrawing the items under it,
+     * so backends must honor it for partial redraws to be correct.
+     */
+    virtual void setClipRect(const ZincX::ZRect& clip) = 0;
+
+    virtual void fillRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) = 0;
+    virtual void drawRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) = 0;
+    virtual void drawLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, const ZincX::ZColor& color) = 0;
+    virtual void drawCircle(const ZincX::ZPoint& center, int radius, const ZincX::ZColor& color, bool filled = true) = 0;
+    virtual void drawEllipse(const ZincX::ZPoint& center, int width, int height, const ZincX::ZColor& color, bool filled = true) = 0;
+    virtual void drawPolygon(const std::vector<ZincX::ZPoint>& points, const ZincX::ZColor& color, bool filled = true) = 0;
+    virtual void drawText(const std::string& text, const ZincX::ZRect& bounds, const ZincX::ZColor& color, ZincX::TextAlignment alignment = ZincX::TextAlignment::Center) = 0;
+
+    /**
+     * @brief Draws a cached layer with the top-left of its area at a point.
+     *
+     * The default replays the layer's recorded commands. Backends that keep a raster copy in the
+     * layer render it on first use, or after the layer was recorded again, and then only copy it.
+     */
+    virtual void drawLayer(ZLayerCache& layer, const ZincX::ZPoint& at);
+
+    /**
+     * @brief Makes everything drawn since the last call visible.
+     *
+     * Backends that rasterize into an off-screen buffer override this to flush it to the display.
+     * Immediate-mode backends can keep the default no-op.
+     */
+    virtual void present() {}
+
+    /**
+     * @brief Executes a whole frame's worth of recorded commands.
+     *
+     * The default replays each command through the virtual primitives above. Backends override
+     * it to consume the list directly, paying no per-primitive dispatch.
+     *
+     * @param commands The commands to draw, in order.
+     */
+    virtual void submit(const ZDrawList& commands) { commands.replay(*this); }
+};
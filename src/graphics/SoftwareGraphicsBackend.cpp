@@ -0,0 +1,333 @@
+/**
+ * @file SoftwareGraphicsBackend.cpp
+ * @brief Implementation of the CPU software-raster graphics backend for the ZincX framework.
+ *
+ * This file provides the implementation for the SoftwareGraphicsBackend class. Filled shapes are
+ * scan-converted row by row and each row is handed to ZRasterKernels::fill() or blend() as one
+ * span; only outlines fall back to per-pixel plotting. Text uses a built-in 5x7 ASCII font drawn
+ * into 6x8 cells so the backend has no font or file dependencies; its glyphs are rasterized into
+ * the atlas on first use and every string after that is a list of clipped mask blits.
+ */
+#include "SoftwareGraphicsBackend.h"
+#include "ZLayerCache.h"
+#include "ZRasterKernels.h"
+#include "../common/ZConfig.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+    // 5x7 glyphs for ASCII 0x20-0x7E, one byte per column, bit 0 = top row.
+    constexpr std::uint8_t kFont5x7[95][5] = {
+        {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00}, {0x00, 0x07, 0x00, 0x07, 0x00},
+        {0x14, 0x7F, 0x14, 0x7F, 0x14}, {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62},
+        {0x36, 0x49, 0x55, 0x22, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00}, {0x00, 0x1C, 0x22, 0x41, 0x00},
+        {0x00, 0x41, 0x22, 0x1C, 0x00}, {0x08, 0x2A, 0x1C, 0x2A, 0x08}, {0x08, 0x08, 0x3E, 0x08, 0x08},
+        {0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, {0x00, 0x60, 0x60, 0x00, 0x00},
+        {0x20, 0x10, 0x08, 0x04, 0x02}, {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00},
+        {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4B, 0x31}, {0x18, 0x14, 0x12, 0x7F, 0x10},
+        {0x27, 0x45, 0x45, 0x45, 0x39}, {0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03},
+        {0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1E}, {0x00, 0x36, 0x36, 0x00, 0x00},
+        {0x00, 0x56, 0x36, 0x00, 0x00}, {0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14},
+        {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06}, {0x32, 0x49, 0x79, 0x41, 0x3E},
+        {0x7E, 0x11, 0x11, 0x11, 0x7E}, {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22},
+        {0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41}, {0x7F, 0x09, 0x09, 0x09, 0x01},
+        {0x3E, 0x41, 0x49, 0x49, 0x7A}, {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00},
+        {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41}, {0x7F, 0x40, 0x40, 0x40, 0x40},
+        {0x7F, 0x02, 0x0C, 0x02, 0x7F}, {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E},
+        {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, {0x7F, 0x09, 0x19, 0x29, 0x46},
+        {0x46, 0x49, 0x49, 0x49, 0x31}, {0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F},
+        {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F}, {0x63, 0x14, 0x08, 0x14, 0x63},
+        {0x07, 0x08, 0x70, 0x08, 0x07}, {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x00},
+        {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7F, 0x00}, {0x04, 0x02, 0x01, 0x02, 0x04},
+        {0x40, 0x40, 0x40, 0x40, 0x40}, {0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78},
+        {0x7F, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20}, {0x38, 0x44, 0x44, 0x48, 0x7F},
+        {0x38, 0x54, 0x54, 0x54, 0x18}, {0x08, 0x7E, 0x09, 0x01, 0x02}, {0x0C, 0x52, 0x52, 0x52, 0x3E},
+        {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00}, {0x20, 0x40, 0x44, 0x3D, 0x00},
+        {0x7F, 0x10, 0x28, 0x44, 0x00}, {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x18, 0x04, 0x78},
+        {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38}, {0x7C, 0x14, 0x14, 0x14, 0x08},
+        {0x08, 0x14, 0x14, 0x18, 0x7C}, {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20},
+        {0x04, 0x3F, 0x44, 0x40, 0x20}, {0x3C, 0x40, 0x40, 0x20, 0x7C}, {0x1C, 0x20, 0x40, 0x20, 0x1C},
+        {0x3C, 0x40, 0x30, 0x40, 0x3C}, {0x44, 0x28, 0x10, 0x28, 0x44}, {0x0C, 0x50, 0x50, 0x50, 0x3C},
+        {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00}, {0x00, 0x00, 0x7F, 0x00, 0x00},
+        {0x00, 0x41, 0x36, 0x08, 0x00}, {0x08, 0x04, 0x08, 0x10, 0x08}
+    };
+}
+
+SoftwareGraphicsBackend::SoftwareGraphicsBackend(int width, int height)
+    : storage_(static_cast<std::size_t>(std::max(width, 0)) * static_cast<std::size_t>(std::max(height, 0)), ZincX::ZColor32(0xFF000000u)),
+      surface_{ storage_.data(), width, height, width },
+      clip_{ 0, 0, width, height },
+      atlas_(ZincX::GLYPH_ATLAS_SIZE, ZincX::GLYPH_ATLAS_SIZE, &SoftwareGraphicsBackend::builtinGlyph),
+      runs_(ZincX::TEXT_RUN_CACHE_ENTRIES) {}
+
+SoftwareGraphicsBackend::SoftwareGraphicsBackend(const ZincX::ZSurface32& target)
+    : surface_(target), clip_(target.rect()),
+      atlas_(ZincX::GLYPH_ATLAS_SIZE, ZincX::GLYPH_ATLAS_SIZE, &SoftwareGraphicsBackend::builtinGlyph),
+      runs_(ZincX::TEXT_RUN_CACHE_ENTRIES) {}
+
+void SoftwareGraphicsBackend::initialize(ZincX::RenderMode mode) {
+    if (mode != ZincX::RenderMode::Graphics16) {
+        throw ZincX::ZException("SoftwareGraphicsBackend only supports RenderMode::Graphics16");
+    }
+    if (surface_.pixels == nullptr || surface_.width <= 0 || surface_.height <= 0) {
+        throw ZincX::ZException("SoftwareGraphicsBackend has no framebuffer");
+    }
+    clip_ = surface_.rect();
+}
+
+void SoftwareGraphicsBackend::setClipRect(const ZincX::ZRect& clip) {
+    clip_ = clip.intersected(surface_.rect());
+}
+
+void SoftwareGraphicsBackend::span(int x0, int x1, int y, ZincX::ZColor32 color) {
+    if (y < clip_.y || y >= clip_.y + clip_.height) return;
+    x0 = std::max(x0, clip_.x);
+    x1 = std::min(x1, clip_.x + clip_.width - 1);
+    if (x0 > x1) return;
+    ZincX::ZPixelSpan<ZincX::ZColor32> pixels{ surface_.pixel(x0, y), static_cast<std::size_t>(x1 - x0 + 1) };
+    if (color.a() == 255) ZRasterKernels::fill(pixels, color);
+    else if (color.a() != 0) ZRasterKernels::blend(pixels, color);
+}
+
+void SoftwareGraphicsBackend::plot(int x, int y, ZincX::ZColor32 color) {
+    if (!clip_.contains(ZincX::ZPoint{ x, y })) return;
+    ZincX::ZColor32* p = surface_.pixel(x, y);
+    *p = color.a() == 255 ? color : ZRasterKernels::blendPixel(*p, color);
+}
+
+void SoftwareGraphicsBackend::rasterFill(const ZincX::ZRect& rect, ZincX::ZColor32 color) {
+    ZincX::ZRect area = rect.intersected(clip_);
+    if (area.isEmpty()) return;
+    // Contiguous full-width fills collapse into a single span.
+    if (surface_.isContiguous() && area.width == surface_.width && color.a() == 255) {
+        ZRasterKernels::fill({ surface_.pixel(0, area.y), static_cast<std::size_t>(area.area()) }, color);
+        return;
+    }
+    for (int y = area.y; y < area.y + area.height; ++y) {
+        span(area.x, area.x + area.width - 1, y, color);
+    }
+}
+
+void SoftwareGraphicsBackend::rasterFrame(const ZincX::ZRect& rect, ZincX::ZColor32 color) {
+    if (rect.width <= 0 || rect.height <= 0) return;
+    int right = rect.x + rect.width - 1;
+    int bottom = rect.y + rect.height - 1;
+    span(rect.x, right, rect.y, color);
+    if (bottom != rect.y) span(rect.x, right, bottom, color);
+    for (int y = rect.y + 1; y < bottom; ++y) {
+        plot(rect.x, y, color);
+        if (right != rect.x) plot(right, y, color);
+    }
+}
+
+void SoftwareGraphicsBackend::rasterLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, ZincX::ZColor32 color) {
+    if (start.y == end.y) {
+        span(std::min(start.x, end.x), std::max(start.x, end.x), start.y, color);
+        return;
+    }
+    int dx = std::abs(end.x - start.x);
+    int dy = -std::abs(end.y - start.y);
+    int sx = start.x < end.x ? 1 : -1;
+    int sy = start.y < end.y ? 1 : -1;
+    int err = dx + dy;
+    int x = start.x, y = start.y;
+    for (;;) {
+        plot(x, y, color);
+        if (x == end.x && y == end.y) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x += sx; }
+        if (e2 <= dx) { err += dx; y += sy; }
+    }
+}
+
+void SoftwareGraphicsBackend::rasterEllipse(const ZincX::ZPoint& center, int width, int height, ZincX::ZColor32 color, bool filled) {
+    int a = width / 2;
+    int b = height / 2;
+    if (a < 0 || b < 0) return;
+    auto halfWidth = [a, b](int dy) {
+        if (b == 0) return a;
+        double t = static_cast<double>(dy) / b;
+        return static_cast<int>(std::lround(a * std::sqrt(std::max(0.0, 1.0 - t * t))));
+    };
+    for (int dy = -b; dy <= b; ++dy) {
+        int hw = halfWidth(dy);
+        int y = center.y + dy;
+        if (filled) {
+            span(center.x - hw, center.x + hw, y, color);
+            continue;
+        }
+        // Cover from this row's edge inward to the next row's edge so steep parts stay closed.
+        int inner = std::abs(dy) == b ? 0 : std::min(hw, halfWidth(std::abs(dy) + 1));
+        if (inner == 0) {
+            span(center.x - hw, center.x + hw, y, color);
+        } else {
+            span(center.x - hw, center.x - inner, y, color);
+            span(center.x + inner, center.x + hw, y, color);
+        }
+    }
+}
+
+void SoftwareGraphicsBackend::rasterPolygon(const ZincX::ZPoint* points, std::size_t count, ZincX::ZColor32 color, bool filled) {
+    if (count == 0) return;
+    if (!filled) {
+        for (std::size_t i = 0; i < count; ++i) {
+            rasterLine(points[i], points[(i + 1) % count], color);
+        }
+        return;
+    }
+    auto [minIt, maxIt] = std::minmax_element(points, points + count,
+        [](const ZincX::ZPoint& l, const ZincX::ZPoint& r) { return l.y < r.y; });
+    for (int y = std::max(minIt->y, clip_.y); y < std::min(maxIt->y + 1, clip_.y + clip_.height); ++y) {
+        // Even-odd scanline through the pixel centers.
+        double sy = y + 0.5;
+        crossings_.clear();
+        for (std::size_t i = 0, j = count - 1; i < count; j = i++) {
+            const ZincX::ZPoint& p = points[i];
+            const ZincX::ZPoint& q = points[j];
+            if ((p.y <= sy) != (q.y <= sy)) {
+                crossings_.push_back(p.x + (sy - p.y) * (q.x - p.x) / (q.y - p.y));
+            }
+        }
+        std::sort(crossings_.begin(), crossings_.end());
+        for (std::size_t i = 0; i + 1 < crossings_.size(); i += 2) {
+            int x0 = static_cast<int>(std::ceil(crossings_[i] - 0.5));
+            int x1 = static_cast<int>(std::floor(crossings_[i + 1] - 0.5));
+            span(x0, x1, y, color);
+        }
+    }
+}
+
+ZGlyphBitmap SoftwareGraphicsBackend::builtinGlyph(const ZFontKey&, char32_t codepoint) {
+    if (codepoint < 0x20 || codepoint > 0x7E) codepoint = '?';
+    const std::uint8_t* columns = kFont5x7[codepoint - 0x20];
+    ZGlyphBitmap bitmap;
+    bitmap.advance = kGlyphWidth;
+    if (codepoint == ' ') return bitmap;
+    bitmap.width = 5;
+    bitmap.height = 7;
+    bitmap.coverage.resize(5 * 7);
+    for (int row = 0; row < 7; ++row) {
+        for (int c = 0; c < 5; ++c) bitmap.coverage[static_cast<std::size_t>(row * 5 + c)] = (columns[c] >> row) & 1u ? 255 : 0;
+    }
+    return bitmap;
+}
+
+void SoftwareGraphicsBackend::rasterText(std::string_view text, const ZincX::ZRect& bounds, ZincX::ZColor32 color, ZincX::TextAlignment alignment) {
+    if (bounds.width <= 0 || bounds.height <= 0 || color.a() == 0) return;
+
+    const ZTextRun& run = runs_.shape(text, bounds.width, alignment, ZFontKey{ 0, kGlyphHeight, ZincX::FontWeight::Normal }, atlas_);
+    const int lines = run.visibleLines(bounds.height);
+    int lineTop = bounds.y + run.verticalOffset(bounds.height, alignment);
+    std::size_t g = 0;
+    for (int line = 0; line < lines; ++line, lineTop += run.lineHeight) {
+        for (const std::size_t end = run.lineEnds[static_cast<std::size_t>(line)]; g < end; ++g) {
+            const ZPlacedGlyph& glyph = run.glyphs[g];
+            const ZincX::ZRect& src = glyph.source;
+            const ZincX::ZRect dst{ bounds.x + glyph.x, lineTop + glyph.y, src.width, src.height };
+            const ZincX::ZRect area = dst.intersected(clip_);
+            for (int y = area.y; y < area.y + area.height; ++y) {
+                ZRasterKernels::blendMask({ surface_.pixel(area.x, y), static_cast<std::size_t>(area.width) },
+                                          atlas_.coverage(src.x + area.x - dst.x, src.y + y - dst.y), color);
+            }
+        }
+    }
+}
+
+void SoftwareGraphicsBackend::fillRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) {
+    rasterFill(rect, color.packed());
+}
+
+void SoftwareGraphicsBackend::drawRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) {
+    rasterFrame(rect, color.packed());
+}
+
+void SoftwareGraphicsBackend::drawLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, const ZincX::ZColor& color) {
+    rasterLine(start, end, color.packed());
+}
+
+void SoftwareGraphicsBackend::drawCircle(const ZincX::ZPoint& center, int radius, const ZincX::ZColor& color, bool filled) {
+    rasterEllipse(center, radius * 2, radius * 2, color.packed(), filled);
+}
+
+void SoftwareGraphicsBackend::drawEllipse(const ZincX::ZPoint& center, int width, int height, const ZincX::ZColor& color, bool filled) {
+    rasterEllipse(center, width, height, color.packed(), filled);
+}
+
+void SoftwareGraphicsBackend::drawPolygon(const std::vector<ZincX::ZPoint>& points, const ZincX::ZColor& color, bool filled) {
+    rasterPolygon(points.data(), points.size(), color.packed(), filled);
+}
+
+void SoftwareGraphicsBackend::drawText(const std::string& text, const ZincX::ZRect& bounds, const ZincX::ZColor& color, ZincX::TextAlignment alignment) {
+    rasterText(text, bounds, color.packed(), alignment);
+}
+
+void SoftwareGraphicsBackend::blit(const ZincX::ZSurface32& source, const ZincX::ZPoint& at, bool blend) {
+    ZincX::ZRect area = ZincX::ZRect{ at.x, at.y, source.width, source.height }.intersected(clip_);
+    for (int y = area.y; y < area.y + area.height; ++y) {
+        ZincX::ZPixelSpan<ZincX::ZColor32> dst{ surface_.pixel(area.x, y), static_cast<std::size_t>(area.width) };
+        const ZincX::ZColor32* src = source.pixel(area.x - at.x, y - at.y);
+        if (blend) ZRasterKernels::blendBlit(dst, src);
+        else ZRasterKernels::blit(dst, src);
+    }
+}
+
+void SoftwareGraphicsBackend::drawLayer(ZLayerCache& layer, const ZincX::ZPoint& at) {
+    const ZincX::ZRect& area = layer.area();
+    if (area.isEmpty()) return;
+    ZLayerCache::Raster<ZincX::ZColor32>& raster = layer.pixels();
+    if (raster.generation != layer.generation()) rasterLayer(layer);
+    blit({ raster.data.data(), area.width, area.height, area.width }, at, !raster.opaque);
+}
+
+void SoftwareGraphicsBackend::rasterLayer(ZLayerCache& layer) {
+    const ZincX::ZRect& area = layer.area();
+    ZLayerCache::Raster<ZincX::ZColor32>& raster = layer.pixels();
+    raster.data.assign(static_cast<std::size_t>(area.width) * static_cast<std::size_t>(area.height), ZincX::ZColor32(0u));
+
+    // Draw the layer with this backend retargeted at the raster, sharing its glyph caches.
+    ZDrawList local;
+    local.append(layer.commands(), ZincX::ZMatrix::translation(static_cast<float>(-area.x), static_cast<float>(-area.y)));
+    const ZincX::ZSurface32 surface = surface_;
+    const ZincX::ZRect clip = clip_;
+    surface_ = { raster.data.data(), area.width, area.height, area.width };
+    clip_ = surface_.rect();
+    try {
+        submit(local);
+    } catch (...) {
+        surface_ = surface;
+        clip_ = clip;
+        throw;
+    }
+    surface_ = surface;
+    clip_ = clip;
+
+    // Blending onto transparent black leaves premultiplied color; blendBlit() expects straight alpha.
+    raster.opaque = true;
+    for (ZincX::ZColor32& p : raster.data) {
+        const std::uint32_t a = p.a();
+        if (a == 255) continue;
+        raster.opaque = false;
+        if (a == 0) continue;
+        auto unpremultiply = [a](std::uint32_t c) { return static_cast<std::uint8_t>(std::min<std::uint32_t>(255, (c * 255 + a / 2) / a)); };
+        p = ZincX::ZColor32(unpremultiply(p.r()), unpremultiply(p.g()), unpremultiply(p.b()), static_cast<std::uint8_t>(a));
+    }
+    raster.generation = layer.generation();
+}
+
+void SoftwareGraphicsBackend::submit(const ZDrawList& commands) {
+    for (const ZDrawCommand& cmd : commands.commands()) {
+        const ZincX::ZRect& r = cmd.rect;
+        switch (cmd.op) {
+            case ZDrawOp::SetClip: setClipRect(r); break;
+            case ZDrawOp::FillRect: rasterFill(r, cmd.color); break;
+            case ZDrawOp::DrawRect: rasterFrame(r, cmd.color); break;
+            case ZDrawOp::DrawLine: rasterLine({ r.x, r.y }, { r.width, r.height }, cmd.color); break;
+            case ZDrawOp::DrawCircle: rasterEllipse({ r.x, r.y }, r.width * 2, r.width * 2, cmd.color, cmd.filled != 0); break;
+            case ZDrawOp::DrawEllipse: rasterEllipse({ r.x, r.y }, r.width, r.height, cmd.color, cmd.filled != 0); break;
+            case ZDrawOp::DrawPolygon: rasterPolygon(commands.points(cmd), cmd.count, cmd.color, cmd.filled != 0); break;
+            case ZDrawOp::DrawText: rasterText(commands.text(cmd), r, cmd.color, cmd.alignment()); break;
+            case ZDrawOp::DrawLayer: drawLayer(commands.layer(cmd), { r.x, r.y }); break;
+        }
+    }
+}
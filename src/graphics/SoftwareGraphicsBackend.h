@@ -0,0 +1,101 @@
+/**
+ * @file SoftwareGraphicsBackend.h
+ * @brief Defines the CPU software-raster graphics backend for the ZincX framework.
+ *
+ * This file contains the SoftwareGraphicsBackend class, implementing the IZGraphicsBackend interface
+ * for RenderMode::Graphics16 on a linear 32 bpp framebuffer. It is the fallback on targets without
+ * a GPU: every primitive is decomposed into clipped horizontal spans that go through the SIMD
+ * kernels in ZRasterKernels.h, so fills and translucent shapes cost one vectorized loop per row.
+ * Text is shaped once per (string, width, alignment) into a ZTextRunCache and drawn as copies
+ * from a ZGlyphAtlas.
+ */
+#pragma once
+#include "IZGraphicsBackend.h"
+#include "ZGlyphAtlas.h"
+#include "ZTextRunCache.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+class SoftwareGraphicsBackend : public IZGraphicsBackend {
+public:
+    /**
+     * @brief Constructs a backend that owns its framebuffer.
+     * @param width Framebuffer width in pixels.
+     * @param height Framebuffer height in pixels.
+     */
+    SoftwareGraphicsBackend(int width, int height);
+
+    /**
+     * @brief Constructs a backend that renders into caller-provided memory, e.g. a mapped linear
+     *        frame buffer or a window system's back buffer.
+     * @param target The pixels to draw into; must outlive the backend.
+     */
+    explicit SoftwareGraphicsBackend(const ZincX::ZSurface32& target);
+
+    void initialize(ZincX::RenderMode mode) override;
+    ZincX::ZSize surfaceSize() const override { return { surface_.width, surface_.height }; }
+    void setClipRect(const ZincX::ZRect& clip) override;
+    void fillRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) override;
+    void drawRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) override;
+    void drawLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, const ZincX::ZColor& color) override;
+    void drawCircle(const ZincX::ZPoint& center, int radius, const ZincX::ZColor& color, bool filled = true) override;
+    void drawEllipse(const ZincX::ZPoint& center, int width, int height, const ZincX::ZColor& color, bool filled = true) override;
+    void drawPolygon(const std::vector<ZincX::ZPoint>& points, const ZincX::ZColor& color, bool filled = true) override;
+    void drawText(const std::string& text, const ZincX::ZRect& bounds, const ZincX::ZColor& color, ZincX::TextAlignment alignment = ZincX::TextAlignment::Center) override;
+
+    /**
+     * @brief Copies the layer's pixel raster, rendering it first if the layer was recorded again.
+     *
+     * The raster is kept with straight alpha, so translucent layer content composites as if it
+     * had been drawn directly.
+     */
+    void drawLayer(ZLayerCache& layer, const ZincX::ZPoint& at) override;
+
+    /** @brief Rasterizes a recorded frame without per-primitive virtual dispatch. */
+    void submit(const ZDrawList& commands) override;
+
+    /**
+     * @brief Copies a block of pixels into the framebuffer, honoring the clip rectangle.
+     * @param source The pixels to copy.
+     * @param at Destination of the source's top-left pixel.
+     * @param blend True to composite using the source's alpha, false to overwrite.
+     */
+    void blit(const ZincX::ZSurface32& source, const ZincX::ZPoint& at, bool blend = false);
+
+    /** @brief Returns the framebuffer the backend draws into. */
+    const ZincX::ZSurface32& surface() const { return surface_; }
+
+    /** @brief Width and height of one cell of the built-in bitmap font used by drawText(). */
+    static constexpr int kGlyphWidth = 6;
+    static constexpr int kGlyphHeight = 8;
+
+    /** @brief The atlas holding the rasterized glyphs of the built-in font. */
+    const ZGlyphAtlas& glyphAtlas() const { return atlas_; }
+
+    /** @brief The cache of shaped strings drawText() and submit() draw from. */
+    const ZTextRunCache& textRuns() const { return runs_; }
+
+    /** @brief Rasterizer for the built-in 5x7 font; also used by the GPU backends' atlases. */
+    static ZGlyphBitmap builtinGlyph(const ZFontKey& font, char32_t codepoint);
+
+private:
+    void span(int x0, int x1, int y, ZincX::ZColor32 color);
+    void plot(int x, int y, ZincX::ZColor32 color);
+
+    void rasterFill(const ZincX::ZRect& rect, ZincX::ZColor32 color);
+    void rasterFrame(const ZincX::ZRect& rect, ZincX::ZColor32 color);
+    void rasterLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, ZincX::ZColor32 color);
+    void rasterEllipse(const ZincX::ZPoint& center, int width, int height, ZincX::ZColor32 color, bool filled);
+    void rasterPolygon(const ZincX::ZPoint* points, std::size_t count, ZincX::ZColor32 color, bool filled);
+    void rasterText(std::string_view text, const ZincX::ZRect& bounds, ZincX::ZColor32 color, ZincX::TextAlignment alignment);
+    void rasterLayer(ZLayerCache& layer);
+
+    std::vector<ZincX::ZColor32> storage_; ///< Backing pixels when the backend owns its framebuffer.
+    ZincX::ZSurface32 surface_;
+    ZincX::ZRect clip_;
+    std::vector<double> crossings_;        ///< Scanline scratch for polygon fills.
+    ZGlyphAtlas atlas_;
+    ZTextRunCache runs_;
+};
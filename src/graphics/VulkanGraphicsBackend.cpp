@@ -0,0 +1,734 @@
+/**
+ * @file VulkanGraphicsBackend.cpp
+ * @brief Implementation of the Vulkan graphics backend for the ZincX framework.
+ *
+ * This file provides the implementation for the VulkanGraphicsBackend class. A frame in flight
+ * is recorded as: atlas upload if glyphs were added, one render pass over the canvas with a draw
+ * per ZQuadRange, then a copy of the canvas into the acquired swapchain image. Frames are
+ * pipelined through GPU_FRAMES_IN_FLIGHT command buffers, vertex buffers and fences; the only
+ * waits are on a frame's fence before its resources are reused, and on the device when the
+ * swapchain is rebuilt. Shaders are compiled from shaders/quad.vert and shaders/quad.frag to
+ * SPIR-V at build time and embedded as word arrays.
+ */
+#include "VulkanGraphicsBackend.h"
+#include "SoftwareGraphicsBackend.h"
+#include "../debug/ZProfiler.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace {
+    constexpr std::uint32_t kQuadVertex[] =
+#include "quad.vert.inc"
+        ;
+    constexpr std::uint32_t kQuadFragment[] =
+#include "quad.frag.inc"
+        ;
+
+    constexpr ZFontKey kBuiltinFont{ 0, SoftwareGraphicsBackend::kGlyphHeight, ZincX::FontWeight::Normal };
+
+    void check(VkResult result, const char* what) {
+        if (result != VK_SUCCESS) {
+            throw ZincX::ZException(std::string("VulkanGraphicsBackend: ") + what + " failed (VkResult " +
+                                    std::to_string(static_cast<int>(result)) + ")");
+        }
+    }
+
+    VkShaderModule createShader(VkDevice device, const std::uint32_t* code, std::size_t bytes) {
+        VkShaderModuleCreateInfo info{ VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO };
+        info.codeSize = bytes;
+        info.pCode = code;
+        VkShaderModule module = VK_NULL_HANDLE;
+        check(vkCreateShaderModule(device, &info, nullptr, &module), "vkCreateShaderModule");
+        return module;
+    }
+
+    void imageBarrier(VkCommandBuffer commands, VkImage image, VkImageLayout from, VkImageLayout to,
+                      VkPipelineStageFlags srcStage, VkAccessFlags srcAccess,
+                      VkPipelineStageFlags dstStage, VkAccessFlags dstAccess) {
+        VkImageMemoryBarrier barrier{ VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+        barrier.srcAccessMask = srcAccess;
+        barrier.dstAccessMask = dstAccess;
+        barrier.oldLayout = from;
+        barrier.newLayout = to;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image;
+        barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+        vkCmdPipelineBarrier(commands, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+}
+
+VulkanGraphicsBackend::VulkanGraphicsBackend(const ZVulkanContext& context)
+    : context_(context),
+      atlas_(ZincX::GLYPH_ATLAS_SIZE, ZincX::GLYPH_ATLAS_SIZE, &SoftwareGraphicsBackend::builtinGlyph),
+      runs_(ZincX::TEXT_RUN_CACHE_ENTRIES) {
+    if (!context.physicalDevice || !context.device || !context.queue || !context.surface) {
+        throw ZincX::ZException("VulkanGraphicsBackend requires a physical device, device, queue and surface");
+    }
+    batch_.clear({ 0, 0, context.size.width, context.size.height });
+}
+
+VulkanGraphicsBackend::~VulkanGraphicsBackend() {
+    VkDevice device = context_.device;
+    vkDeviceWaitIdle(device);
+    for (Frame& frame : frames_) {
+        if (frame.vertices) vkDestroyBuffer(device, frame.vertices, nullptr);
+        if (frame.vertexMemory) vkFreeMemory(device, frame.vertexMemory, nullptr);
+        if (frame.staging) vkDestroyBuffer(device, frame.staging, nullptr);
+        if (frame.stagingMemory) vkFreeMemory(device, frame.stagingMemory, nullptr);
+        if (frame.done) vkDestroyFence(device, frame.done, nullptr);
+        if (frame.imageAvailable) vkDestroySemaphore(device, frame.imageAvailable, nullptr);
+    }
+    if (commandPool_) vkDestroyCommandPool(device, commandPool_, nullptr);
+    if (pipeline_) vkDestroyPipeline(device, pipeline_, nullptr);
+    if (pipelineLayout_) vkDestroyPipelineLayout(device, pipelineLayout_, nullptr);
+    if (descriptorPool_) vkDestroyDescriptorPool(device, descriptorPool_, nullptr);
+    if (setLayout_) vkDestroyDescriptorSetLayout(device, setLayout_, nullptr);
+    if (sampler_) vkDestroySampler(device, sampler_, nullptr);
+    if (atlasView_) vkDestroyImageView(device, atlasView_, nullptr);
+    if (atlasImage_) vkDestroyImage(device, atlasImage_, nullptr);
+    if (atlasMemory_) vkFreeMemory(device, atlasMemory_, nullptr);
+    destroyCanvas();
+    if (renderPass_) vkDestroyRenderPass(device, renderPass_, nullptr);
+    destroySwapchain(swapchain_);
+}
+
+void VulkanGraphicsBackend::initialize(ZincX::RenderMode mode) {
+    if (mode != ZincX::RenderMode::Vulkan) {
+        throw ZincX::ZException("VulkanGraphicsBackend only supports RenderMode::Vulkan");
+    }
+    if (initialized_) return;
+
+    VkBool32 supported = VK_FALSE;
+    check(vkGetPhysicalDeviceSurfaceSupportKHR(context_.physicalDevice, context_.queueFamily, context_.surface, &supported),
+          "vkGetPhysicalDeviceSurfaceSupportKHR");
+    if (!supported) throw ZincX::ZException("VulkanGraphicsBackend: the queue family cannot present to the surface");
+
+    VkCommandPoolCreateInfo pool{ VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+    pool.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool.queueFamilyIndex = context_.queueFamily;
+    check(vkCreateCommandPool(context_.device, &pool, nullptr, &commandPool_), "vkCreateCommandPool");
+
+    createSwapchain();
+    createRenderPass();
+    createCanvas();
+    createAtlas();
+    createPipeline();
+    createFrames();
+    batch_.clear({ 0, 0, static_cast<int>(extent_.width), static_cast<int>(extent_.height) });
+    initialized_ = true;
+}
+
+ZincX::ZSize VulkanGraphicsBackend::surfaceSize() const {
+    if (!initialized_) return context_.size;
+    return { static_cast<int>(extent_.width), static_cast<int>(extent_.height) };
+}
+
+std::uint32_t VulkanGraphicsBackend::memoryType(std::uint32_t typeBits, VkMemoryPropertyFlags properties) const {
+    VkPhysicalDeviceMemoryProperties memory;
+    vkGetPhysicalDeviceMemoryProperties(context_.physicalDevice, &memory);
+    for (std::uint32_t i = 0; i < memory.memoryTypeCount; ++i) {
+        if ((typeBits & (1u << i)) && (memory.memoryTypes[i].propertyFlags & properties) == properties) return i;
+    }
+    throw ZincX::ZException("VulkanGraphicsBackend: no suitable memory type");
+}
+
+void VulkanGraphicsBackend::createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkBuffer& buffer,
+                                         VkDeviceMemory& memory, void*& mapped) {
+    VkBufferCreateInfo info{ VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    info.size = size;
+    info.usage = usage;
+    info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    check(vkCreateBuffer(context_.device, &info, nullptr, &buffer), "vkCreateBuffer");
+
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(context_.device, buffer, &requirements);
+    VkMemoryAllocateInfo allocate{ VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+    allocate.allocationSize = requirements.size;
+    // Host-coherent memory stays mapped for the buffer's lifetime and needs no flushes.
+    allocate.memoryTypeIndex = memoryType(requirements.memoryTypeBits,
+                                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    check(vkAllocateMemory(context_.device, &allocate, nullptr, &memory), "vkAllocateMemory");
+    check(vkBindBufferMemory(context_.device, buffer, memory, 0), "vkBindBufferMemory");
+    check(vkMapMemory(context_.device, memory, 0, VK_WHOLE_SIZE, 0, &mapped), "vkMapMemory");
+}
+
+void VulkanGraphicsBackend::createImage(VkFormat format, VkExtent2D extent, VkImageUsageFlags usage,
+                                        VkImage& image, VkDeviceMemory& memory, VkImageView& view) {
+    VkImageCreateInfo info{ VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+    info.imageType = VK_IMAGE_TYPE_2D;
+    info.format = format;
+    info.extent = { extent.width, extent.height, 1 };
+    info.mipLevels = 1;
+    info.arrayLayers = 1;
+    info.samples = VK_SAMPLE_COUNT_1_BIT;
+    info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    info.usage = usage;
+    info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    check(vkCreateImage(context_.device, &info, nullptr, &image), "vkCreateImage");
+
+    VkMemoryRequirements requirements;
+    vkGetImageMemoryRequirements(context_.device, image, &requirements);
+    VkMemoryAllocateInfo allocate{ VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+    allocate.allocationSize = requirements.size;
+    allocate.memoryTypeIndex = memoryType(requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    check(vkAllocateMemory(context_.device, &allocate, nullptr, &memory), "vkAllocateMemory");
+    check(vkBindImageMemory(context_.device, image, memory, 0), "vkBindImageMemory");
+
+    VkImageViewCreateInfo viewInfo{ VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+    viewInfo.image = image;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = format;
+    viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+    check(vkCreateImageView(context_.device, &viewInfo, nullptr, &view), "vkCreateImageView");
+}
+
+void VulkanGraphicsBackend::createSwapchain() {
+    VkSurfaceCapabilitiesKHR caps;
+    check(vkGetPhysicalDeviceSurfaceCapabilitiesKHR(context_.physicalDevice, context_.surface, &caps),
+          "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+    if (!(caps.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_DST_BIT)) {
+        throw ZincX::ZException("VulkanGraphicsBackend: swapchain images cannot be copied to");
+    }
+
+    VkExtent2D extent = caps.currentExtent;
+    if (extent.width == std::numeric_limits<std::uint32_t>::max()) {
+        extent.width = std::clamp(static_cast<std::uint32_t>(std::max(context_.size.width, 0)),
+                                  caps.minImageExtent.width, caps.maxImageExtent.width);
+        extent.height = std::clamp(static_cast<std::uint32_t>(std::max(context_.size.height, 0)),
+                                   caps.minImageExtent.height, caps.maxImageExtent.height);
+    }
+    minimized_ = extent.width == 0 || extent.height == 0;
+    if (minimized_) return;
+
+    // The format is chosen once; the render pass and canvas are built for it.
+    if (format_ == VK_FORMAT_UNDEFINED) {
+        std::uint32_t count = 0;
+        vkGetPhysicalDeviceSurfaceFormatsKHR(context_.physicalDevice, context_.surface, &count, nullptr);
+        std::vector<VkSurfaceFormatKHR> formats(count);
+        vkGetPhysicalDeviceSurfaceFormatsKHR(context_.physicalDevice, context_.surface, &count, formats.data());
+        if (formats.empty()) throw ZincX::ZException("VulkanGraphicsBackend: the surface reports no formats");
+        // UNORM keeps colors identical to the software rasterizer's.
+        format_ = formats.front().format;
+        for (const VkSurfaceFormatKHR& candidate : formats) {
+            if (candidate.format == VK_FORMAT_B8G8R8A8_UNORM || candidate.format == VK_FORMAT_R8G8B8A8_UNORM) {
+                format_ = candidate.format;
+                break;
+            }
+        }
+    }
+
+    std::uint32_t modeCount = 0;
+    vkGetPhysicalDeviceSurfacePresentModesKHR(context_.physicalDevice, context_.surface, &modeCount, nullptr);
+    std::vector<VkPresentModeKHR> modes(modeCount);
+    vkGetPhysicalDeviceSurfacePresentModesKHR(context_.physicalDevice, context_.surface, &modeCount, modes.data());
+    // Mailbox never blocks acquire; FIFO is always available and paces to the display.
+    const bool mailbox = std::find(modes.begin(), modes.end(), VK_PRESENT_MODE_MAILBOX_KHR) != modes.end();
+
+    std::uint32_t imageCount = std::max<std::uint32_t>(caps.minImageCount + 1, ZincX::GPU_FRAMES_IN_FLIGHT);
+    if (caps.maxImageCount != 0) imageCount = std::min(imageCount, caps.maxImageCount);
+
+    VkCompositeAlphaFlagBitsKHR alpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    if (!(caps.supportedCompositeAlpha & alpha)) {
+        alpha = static_cast<VkCompositeAlphaFlagBitsKHR>(caps.supportedCompositeAlpha & ~(caps.supportedCompositeAlpha - 1));
+    }
+
+    VkSwapchainCreateInfoKHR info{ VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR };
+    info.surface = context_.surface;
+    info.minImageCount = imageCount;
+    info.imageFormat = format_;
+    info.imageColorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+    info.imageExtent = extent;
+    info.imageArrayLayers = 1;
+    info.imageUsage = VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    info.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    info.preTransform = caps.currentTransform;
+    info.compositeAlpha = alpha;
+    info.presentMode = mailbox ? VK_PRESENT_MODE_MAILBOX_KHR : VK_PRESENT_MODE_FIFO_KHR;
+    info.clipped = VK_TRUE;
+    info.oldSwapchain = swapchain_;
+    VkSwapchainKHR created = VK_NULL_HANDLE;
+    check(vkCreateSwapchainKHR(context_.device, &info, nullptr, &created), "vkCreateSwapchainKHR");
+    destroySwapchain(swapchain_);
+    swapchain_ = created;
+    extent_ = extent;
+
+    std::uint32_t count = 0;
+    vkGetSwapchainImagesKHR(context_.device, swapchain_, &count, nullptr);
+    images_.resize(count);
+    vkGetSwapchainImagesKHR(context_.device, swapchain_, &count, images_.data());
+    renderDone_.resize(count);
+    VkSemaphoreCreateInfo semaphore{ VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+    for (VkSemaphore& done : renderDone_) {
+        check(vkCreateSemaphore(context_.device, &semaphore, nullptr, &done), "vkCreateSemaphore");
+    }
+}
+
+void VulkanGraphicsBackend::destroySwapchain(VkSwapchainKHR swapchain) {
+    if (!swapchain) return;
+    for (VkSemaphore done : renderDone_) vkDestroySemaphore(context_.device, done, nullptr);
+    renderDone_.clear();
+    images_.clear();
+    vkDestroySwapchainKHR(context_.device, swapchain, nullptr);
+}
+
+void VulkanGraphicsBackend::recreateSwapchain() {
+    vkDeviceWaitIdle(context_.device);
+    const VkExtent2D previous = extent_;
+    createSwapchain();
+    if (!minimized_ && (extent_.width != previous.width || extent_.height != previous.height)) {
+        destroyCanvas();
+        createCanvas();
+        batch_.clear({ 0, 0, static_cast<int>(extent_.width), static_cast<int>(extent_.height) });
+    }
+}
+
+void VulkanGraphicsBackend::resize(const ZincX::ZSize& size) {
+    context_.size = size;
+    if (initialized_) recreateSwapchain();
+}
+
+void VulkanGraphicsBackend::createRenderPass() {
+    VkAttachmentDescription color{};
+    color.format = format_;
+    color.samples = VK_SAMPLE_COUNT_1_BIT;
+    // Loaded, not cleared: ZGraphicsView only redraws damaged areas.
+    color.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+    color.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    color.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    color.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    color.initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    color.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentReference reference{ 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+    VkSubpassDescription subpass{};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &reference;
+
+    VkSubpassDependency dependency{};
+    dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependency.dstSubpass = 0;
+    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+
+    VkRenderPassCreateInfo info{ VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO };
+    info.attachmentCount = 1;
+    info.pAttachments = &color;
+    info.subpassCount = 1;
+    info.pSubpasses = &subpass;
+    info.dependencyCount = 1;
+    info.pDependencies = &dependency;
+    check(vkCreateRenderPass(context_.device, &info, nullptr, &renderPass_), "vkCreateRenderPass");
+}
+
+void VulkanGraphicsBackend::createCanvas() {
+    if (extent_.width == 0 || extent_.height == 0) {
+        throw ZincX::ZException("VulkanGraphicsBackend: the surface has no area");
+    }
+    createImage(format_, extent_,
+                VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+                canvas_, canvasMemory_, canvasView_);
+
+    VkFramebufferCreateInfo info{ VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO };
+    info.renderPass = renderPass_;
+    info.attachmentCount = 1;
+    info.pAttachments = &canvasView_;
+    info.width = extent_.width;
+    info.height = extent_.height;
+    info.layers = 1;
+    check(vkCreateFramebuffer(context_.device, &info, nullptr, &framebuffer_), "vkCreateFramebuffer");
+
+    // One-off: clear to opaque black and leave the canvas in the layout the render pass expects.
+    VkCommandBufferAllocateInfo allocate{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+    allocate.commandPool = commandPool_;
+    allocate.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocate.commandBufferCount = 1;
+    VkCommandBuffer commands = VK_NULL_HANDLE;
+    check(vkAllocateCommandBuffers(context_.device, &allocate, &commands), "vkAllocateCommandBuffers");
+    VkCommandBufferBeginInfo begin{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+    begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(commands, &begin);
+    imageBarrier(commands, canvas_, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                 VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT);
+    const VkClearColorValue black{ { 0.0f, 0.0f, 0.0f, 1.0f } };
+    const VkImageSubresourceRange range{ VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+    vkCmdClearColorImage(commands, canvas_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &black, 1, &range);
+    imageBarrier(commands, canvas_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                 VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                 VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+    check(vkEndCommandBuffer(commands), "vkEndCommandBuffer");
+    VkSubmitInfo submit{ VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    submit.commandBufferCount = 1;
+    submit.pCommandBuffers = &commands;
+    check(vkQueueSubmit(context_.queue, 1, &submit, VK_NULL_HANDLE), "vkQueueSubmit");
+    vkQueueWaitIdle(context_.queue);
+    vkFreeCommandBuffers(context_.device, commandPool_, 1, &commands);
+}
+
+void VulkanGraphicsBackend::destroyCanvas() {
+    if (framebuffer_) vkDestroyFramebuffer(context_.device, framebuffer_, nullptr);
+    if (canvasView_) vkDestroyImageView(context_.device, canvasView_, nullptr);
+    if (canvas_) vkDestroyImage(context_.device, canvas_, nullptr);
+    if (canvasMemory_) vkFreeMemory(context_.device, canvasMemory_, nullptr);
+    framebuffer_ = VK_NULL_HANDLE;
+    canvasView_ = VK_NULL_HANDLE;
+    canvas_ = VK_NULL_HANDLE;
+    canvasMemory_ = VK_NULL_HANDLE;
+}
+
+void VulkanGraphicsBackend::createAtlas() {
+    const VkExtent2D extent{ static_cast<std::uint32_t>(atlas_.width()), static_cast<std::uint32_t>(atlas_.height()) };
+    createImage(VK_FORMAT_R8_UNORM, extent, VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+                atlasImage_, atlasMemory_, atlasView_);
+
+    VkSamplerCreateInfo sampler{ VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO };
+    sampler.magFilter = VK_FILTER_NEAREST;
+    sampler.minFilter = VK_FILTER_NEAREST;
+    sampler.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    sampler.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    sampler.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    sampler.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    check(vkCreateSampler(context_.device, &sampler, nullptr, &sampler_), "vkCreateSampler");
+}
+
+void VulkanGraphicsBackend::createPipeline() {
+    VkDescriptorSetLayoutBinding binding{};
+    binding.binding = 0;
+    binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    binding.descriptorCount = 1;
+    binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    VkDescriptorSetLayoutCreateInfo layout{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+    layout.bindingCount = 1;
+    layout.pBindings = &binding;
+    check(vkCreateDescriptorSetLayout(context_.device, &layout, nullptr, &setLayout_), "vkCreateDescriptorSetLayout");
+
+    VkDescriptorPoolSize poolSize{ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1 };
+    VkDescriptorPoolCreateInfo pool{ VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+    pool.maxSets = 1;
+    pool.poolSizeCount = 1;
+    pool.pPoolSizes = &poolSize;
+    check(vkCreateDescriptorPool(context_.device, &pool, nullptr, &descriptorPool_), "vkCreateDescriptorPool");
+
+    VkDescriptorSetAllocateInfo allocate{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+    allocate.descriptorPool = descriptorPool_;
+    allocate.descriptorSetCount = 1;
+    allocate.pSetLayouts = &setLayout_;
+    check(vkAllocateDescriptorSets(context_.device, &allocate, &descriptorSet_), "vkAllocateDescriptorSets");
+
+    VkDescriptorImageInfo image{ sampler_, atlasView_, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+    VkWriteDescriptorSet write{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+    write.dstSet = descriptorSet_;
+    write.dstBinding = 0;
+    write.descriptorCount = 1;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    write.pImageInfo = &image;
+    vkUpdateDescriptorSets(context_.device, 1, &write, 0, nullptr);
+
+    VkPushConstantRange push{ VK_SHADER_STAGE_VERTEX_BIT, 0, 2 * sizeof(float) };
+    VkPipelineLayoutCreateInfo pipelineLayout{ VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+    pipelineLayout.setLayoutCount = 1;
+    pipelineLayout.pSetLayouts = &setLayout_;
+    pipelineLayout.pushConstantRangeCount = 1;
+    pipelineLayout.pPushConstantRanges = &push;
+    check(vkCreatePipelineLayout(context_.device, &pipelineLayout, nullptr, &pipelineLayout_), "vkCreatePipelineLayout");
+
+    VkShaderModule vertex = createShader(context_.device, kQuadVertex, sizeof kQuadVertex);
+    VkShaderModule fragment = createShader(context_.device, kQuadFragment, sizeof kQuadFragment);
+    VkPipelineShaderStageCreateInfo stages[2]{};
+    stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stages[0].module = vertex;
+    stages[0].pName = "main";
+    stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    stages[1].module = fragment;
+    stages[1].pName = "main";
+
+    // One ZQuadInstance per instance; the six corners come from gl_VertexIndex.
+    VkVertexInputBindingDescription instanceBinding{ 0, sizeof(ZQuadInstance), VK_VERTEX_INPUT_RATE_INSTANCE };
+    VkVertexInputAttributeDescription attributes[] = {
+        { 0, 0, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(ZQuadInstance, x0) },
+        { 1, 0, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(ZQuadInstance, u0) },
+        { 2, 0, VK_FORMAT_R32_UINT, offsetof(ZQuadInstance, color) },
+        { 3, 0, VK_FORMAT_R32_UINT, offsetof(ZQuadInstance, kind) },
+    };
+    VkPipelineVertexInputStateCreateInfo input{ VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO };
+    input.vertexBindingDescriptionCount = 1;
+    input.pVertexBindingDescriptions = &instanceBinding;
+    input.vertexAttributeDescriptionCount = static_cast<std::uint32_t>(std::size(attributes));
+    input.pVertexAttributeDescriptions = attributes;
+
+    VkPipelineInputAssemblyStateCreateInfo assembly{ VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO };
+    assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    VkPipelineViewportStateCreateInfo viewport{ VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO };
+    viewport.viewportCount = 1;
+    viewport.scissorCount = 1;
+
+    VkPipelineRasterizationStateCreateInfo raster{ VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO };
+    raster.polygonMode = VK_POLYGON_MODE_FILL;
+    raster.cullMode = VK_CULL_MODE_NONE;
+    raster.frontFace = VK_FRONT_FACE_CLOCKWISE;
+    raster.lineWidth = 1.0f;
+
+    VkPipelineMultisampleStateCreateInfo multisample{ VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO };
+    multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+    VkPipelineColorBlendAttachmentState blend{};
+    blend.blendEnable = VK_TRUE;
+    blend.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+    blend.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+    blend.colorBlendOp = VK_BLEND_OP_ADD;
+    blend.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+    blend.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+    blend.alphaBlendOp = VK_BLEND_OP_ADD;
+    blend.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    VkPipelineColorBlendStateCreateInfo blending{ VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO };
+    blending.attachmentCount = 1;
+    blending.pAttachments = &blend;
+
+    const VkDynamicState dynamic[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+    VkPipelineDynamicStateCreateInfo dynamicState{ VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO };
+    dynamicState.dynamicStateCount = static_cast<std::uint32_t>(std::size(dynamic));
+    dynamicState.pDynamicStates = dynamic;
+
+    VkGraphicsPipelineCreateInfo info{ VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO };
+    info.stageCount = 2;
+    info.pStages = stages;
+    info.pVertexInputState = &input;
+    info.pInputAssemblyState = &assembly;
+    info.pViewportState = &viewport;
+    info.pRasterizationState = &raster;
+    info.pMultisampleState = &multisample;
+    info.pColorBlendState = &blending;
+    info.pDynamicState = &dynamicState;
+    info.layout = pipelineLayout_;
+    info.renderPass = renderPass_;
+    info.subpass = 0;
+    const VkResult result = vkCreateGraphicsPipelines(context_.device, VK_NULL_HANDLE, 1, &info, nullptr, &pipeline_);
+    vkDestroyShaderModule(context_.device, vertex, nullptr);
+    vkDestroyShaderModule(context_.device, fragment, nullptr);
+    check(result, "vkCreateGraphicsPipelines");
+}
+
+void VulkanGraphicsBackend::createFrames() {
+    VkCommandBufferAllocateInfo allocate{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+    allocate.commandPool = commandPool_;
+    allocate.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocate.commandBufferCount = 1;
+    VkFenceCreateInfo fence{ VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+    fence.flags = VK_FENCE_CREATE_SIGNALED_BIT; // the first use of each frame must not wait
+    VkSemaphoreCreateInfo semaphore{ VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+    for (Frame& frame : frames_) {
+        check(vkAllocateCommandBuffers(context_.device, &allocate, &frame.commands), "vkAllocateCommandBuffers");
+        check(vkCreateFence(context_.device, &fence, nullptr, &frame.done), "vkCreateFence");
+        check(vkCreateSemaphore(context_.device, &semaphore, nullptr, &frame.imageAvailable), "vkCreateSemaphore");
+        reserveVertices(frame, ZincX::GPU_VERTEX_RING_INSTANCES);
+    }
+}
+
+void VulkanGraphicsBackend::reserveVertices(Frame& frame, std::size_t instances) {
+    if (instances <= frame.vertexCapacity) return;
+    if (frame.vertices) {
+        vkDestroyBuffer(context_.device, frame.vertices, nullptr);
+        vkFreeMemory(context_.device, frame.vertexMemory, nullptr);
+    }
+    frame.vertexCapacity = std::max(instances, frame.vertexCapacity * 2);
+    createBuffer(frame.vertexCapacity * sizeof(ZQuadInstance), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                 frame.vertices, frame.vertexMemory, frame.mappedVertices);
+}
+
+void VulkanGraphicsBackend::uploadAtlas(Frame& frame) {
+    const std::size_t bytes = static_cast<std::size_t>(atlas_.width()) * static_cast<std::size_t>(atlas_.height());
+    if (!frame.staging) {
+        createBuffer(bytes, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, frame.staging, frame.stagingMemory, frame.mappedStaging);
+    }
+    std::memcpy(frame.mappedStaging, atlas_.coverage(0, 0), bytes);
+
+    // Earlier frames may still be sampling the atlas; the barrier orders the copy after them.
+    VkCommandBuffer commands = frame.commands;
+    imageBarrier(commands, atlasImage_,
+                 atlasInitialized_ ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_UNDEFINED,
+                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+                 VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT);
+    VkBufferImageCopy region{};
+    region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+    region.imageExtent = { static_cast<std::uint32_t>(atlas_.width()), static_cast<std::uint32_t>(atlas_.height()), 1 };
+    vkCmdCopyBufferToImage(commands, frame.staging, atlasImage_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    imageBarrier(commands, atlasImage_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                 VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                 VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+
+    atlasInitialized_ = true;
+    uploadedGeneration_ = atlas_.generation();
+    uploadedGlyphs_ = atlas_.glyphCount();
+}
+
+void VulkanGraphicsBackend::record(Frame& frame, std::uint32_t image, bool presentable) {
+    VkCommandBuffer commands = frame.commands;
+    check(vkResetCommandBuffer(commands, 0), "vkResetCommandBuffer");
+    VkCommandBufferBeginInfo begin{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+    begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    check(vkBeginCommandBuffer(commands, &begin), "vkBeginCommandBuffer");
+
+    if (!atlasInitialized_ || atlas_.generation() != uploadedGeneration_ || atlas_.glyphCount() != uploadedGlyphs_) {
+        uploadAtlas(frame);
+    }
+
+    VkRenderPassBeginInfo pass{ VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO };
+    pass.renderPass = renderPass_;
+    pass.framebuffer = framebuffer_;
+    pass.renderArea = { { 0, 0 }, extent_ };
+    vkCmdBeginRenderPass(commands, &pass, VK_SUBPASS_CONTENTS_INLINE);
+    if (!batch_.empty()) {
+        const std::vector<ZQuadInstance>& instances = batch_.instances();
+        reserveVertices(frame, instances.size());
+        std::memcpy(frame.mappedVertices, instances.data(), instances.size() * sizeof(ZQuadInstance));
+
+        vkCmdBindPipeline(commands, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_);
+        const VkViewport viewport{ 0.0f, 0.0f, static_cast<float>(extent_.width), static_cast<float>(extent_.height), 0.0f, 1.0f };
+        vkCmdSetViewport(commands, 0, 1, &viewport);
+        const float scale[2] = { 2.0f / static_cast<float>(extent_.width), 2.0f / static_cast<float>(extent_.height) };
+        vkCmdPushConstants(commands, pipelineLayout_, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof scale, scale);
+        vkCmdBindDescriptorSets(commands, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0, 1, &descriptorSet_, 0, nullptr);
+        const VkDeviceSize offset = 0;
+        vkCmdBindVertexBuffers(commands, 0, 1, &frame.vertices, &offset);
+        for (const ZQuadRange& range : batch_.ranges()) {
+            const ZincX::ZRect& s = range.scissor;
+            const VkRect2D scissor{ { s.x, s.y }, { static_cast<std::uint32_t>(s.width), static_cast<std::uint32_t>(s.height) } };
+            vkCmdSetScissor(commands, 0, 1, &scissor);
+            vkCmdDraw(commands, 6, range.count, 0, range.first);
+        }
+    }
+    vkCmdEndRenderPass(commands);
+
+    if (presentable) {
+        VkImage target = images_[image];
+        imageBarrier(commands, canvas_, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                     VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                     VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT);
+        imageBarrier(commands, target, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                     VK_PIPELINE_STAGE_TRANSFER_BIT, 0, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT);
+        VkImageCopy copy{};
+        copy.srcSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+        copy.dstSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+        copy.extent = { extent_.width, extent_.height, 1 };
+        vkCmdCopyImage(commands, canvas_, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, target, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copy);
+        imageBarrier(commands, target, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+                     VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0);
+        imageBarrier(commands, canvas_, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                     VK_PIPELINE_STAGE_TRANSFER_BIT, 0, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                     VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+    }
+    check(vkEndCommandBuffer(commands), "vkEndCommandBuffer");
+}
+
+void VulkanGraphicsBackend::present() {
+    if (!initialized_) throw ZincX::ZException("VulkanGraphicsBackend: present() before initialize()");
+    ZINCX_PROFILE_SCOPE("VulkanGraphicsBackend::present", Rendering);
+    flushPending();
+
+    Frame& frame = frames_[frameIndex_];
+    // Only blocks when the GPU is a whole ring of frames behind.
+    if (vkGetFenceStatus(context_.device, frame.done) == VK_NOT_READY) ++stalls_;
+    check(vkWaitForFences(context_.device, 1, &frame.done, VK_TRUE, std::numeric_limits<std::uint64_t>::max()), "vkWaitForFences");
+
+    if (minimized_) recreateSwapchain();
+    std::uint32_t image = 0;
+    bool presentable = false;
+    bool stale = false;
+    if (!minimized_) {
+        const VkResult acquired = vkAcquireNextImageKHR(context_.device, swapchain_, std::numeric_limits<std::uint64_t>::max(),
+                                                        frame.imageAvailable, VK_NULL_HANDLE, &image);
+        if (acquired == VK_ERROR_OUT_OF_DATE_KHR) {
+            stale = true;
+        } else if (acquired == VK_SUBOPTIMAL_KHR) {
+            presentable = true;
+            stale = true;
+        } else {
+            check(acquired, "vkAcquireNextImageKHR");
+            presentable = true;
+        }
+    }
+
+    // The canvas is drawn even when nothing can be shown, so it stays in step with the view.
+    record(frame, image, presentable);
+    check(vkResetFences(context_.device, 1, &frame.done), "vkResetFences");
+    const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    VkSubmitInfo submit{ VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    if (presentable) {
+        submit.waitSemaphoreCount = 1;
+        submit.pWaitSemaphores = &frame.imageAvailable;
+        submit.pWaitDstStageMask = &waitStage;
+        submit.signalSemaphoreCount = 1;
+        submit.pSignalSemaphores = &renderDone_[image];
+    }
+    submit.commandBufferCount = 1;
+    submit.pCommandBuffers = &frame.commands;
+    check(vkQueueSubmit(context_.queue, 1, &submit, frame.done), "vkQueueSubmit");
+
+    if (presentable) {
+        VkPresentInfoKHR info{ VK_STRUCTURE_TYPE_PRESENT_INFO_KHR };
+        info.waitSemaphoreCount = 1;
+        info.pWaitSemaphores = &renderDone_[image];
+        info.swapchainCount = 1;
+        info.pSwapchains = &swapchain_;
+        info.pImageIndices = &image;
+        const VkResult presented = vkQueuePresentKHR(context_.queue, &info);
+        if (presented == VK_ERROR_OUT_OF_DATE_KHR || presented == VK_SUBOPTIMAL_KHR) stale = true;
+        else check(presented, "vkQueuePresentKHR");
+    }
+
+    frameIndex_ = (frameIndex_ + 1) % frames_.size();
+    batch_.clear({ 0, 0, static_cast<int>(extent_.width), static_cast<int>(extent_.height) });
+    if (stale) recreateSwapchain();
+}
+
+void VulkanGraphicsBackend::flushPending() {
+    if (pending_.empty()) return;
+    batch_.add(pending_, atlas_, runs_, kBuiltinFont);
+    pending_.clear();
+}
+
+void VulkanGraphicsBackend::submit(const ZDrawList& commands) {
+    flushPending();
+    batch_.add(commands, atlas_, runs_, kBuiltinFont);
+}
+
+void VulkanGraphicsBackend::setClipRect(const ZincX::ZRect& clip) {
+    pending_.setClip(clip);
+}
+
+void VulkanGraphicsBackend::fillRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) {
+    pending_.fillRect(rect, color);
+}
+
+void VulkanGraphicsBackend::drawRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) {
+    pending_.drawRect(rect, color);
+}
+
+void VulkanGraphicsBackend::drawLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, const ZincX::ZColor& color) {
+    pending_.drawLine(start, end, color);
+}
+
+void VulkanGraphicsBackend::drawCircle(const ZincX::ZPoint& center, int radius, const ZincX::ZColor& color, bool filled) {
+    pending_.drawCircle(center, radius, color, filled);
+}
+
+void VulkanGraphicsBackend::drawEllipse(const ZincX::ZPoint& center, int width, int height, const ZincX::ZColor& color, bool filled) {
+    pending_.drawEllipse(center, width, height, color, filled);
+}
+
+void VulkanGraphicsBackend::drawPolygon(const std::vector<ZincX::ZPoint>& points, const ZincX::ZColor& color, bool filled) {
+    pending_.drawPolygon(points.data(), points.size(), color, filled);
+}
+
+void VulkanGraphicsBackend::drawText(const std::string& text, const ZincX::ZRect& bounds, const ZincX::ZColor& color, ZincX::TextAlignment alignment) {
+    pending_.drawText(text, bounds, color, alignment);
+}
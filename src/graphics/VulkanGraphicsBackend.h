@@ -0,0 +1,160 @@
+/**
+ * @file VulkanGraphicsBackend.h
+ * @brief Defines the Vulkan graphics backend for the ZincX framework.
+ *
+ * This file contains VulkanGraphicsBackend, implementing the IZGraphicsBackend interface for
+ * RenderMode::Vulkan. A frame's draw list is converted by ZQuadBatch into instanced quads that
+ * one pipeline draws with a single vkCmdDraw per clip rectangle. Instances are written straight
+ * into one of GPU_FRAMES_IN_FLIGHT persistently mapped vertex buffers, each guarded by its own
+ * fence, so recording a frame only waits for the GPU when it has fallen a whole ring behind.
+ * Drawing goes to a persistent canvas image that is copied to the swapchain image on present,
+ * which keeps ZGraphicsView's partial redraws valid whatever the swapchain does with old images.
+ *
+ * Only built when the ZINCX_WITH_VULKAN CMake option is on.
+ */
+#pragma once
+#include "IZGraphicsBackend.h"
+#include "ZGlyphAtlas.h"
+#include "ZQuadBatch.h"
+#include "ZTextRunCache.h"
+#include "../common/ZConfig.h"
+#include <vulkan/vulkan.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Vulkan objects created by the application that the backend renders with.
+ *
+ * The backend never destroys them; they must outlive it.
+ */
+struct ZVulkanContext {
+    VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
+    VkDevice device = VK_NULL_HANDLE;       ///< Created with VK_KHR_swapchain enabled.
+    std::uint32_t queueFamily = 0;          ///< Family of queue; must support graphics and presenting to surface.
+    VkQueue queue = VK_NULL_HANDLE;
+    VkSurfaceKHR surface = VK_NULL_HANDLE;
+    ZincX::ZSize size;                      ///< Surface size in pixels, used when the surface does not report one.
+};
+
+class VulkanGraphicsBackend : public IZGraphicsBackend {
+public:
+    explicit VulkanGraphicsBackend(const ZVulkanContext& context);
+    ~VulkanGraphicsBackend() override;
+
+    VulkanGraphicsBackend(const VulkanGraphicsBackend&) = delete;
+    VulkanGraphicsBackend& operator=(const VulkanGraphicsBackend&) = delete;
+
+    /** @brief Creates the swapchain and pipeline. @throws ZincX::ZException unless @p mode is RenderMode::Vulkan. */
+    void initialize(ZincX::RenderMode mode) override;
+    ZincX::ZSize surfaceSize() const override;
+    void setClipRect(const ZincX::ZRect& clip) override;
+    void fillRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) override;
+    void drawRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) override;
+    void drawLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, const ZincX::ZColor& color) override;
+    void drawCircle(const ZincX::ZPoint& center, int radius, const ZincX::ZColor& color, bool filled = true) override;
+    void drawEllipse(const ZincX::ZPoint& center, int width, int height, const ZincX::ZColor& color, bool filled = true) override;
+    void drawPolygon(const std::vector<ZincX::ZPoint>& points, const ZincX::ZColor& color, bool filled = true) override;
+    void drawText(const std::string& text, const ZincX::ZRect& bounds, const ZincX::ZColor& color, ZincX::TextAlignment alignment = ZincX::TextAlignment::Center) override;
+
+    /** @brief Converts a recorded frame into instanced quads; drawn by the next present(). */
+    void submit(const ZDrawList& commands) override;
+
+    /** @brief Uploads and draws everything since the last present and queues it for display. */
+    void present() override;
+
+    /**
+     * @brief Rebuilds the swapchain for a new window size.
+     *
+     * The canvas is recreated cleared when the size changes; the view sees the new surfaceSize()
+     * on its next render() and redraws everything.
+     */
+    void resize(const ZincX::ZSize& size);
+
+    /** @brief The atlas holding the rasterized glyphs of the built-in font. */
+    const ZGlyphAtlas& glyphAtlas() const { return atlas_; }
+
+    /** @brief The cache of shaped strings drawText() and submit() draw from. */
+    const ZTextRunCache& textRuns() const { return runs_; }
+
+    /** @brief Number of present() calls that had to wait for the GPU to free a frame; for profiling. */
+    std::uint64_t stalledFrames() const { return stalls_; }
+
+private:
+    /** @brief Everything one frame in flight owns; reused once its fence signals. */
+    struct Frame {
+        VkCommandBuffer commands = VK_NULL_HANDLE;
+        VkFence done = VK_NULL_HANDLE;
+        VkSemaphore imageAvailable = VK_NULL_HANDLE;
+        VkBuffer vertices = VK_NULL_HANDLE;
+        VkDeviceMemory vertexMemory = VK_NULL_HANDLE;
+        void* mappedVertices = nullptr;
+        std::size_t vertexCapacity = 0;     ///< In instances.
+        VkBuffer staging = VK_NULL_HANDLE;  ///< Atlas upload source, created on first upload.
+        VkDeviceMemory stagingMemory = VK_NULL_HANDLE;
+        void* mappedStaging = nullptr;
+    };
+
+    void createSwapchain();
+    void destroySwapchain(VkSwapchainKHR swapchain);
+    void recreateSwapchain();
+    void createCanvas();
+    void destroyCanvas();
+    void createRenderPass();
+    void createAtlas();
+    void createPipeline();
+    void createFrames();
+
+    std::uint32_t memoryType(std::uint32_t typeBits, VkMemoryPropertyFlags properties) const;
+    void createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkBuffer& buffer, VkDeviceMemory& memory, void*& mapped);
+    void createImage(VkFormat format, VkExtent2D extent, VkImageUsageFlags usage, VkImage& image, VkDeviceMemory& memory, VkImageView& view);
+
+    /** @brief Grows a frame's vertex buffer; only called once the frame's fence has signaled. */
+    void reserveVertices(Frame& frame, std::size_t instances);
+    void uploadAtlas(Frame& frame);
+    void record(Frame& frame, std::uint32_t image, bool presentable);
+
+    /** @brief Moves primitives drawn through the immediate calls into the batch. */
+    void flushPending();
+
+    ZVulkanContext context_;
+    bool initialized_ = false;
+
+    VkSwapchainKHR swapchain_ = VK_NULL_HANDLE;
+    VkFormat format_ = VK_FORMAT_UNDEFINED;
+    VkExtent2D extent_{};
+    std::vector<VkImage> images_;
+    std::vector<VkSemaphore> renderDone_;     ///< One per swapchain image, waited on by its present.
+    bool minimized_ = false;                  ///< Surface has no area; frames are drawn but not shown.
+
+    VkImage canvas_ = VK_NULL_HANDLE;
+    VkDeviceMemory canvasMemory_ = VK_NULL_HANDLE;
+    VkImageView canvasView_ = VK_NULL_HANDLE;
+    VkFramebuffer framebuffer_ = VK_NULL_HANDLE;
+    VkRenderPass renderPass_ = VK_NULL_HANDLE;
+
+    VkImage atlasImage_ = VK_NULL_HANDLE;
+    VkDeviceMemory atlasMemory_ = VK_NULL_HANDLE;
+    VkImageView atlasView_ = VK_NULL_HANDLE;
+    VkSampler sampler_ = VK_NULL_HANDLE;
+    bool atlasInitialized_ = false;           ///< False until the first upload leaves UNDEFINED layout.
+    std::uint32_t uploadedGeneration_ = 0;
+    std::size_t uploadedGlyphs_ = 0;
+
+    VkDescriptorSetLayout setLayout_ = VK_NULL_HANDLE;
+    VkDescriptorPool descriptorPool_ = VK_NULL_HANDLE;
+    VkDescriptorSet descriptorSet_ = VK_NULL_HANDLE;
+    VkPipelineLayout pipelineLayout_ = VK_NULL_HANDLE;
+    VkPipeline pipeline_ = VK_NULL_HANDLE;
+
+    VkCommandPool commandPool_ = VK_NULL_HANDLE;
+    std::array<Frame, ZincX::GPU_FRAMES_IN_FLIGHT> frames_{};
+    std::size_t frameIndex_ = 0;
+    std::uint64_t stalls_ = 0;
+
+    ZDrawList pending_;
+    ZQuadBatch batch_;
+    ZGlyphAtlas atlas_;
+    ZTextRunCache runs_;
+};
@@ -0,0 +1,74 @@
+/**
+ * @file ZDamageRegion.cpp
+ * @brief Implementation of the ZDamageRegion class for the ZincX graphics subsystem.
+ *
+ * Rectangles are merged whenever their bounding box wastes no more area than the two rectangles
+ * cover on their own, which folds overlapping and touching updates together while keeping
+ * far-apart updates (e.g. two live fields on opposite sides of a dashboard) separate.
+ */
+#include "ZDamageRegion.h"
+
+namespace {
+    bool cheapToMerge(const ZincX::ZRect& a, const ZincX::ZRect& b) {
+        return a.united(b).area() <= a.area() + b.area();
+    }
+}
+
+void ZDamageRegion::add(const ZincX::ZRect& rect) {
+    if (rect.isEmpty()) return;
+
+    ZincX::ZRect pending = rect;
+    // Merging can make the grown rectangle mergeable with others, so repeat until stable.
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (std::size_t i = 0; i < rects_.size(); ++i) {
+            if (rects_[i].contains(pending)) return;
+            if (pending.contains(rects_[i]) || cheapToMerge(rects_[i], pending)) {
+                pending = pending.united(rects_[i]);
+                rects_[i] = rects_.back();
+                rects_.pop_back();
+                merged = true;
+                break;
+            }
+        }
+    }
+    rects_.push_back(pending);
+
+    if (rects_.size() > kMaxRects) {
+        // Fold together the pair whose union adds the least uncovered area.
+        std::size_t bestA = 0, bestB = 1;
+        long long bestCost = -1;
+        for (std::size_t a = 0; a < rects_.size(); ++a) {
+            for (std::size_t b = a + 1; b < rects_.size(); ++b) {
+                long long cost = rects_[a].united(rects_[b]).area() - rects_[a].area() - rects_[b].area();
+                if (bestCost < 0 || cost < bestCost) {
+                    bestCost = cost;
+                    bestA = a;
+                    bestB = b;
+                }
+            }
+        }
+        ZincX::ZRect combined = rects_[bestA].united(rects_[bestB]);
+        rects_[bestB] = rects_.back();
+        rects_.pop_back();
+        rects_[bestA] = rects_.back();
+        rects_.pop_back();
+        add(combined);
+    }
+}
+
+bool ZDamageRegion::intersects(const ZincX::ZRect& rect) const {
+    for (const auto& r : rects_) {
+        if (r.intersects(rect)) return true;
+    }
+    return false;
+}
+
+ZincX::ZRect ZDamageRegion::bounds() const {
+    ZincX::ZRect result{0, 0, 0, 0};
+    for (const auto& r : rects_) {
+        result = result.united(r);
+    }
+    return result;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file ZDamageRegion.h
+ * @brief Defines the damage region used for partial redraws in the ZincX graphics subsystem.
+ *
+ * This file contains the ZDamageRegion class, which accumulates invalidated rectangles between
+ * frames. Overlapping or nearly adjacent rectangles are merged so the region stays a short list
+ * that ZGraphicsView can clip against and cull items with.
+ */
+#pragma once
+#include "../common/ZCommon.h"
+#include <cstddef>
+#include <vector>
+
+class ZDamageRegion {
+public:
+    /** @brief Maximum number of disjoint rectangles kept before the closest pair is merged. */
+    static constexpr std::size_t kMaxRects = 8;
+
+    /**
+     * @brief Adds a rectangle to the region, merging it with existing rectangles where cheap.
+     * @param rect The damaged area; empty rectangles are ignored.
+     */
+    void add(const ZincX::ZRect& rect);
+
+    void clear() { rects_.clear(); }
+    bool isEmpty() const { return rects_.empty(); }
+
+    /** @brief Returns true if any rectangle of the region overlaps the given one. */
+    bool intersects(const ZincX::ZRect& rect) const;
+
+    /** @brief Returns the bounding rectangle of the whole region. */
+    ZincX::ZRect bounds() const;
+
+    const std::vector<ZincX::ZRect>& rects() const { return rects_; }
+
+private:
+    std::vector<ZincX::ZRect> rects_;
+};
@@ -0,0 +1,325 @@
+/**
+ * @file ZDrawList.cpp
+ * @brief Implementation of the ZDrawList class for the ZincX graphics subsystem.
+ *
+ * Recording appends fixed-size commands and copies variable payloads into shared pools. The
+ * state sort is a stable sort over short runs of mutually non-overlapping commands, which is
+ * the largest reordering that cannot change which primitive ends up on top.
+ */
+#include "ZDrawList.h"
+#include "IZGraphicsBackend.h"
+#include "ZLayerCache.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+void ZDrawList::clear() {
+    commands_.clear();
+    points_.clear();
+    text_.clear();
+    layers_.clear();
+}
+
+ZDrawCommand& ZDrawList::push(ZDrawOp op, const ZincX::ZColor& color) {
+    ZDrawCommand cmd{};
+    cmd.op = op;
+    cmd.color = color.packed();
+    commands_.push_back(cmd);
+    return commands_.back();
+}
+
+void ZDrawList::setClip(const ZincX::ZRect& clip) {
+    push(ZDrawOp::SetClip, ZincX::ZColor(0, 0, 0, 0)).rect = clip;
+}
+
+void ZDrawList::fillRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) {
+    push(ZDrawOp::FillRect, color).rect = rect;
+}
+
+void ZDrawList::drawRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) {
+    push(ZDrawOp::DrawRect, color).rect = rect;
+}
+
+void ZDrawList::drawLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, const ZincX::ZColor& color) {
+    push(ZDrawOp::DrawLine, color).rect = { start.x, start.y, end.x, end.y };
+}
+
+void ZDrawList::drawCircle(const ZincX::ZPoint& center, int radius, const ZincX::ZColor& color, bool filled) {
+    ZDrawCommand& cmd = push(ZDrawOp::DrawCircle, color);
+    cmd.rect = { center.x, center.y, radius, 0 };
+    cmd.filled = filled;
+}
+
+void ZDrawList::drawEllipse(const ZincX::ZPoint& center, int width, int height, const ZincX::ZColor& color, bool filled) {
+    ZDrawCommand& cmd = push(ZDrawOp::DrawEllipse, color);
+    cmd.rect = { center.x, center.y, width, height };
+    cmd.filled = filled;
+}
+
+void ZDrawList::drawPolygon(const ZincX::ZPoint* points, std::size_t count, const ZincX::ZColor& color, bool filled) {
+    ZDrawCommand& cmd = push(ZDrawOp::DrawPolygon, color);
+    cmd.data = static_cast<std::uint32_t>(points_.size());
+    cmd.count = static_cast<std::uint32_t>(count);
+    cmd.filled = filled;
+    points_.insert(points_.end(), points, points + count);
+}
+
+void ZDrawList::drawText(std::string_view text, const ZincX::ZRect& bounds, const ZincX::ZColor& color, ZincX::TextAlignment alignment) {
+    ZDrawCommand& cmd = push(ZDrawOp::DrawText, color);
+    cmd.rect = bounds;
+    cmd.align = static_cast<std::uint8_t>(alignment);
+    cmd.data = static_cast<std::uint32_t>(text_.size());
+    cmd.count = static_cast<std::uint32_t>(text.size());
+    text_.insert(text_.end(), text.begin(), text.end());
+}
+
+void ZDrawList::drawLayer(ZLayerCache& layer, const ZincX::ZPoint& at) {
+    ZDrawCommand& cmd = push(ZDrawOp::DrawLayer, ZincX::ZColor(0, 0, 0));
+    cmd.rect = { at.x, at.y, layer.area().width, layer.area().height };
+    cmd.data = static_cast<std::uint32_t>(layers_.size());
+    layers_.push_back(&layer);
+}
+
+ZincX::ZRect ZDrawList::bounds(const ZDrawCommand& cmd) const {
+    const ZincX::ZRect& r = cmd.rect;
+    switch (cmd.op) {
+        case ZDrawOp::SetClip:
+        case ZDrawOp::FillRect:
+        case ZDrawOp::DrawRect:
+        case ZDrawOp::DrawText:
+        case ZDrawOp::DrawLayer:
+            return r;
+        case ZDrawOp::DrawLine:
+            return { std::min(r.x, r.width), std::min(r.y, r.height),
+                     std::abs(r.width - r.x) + 1, std::abs(r.height - r.y) + 1 };
+        case ZDrawOp::DrawCircle:
+            return { r.x - r.width, r.y - r.width, r.width * 2 + 1, r.width * 2 + 1 };
+        case ZDrawOp::DrawEllipse:
+            return { r.x - r.width / 2, r.y - r.height / 2, r.width + 1, r.height + 1 };
+        case ZDrawOp::DrawPolygon: {
+            if (cmd.count == 0) return { 0, 0, 0, 0 };
+            const ZincX::ZPoint* p = points(cmd);
+            int x0 = p[0].x, y0 = p[0].y, x1 = p[0].x, y1 = p[0].y;
+            for (std::uint32_t i = 1; i < cmd.count; ++i) {
+                x0 = std::min(x0, p[i].x); x1 = std::max(x1, p[i].x);
+                y0 = std::min(y0, p[i].y); y1 = std::max(y1, p[i].y);
+            }
+            return { x0, y0, x1 - x0 + 1, y1 - y0 + 1 };
+        }
+    }
+    return r;
+}
+
+void ZDrawList::append(const ZDrawList& other) {
+    const auto pointBase = static_cast<std::uint32_t>(points_.size());
+    const auto textBase = static_cast<std::uint32_t>(text_.size());
+    const auto layerBase = static_cast<std::uint32_t>(layers_.size());
+    std::size_t first = commands_.size();
+    commands_.insert(commands_.end(), other.commands_.begin(), other.commands_.end());
+    points_.insert(points_.end(), other.points_.begin(), other.points_.end());
+    text_.insert(text_.end(), other.text_.begin(), other.text_.end());
+    layers_.insert(layers_.end(), other.layers_.begin(), other.layers_.end());
+    for (std::size_t i = first; i < commands_.size(); ++i) {
+        ZDrawCommand& cmd = commands_[i];
+        if (cmd.op == ZDrawOp::DrawPolygon) cmd.data += pointBase;
+        else if (cmd.op == ZDrawOp::DrawText) cmd.data += textBase;
+        else if (cmd.op == ZDrawOp::DrawLayer) cmd.data += layerBase;
+    }
+}
+
+void ZDrawList::appendRange(const ZDrawList& other, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+        ZDrawCommand cmd = other.commands_[i];
+        if (cmd.op == ZDrawOp::DrawPolygon) {
+            const ZincX::ZPoint* p = other.points(cmd);
+            cmd.data = static_cast<std::uint32_t>(points_.size());
+            points_.insert(points_.end(), p, p + cmd.count);
+        } else if (cmd.op == ZDrawOp::DrawText) {
+            const std::string_view t = other.text(cmd);
+            cmd.data = static_cast<std::uint32_t>(text_.size());
+            text_.insert(text_.end(), t.begin(), t.end());
+        } else if (cmd.op == ZDrawOp::DrawLayer) {
+            cmd.data = static_cast<std::uint32_t>(layers_.size());
+            layers_.push_back(other.layers_[other.commands_[i].data]);
+        }
+        commands_.push_back(cmd);
+    }
+}
+
+namespace {
+    /** Segments used to approximate an ellipse that a rotation or shear turned into a polygon. */
+    constexpr int kEllipseSegments = 32;
+
+    /** Maps a rectangle by rounding its corners, so abutting rectangles stay abutting. */
+    ZincX::ZRect mapArea(const ZincX::ZMatrix& m, const ZincX::ZRect& r) {
+        const ZincX::ZPoint a = m.map({ r.x, r.y });
+        const ZincX::ZPoint b = m.map({ r.x + r.width, r.y + r.height });
+        return { std::min(a.x, b.x), std::min(a.y, b.y), std::abs(b.x - a.x), std::abs(b.y - a.y) };
+    }
+
+    int scaled(int length, float factor) {
+        return static_cast<int>(std::lround(length * std::fabs(factor)));
+    }
+}
+
+void ZDrawList::append(const ZDrawList& other, const ZincX::ZMatrix& transform) {
+    if (transform.isTranslation()) {
+        const std::size_t first = commands_.size();
+        append(other);
+        if (transform.isIdentity()) return;
+        const ZincX::ZPoint offset = transform.map({ 0, 0 });
+        for (std::size_t i = first; i < commands_.size(); ++i) {
+            ZDrawCommand& cmd = commands_[i];
+            cmd.rect.x += offset.x;
+            cmd.rect.y += offset.y;
+            if (cmd.op == ZDrawOp::DrawLine) {
+                cmd.rect.width += offset.x;
+                cmd.rect.height += offset.y;
+            } else if (cmd.op == ZDrawOp::DrawPolygon) {
+                for (std::uint32_t p = 0; p < cmd.count; ++p) {
+                    points_[cmd.data + p].x += offset.x;
+                    points_[cmd.data + p].y += offset.y;
+                }
+            }
+        }
+        return;
+    }
+
+    // A layer's raster can only be moved, so other transformations draw its commands instead.
+    std::size_t begin = 0;
+    for (std::size_t i = 0; i < other.commands_.size(); ++i) {
+        const ZDrawCommand& cmd = other.commands_[i];
+        if (cmd.op != ZDrawOp::DrawLayer) continue;
+        const std::size_t segment = commands_.size();
+        appendRange(other, begin, i);
+        mapCommands(segment, transform);
+        const ZLayerCache& layer = other.layer(cmd);
+        append(layer.commands(), transform * ZincX::ZMatrix::translation(static_cast<float>(cmd.rect.x - layer.area().x),
+                                                                          static_cast<float>(cmd.rect.y - layer.area().y)));
+        begin = i + 1;
+    }
+    const std::size_t segment = commands_.size();
+    appendRange(other, begin, other.commands_.size());
+    mapCommands(segment, transform);
+}
+
+void ZDrawList::mapCommands(std::size_t first, const ZincX::ZMatrix& transform) {
+    const bool axisAligned = transform.isAxisAligned();
+    for (std::size_t i = first; i < commands_.size(); ++i) {
+        ZDrawCommand& cmd = commands_[i];
+        ZincX::ZRect& r = cmd.rect;
+        switch (cmd.op) {
+            case ZDrawOp::SetClip:
+                // Clips stay axis-aligned: a rotated clip becomes its bounding box.
+                r = axisAligned ? mapArea(transform, r) : transform.mapRect(r);
+                break;
+            case ZDrawOp::DrawText:
+                // Glyphs are neither scaled nor rotated; the text is laid out in its mapped box.
+                r = axisAligned ? mapArea(transform, r) : transform.mapRect(r);
+                break;
+            case ZDrawOp::FillRect:
+            case ZDrawOp::DrawRect:
+                if (axisAligned) {
+                    r = mapArea(transform, r);
+                } else {
+                    // Fills cover [x, x + width); outlines run through the edge pixels' centers.
+                    const int inset = cmd.op == ZDrawOp::DrawRect ? 1 : 0;
+                    const ZincX::ZPoint corners[4] = { { r.x, r.y }, { r.x + r.width - inset, r.y },
+                                                       { r.x + r.width - inset, r.y + r.height - inset },
+                                                       { r.x, r.y + r.height - inset } };
+                    cmd.filled = cmd.op == ZDrawOp::FillRect;
+                    cmd.op = ZDrawOp::DrawPolygon;
+                    cmd.data = static_cast<std::uint32_t>(points_.size());
+                    cmd.count = 4;
+                    for (const ZincX::ZPoint& corner : corners) points_.push_back(transform.map(corner));
+                }
+                break;
+            case ZDrawOp::DrawLine: {
+                const ZincX::ZPoint start = transform.map({ r.x, r.y });
+                const ZincX::ZPoint end = transform.map({ r.width, r.height });
+                r = { start.x, start.y, end.x, end.y };
+                break;
+            }
+            case ZDrawOp::DrawCircle:
+            case ZDrawOp::DrawEllipse: {
+                const bool circle = cmd.op == ZDrawOp::DrawCircle;
+                const int width = circle ? r.width * 2 : r.width;
+                const int height = circle ? r.width * 2 : r.height;
+                const ZincX::ZPoint center = transform.map({ r.x, r.y });
+                if (axisAligned) {
+                    cmd.op = ZDrawOp::DrawEllipse;
+                    r = { center.x, center.y, scaled(width, transform.m[0][0]), scaled(height, transform.m[1][1]) };
+                    break;
+                }
+                cmd.op = ZDrawOp::DrawPolygon;
+                cmd.data = static_cast<std::uint32_t>(points_.size());
+                cmd.count = kEllipseSegments;
+                for (int k = 0; k < kEllipseSegments; ++k) {
+                    const float angle = 6.2831853f * static_cast<float>(k) / kEllipseSegments;
+                    const float x = static_cast<float>(r.x) + 0.5f * width * std::cos(angle);
+                    const float y = static_cast<float>(r.y) + 0.5f * height * std::sin(angle);
+                    points_.push_back({ static_cast<int>(std::lround(transform.mapX(x, y))),
+                                        static_cast<int>(std::lround(transform.mapY(x, y))) });
+                }
+                break;
+            }
+            case ZDrawOp::DrawPolygon:
+                for (std::uint32_t p = 0; p < cmd.count; ++p) points_[cmd.data + p] = transform.map(points_[cmd.data + p]);
+                break;
+            case ZDrawOp::DrawLayer:
+                break; // Never in a mapped range; append() expands layers first.
+        }
+    }
+}
+
+void ZDrawList::sortByState() {
+    auto stateLess = [](const ZDrawCommand& a, const ZDrawCommand& b) {
+        if (a.op != b.op) return a.op < b.op;
+        return a.color.value < b.color.value;
+    };
+
+    std::size_t begin = 0;
+    while (begin < commands_.size()) {
+        // Grow a batch of mutually non-overlapping commands starting at begin.
+        scratchBounds_.clear();
+        std::size_t end = begin;
+        while (end < commands_.size() && scratchBounds_.size() < kMaxBatch) {
+            const ZDrawCommand& cmd = commands_[end];
+            if (cmd.op == ZDrawOp::SetClip) break;
+            ZincX::ZRect b = bounds(cmd);
+            bool overlaps = std::any_of(scratchBounds_.begin(), scratchBounds_.end(),
+                                        [&b](const ZincX::ZRect& other) { return other.intersects(b); });
+            if (overlaps) break;
+            scratchBounds_.push_back(b);
+            ++end;
+        }
+        if (end - begin > 1) {
+            std::stable_sort(commands_.begin() + static_cast<std::ptrdiff_t>(begin),
+                             commands_.begin() + static_cast<std::ptrdiff_t>(end), stateLess);
+        }
+        // A SetClip (or a lone overlapping command) forms its own batch.
+        begin = end == begin ? end + 1 : end;
+    }
+}
+
+void ZDrawList::replay(IZGraphicsBackend& backend) const {
+    std::vector<ZincX::ZPoint> polygon;
+    for (const ZDrawCommand& cmd : commands_) {
+        ZincX::ZColor color(cmd.color);
+        const ZincX::ZRect& r = cmd.rect;
+        switch (cmd.op) {
+            case ZDrawOp::SetClip: backend.setClipRect(r); break;
+            case ZDrawOp::FillRect: backend.fillRect(r, color); break;
+            case ZDrawOp::DrawRect: backend.drawRect(r, color); break;
+            case ZDrawOp::DrawLine: backend.drawLine({ r.x, r.y }, { r.width, r.height }, color); break;
+            case ZDrawOp::DrawCircle: backend.drawCircle({ r.x, r.y }, r.width, color, cmd.filled != 0); break;
+            case ZDrawOp::DrawEllipse: backend.drawEllipse({ r.x, r.y }, r.width, r.height, color, cmd.filled != 0); break;
+            case ZDrawOp::DrawPolygon:
+                polygon.assign(points(cmd), points(cmd) + cmd.count);
+                backend.drawPolygon(polygon, color, cmd.filled != 0);
+                break;
+            case ZDrawOp::DrawText: backend.drawText(std::string(text(cmd)), r, color, cmd.alignment()); break;
+            case ZDrawOp::DrawLayer: backend.drawLayer(layer(cmd), { r.x, r.y }); break;
+        }
+    }
+}
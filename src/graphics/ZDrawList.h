@@ -0,0 +1,150 @@
+/**
+ * @file ZDrawList.h
+ * @brief Defines the retained draw-command list shared by items, views and backends in ZincX.
+ *
+ * This file contains ZDrawCommand, a fixed-size POD record for one drawing primitive, and
+ * ZDrawList, a buffer of such records plus the text and point pools they reference. Items record
+ * into a list once and replay the cached commands until their content changes; the view gathers
+ * those spans into one frame list, reorders it by state and hands it to the backend in a single
+ * IZGraphicsBackend::submit() call.
+ */
+#pragma once
+#include "../common/ZCommon.h"
+#include "../common/ZCommonEnums.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+class IZGraphicsBackend;
+class ZLayerCache;
+
+/**
+ * @brief Identifies the primitive a ZDrawCommand encodes.
+ *
+ * The enumerator order is also the batching order used by ZDrawList::sortByState().
+ */
+enum class ZDrawOp : std::uint8_t {
+    SetClip,     ///< rect = new clip rectangle; always a batch barrier.
+    FillRect,    ///< rect = area.
+    DrawRect,    ///< rect = outline.
+    DrawLine,    ///< rect.x/y = start, rect.width/height = end point.
+    DrawCircle,  ///< rect.x/y = center, rect.width = radius.
+    DrawEllipse, ///< rect.x/y = center, rect.width/height = diameters.
+    DrawPolygon, ///< data/count = range in the point pool.
+    DrawText,    ///< rect = bounds, data/count = range in the text pool.
+    DrawLayer    ///< rect = destination of the layer's area, data = index in the layer pool.
+};
+
+/**
+ * @brief A single recorded drawing primitive.
+ *
+ * Commands are 32 bytes, trivially copyable and reference variable-size payloads (polygon
+ * points, text) by index so whole lists can be copied, sorted or uploaded with memcpy.
+ */
+struct ZDrawCommand {
+    ZDrawOp op;                  ///< Primitive type.
+    std::uint8_t filled;         ///< Non-zero for filled circles, ellipses and polygons.
+    std::uint8_t align;          ///< ZincX::TextAlignment for DrawText, stored as a byte.
+    std::uint8_t reserved;       ///< Padding; keeps color 4-byte aligned.
+    ZincX::ZColor32 color;       ///< Packed 0xAARRGGBB color.
+    ZincX::ZRect rect;           ///< Geometry; meaning depends on op.
+    std::uint32_t data;          ///< First index into the list's point or text pool.
+    std::uint32_t count;         ///< Number of points or characters.
+
+    ZincX::TextAlignment alignment() const { return static_cast<ZincX::TextAlignment>(align); }
+};
+
+static_assert(std::is_trivially_copyable_v<ZDrawCommand>, "ZDrawCommand must stay POD");
+static_assert(sizeof(ZDrawCommand) == 32, "ZDrawCommand layout changed");
+
+class ZDrawList {
+public:
+    void clear();
+    bool empty() const { return commands_.empty(); }
+    std::size_t size() const { return commands_.size(); }
+
+    const std::vector<ZDrawCommand>& commands() const { return commands_; }
+    const ZDrawCommand& operator[](std::size_t i) const { return commands_[i]; }
+
+    void setClip(const ZincX::ZRect& clip);
+    void fillRect(const ZincX::ZRect& rect, const ZincX::ZColor& color);
+    void drawRect(const ZincX::ZRect& rect, const ZincX::ZColor& color);
+    void drawLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, const ZincX::ZColor& color);
+    void drawCircle(const ZincX::ZPoint& center, int radius, const ZincX::ZColor& color, bool filled);
+    void drawEllipse(const ZincX::ZPoint& center, int width, int height, const ZincX::ZColor& color, bool filled);
+    void drawPolygon(const ZincX::ZPoint* points, std::size_t count, const ZincX::ZColor& color, bool filled);
+    void drawText(std::string_view text, const ZincX::ZRect& bounds, const ZincX::ZColor& color, ZincX::TextAlignment alignment);
+
+    /** @brief Records a reference to a cached layer; the layer must outlive the list's use. */
+    void drawLayer(ZLayerCache& layer, const ZincX::ZPoint& at);
+
+    /** @brief Returns the polygon points referenced by a DrawPolygon command. */
+    const ZincX::ZPoint* points(const ZDrawCommand& cmd) const { return points_.data() + cmd.data; }
+
+    /** @brief Returns the string referenced by a DrawText command. */
+    std::string_view text(const ZDrawCommand& cmd) const { return { text_.data() + cmd.data, cmd.count }; }
+
+    /** @brief Returns the layer referenced by a DrawLayer command. */
+    ZLayerCache& layer(const ZDrawCommand& cmd) const { return *layers_[cmd.data]; }
+
+    /**
+     * @brief Returns the area a command can touch, used to decide which commands may be reordered.
+     * @param cmd A command of this list.
+     */
+    ZincX::ZRect bounds(const ZDrawCommand& cmd) const;
+
+    /**
+     * @brief Appends every command of another list, rebasing its pool references.
+     * @param other The list to copy from, typically an item's cached commands.
+     */
+    void append(const ZDrawList& other);
+
+    /**
+     * @brief Appends every command of another list mapped through a transformation.
+     *
+     * Translations only offset the geometry. Under scaling, shapes are resized but strokes stay
+     * one pixel wide; under rotation or shear, rectangles and ellipses become polygons. Text and
+     * clip rectangles cannot rotate and use their mapped bounding boxes, and glyphs keep their size.
+     * Cached layers are only moved by translations; any other transformation draws their commands.
+     *
+     * @param other The list to copy from, typically an item's cached commands.
+     * @param transform Maps @p other's coordinates to this list's.
+     */
+    void append(const ZDrawList& other, const ZincX::ZMatrix& transform);
+
+    /**
+     * @brief Groups commands by primitive type and color without changing the rendered result.
+     *
+     * The list is cut into batches at every SetClip and whenever a command overlaps one already
+     * in the current batch; only commands inside a batch are reordered, so painter's order is
+     * preserved wherever it matters.
+     */
+    void sortByState();
+
+    /**
+     * @brief Issues every command as an individual primitive call on a backend.
+     *
+     * This is the default IZGraphicsBackend::submit() path for backends without a batched one.
+     */
+    void replay(IZGraphicsBackend& backend) const;
+
+private:
+    /** Upper bound on commands per reorder batch; keeps the overlap test linear. */
+    static constexpr std::size_t kMaxBatch = 32;
+
+    ZDrawCommand& push(ZDrawOp op, const ZincX::ZColor& color);
+
+    /** @brief Copies commands [begin, end) of another list, along with only the payloads they use. */
+    void appendRange(const ZDrawList& other, std::size_t begin, std::size_t end);
+
+    /** @brief Maps the commands from @p first on through a transformation that is not a translation. */
+    void mapCommands(std::size_t first, const ZincX::ZMatrix& transform);
+
+    std::vector<ZDrawCommand> commands_;
+    std::vector<ZincX::ZPoint> points_;
+    std::vector<char> text_;
+    std::vector<ZLayerCache*> layers_;
+    std::vector<ZincX::ZRect> scratchBounds_;
+};
@@ -0,0 +1,40 @@
+/**
+ * @file ZDrawRecorder.h
+ * @brief Defines a backend adapter that records primitives into a ZDrawList.
+ *
+ * This file contains the ZDrawRecorder class. It implements IZGraphicsBackend so existing
+ * ZGraphicsItem::draw() implementations record into a retained command list without changes;
+ * the virtual call per primitive is paid once when an item's content changes, not every frame.
+ */
+#pragma once
+#include "IZGraphicsBackend.h"
+#include "ZDrawList.h"
+
+class ZDrawRecorder : public IZGraphicsBackend {
+public:
+    /**
+     * @brief Constructs a recorder.
+     * @param list The list that receives the recorded commands.
+     * @param surface The surface size reported to items that query it.
+     */
+    ZDrawRecorder(ZDrawList& list, ZincX::ZSize surface) : list_(list), surface_(surface) {}
+
+    void initialize(ZincX::RenderMode) override {}
+    ZincX::ZSize surfaceSize() const override { return surface_; }
+
+    /** @brief Ignored: clipping is owned by the view, which brackets item spans with SetClip. */
+    void setClipRect(const ZincX::ZRect&) override {}
+
+    void fillRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) override { list_.fillRect(rect, color); }
+    void drawRect(const ZincX::ZRect& rect, const ZincX::ZColor& color) override { list_.drawRect(rect, color); }
+    void drawLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, const ZincX::ZColor& color) override { list_.drawLine(start, end, color); }
+    void drawCircle(const ZincX::ZPoint& center, int radius, const ZincX::ZColor& color, bool filled = true) override { list_.drawCircle(center, radius, color, filled); }
+    void drawEllipse(const ZincX::ZPoint& center, int width, int height, const ZincX::ZColor& color, bool filled = true) override { list_.drawEllipse(center, width, height, color, filled); }
+    void drawPolygon(const std::vector<ZincX::ZPoint>& points, const ZincX::ZColor& color, bool filled = true) override { list_.drawPolygon(points.data(), points.size(), color, filled); }
+    void drawText(const std::string& text, const ZincX::ZRect& bounds, const ZincX::ZColor& color, ZincX::TextAlignment alignment = ZincX::TextAlignment::Center) override { list_.drawText(text, bounds, color, alignment); }
+    void drawLayer(ZLayerCache& layer, const ZincX::ZPoint& at) override { list_.drawLayer(layer, at); }
+
+private:
+    ZDrawList& list_;
+    ZincX::ZSize surface_;
+};
@@ -0,0 +1,97 @@
+/**
+ * @file ZGlyphAtlas.h
+ * @brief Defines the glyph atlas used by the ZincX text renderers.
+ *
+ * This file contains ZGlyphAtlas, an 8-bit coverage texture into which glyphs are rasterized
+ * once, keyed by (font, pixel size, FontWeight, codepoint), and then drawn by copying their atlas
+ * rectangle. Glyphs are packed on shelves. When the atlas fills up it is cleared and its
+ * generation() advances, which tells holders of atlas rectangles (ZTextRunCache) to re-resolve
+ * them. The coverage layout is what a GPU backend would upload as a single-channel texture.
+ */
+#pragma once
+#include "../common/ZCommon.h"
+#include "../common/ZCommonEnums.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+/** @brief Identifies a font face at one size and weight. */
+struct ZFontKey {
+    std::uint32_t font = 0;          ///< Application-assigned face id; 0 is the built-in font.
+    std::uint16_t pixelSize = 8;     ///< Line height in pixels.
+    ZincX::FontWeight weight = ZincX::FontWeight::Normal;
+
+    bool operator==(const ZFontKey&) const = default;
+};
+
+/** @brief A rasterized glyph as produced by a ZGlyphAtlas::Rasterizer. */
+struct ZGlyphBitmap {
+    int width = 0;
+    int height = 0;
+    int bearingX = 0;                    ///< Offset from the pen position to the bitmap's left edge.
+    int bearingY = 0;                    ///< Offset from the line top to the bitmap's top edge.
+    int advance = 0;                     ///< Pen movement after the glyph.
+    std::vector<std::uint8_t> coverage;  ///< width * height values, row-major, 255 = fully covered.
+};
+
+/** @brief Where a glyph lives in the atlas, plus its metrics. */
+struct ZGlyphSlot {
+    ZincX::ZRect rect;   ///< Atlas rectangle; empty for blank glyphs such as the space.
+    int bearingX;
+    int bearingY;
+    int advance;
+};
+
+class ZGlyphAtlas {
+public:
+    /** @brief Renders one glyph; called once per key until the atlas is cleared. */
+    using Rasterizer = std::function<ZGlyphBitmap(const ZFontKey& font, char32_t codepoint)>;
+
+    /**
+     * @brief Creates an empty atlas.
+     * @param width Atlas width in pixels.
+     * @param height Atlas height in pixels.
+     * @param rasterizer Produces glyph bitmaps on first use.
+     */
+    ZGlyphAtlas(int width, int height, Rasterizer rasterizer);
+
+    /**
+     * @brief Returns a glyph's slot, rasterizing and packing it on first use.
+     *
+     * May clear the atlas to make room, which invalidates every slot obtained earlier; compare
+     * generation() before and after to detect that.
+     */
+    const ZGlyphSlot& glyph(const ZFontKey& font, char32_t codepoint);
+
+    /** @brief Drops every glyph and advances the generation. */
+    void clear();
+
+    /** @brief Incremented by every clear(); atlas rectangles from another generation are stale. */
+    std::uint32_t generation() const { return generation_; }
+
+    int width() const { return width_; }
+    int height() const { return height_; }
+
+    /** @brief Coverage at an atlas position; rows are width() bytes apart. */
+    const std::uint8_t* coverage(int x, int y) const { return &pixels_[static_cast<std::size_t>(y) * width_ + x]; }
+
+    std::size_t glyphCount() const { return slots_.size(); }
+
+private:
+    static std::uint64_t packKey(const ZFontKey& font, char32_t codepoint);
+
+    /** @brief Reserves space on the current or a new shelf. @return False if the atlas is full. */
+    bool allocate(int width, int height, ZincX::ZPoint& at);
+
+    int width_;
+    int height_;
+    Rasterizer rasterizer_;
+    std::vector<std::uint8_t> pixels_;
+    std::unordered_map<std::uint64_t, ZGlyphSlot> slots_;
+    int shelfX_ = 0;
+    int shelfY_ = 0;
+    int shelfHeight_ = 0;
+    std::uint32_t generation_ = 0;
+};
@@ -3,7 +3,217 @@
  * @brief Implementation of the ZGraphicsItem class for the ZincX graphics subsystem.
  *
  * This file provides the implementation details for the ZGraphicsItem class, which serves as the
- * base for all drawable items in the ZincX UI framework. Currently, it includes only the necessary
- * includes, with functionality defined in the header or subclasses.
+ * base for all drawable items in the ZincX UI framework. Geometry and state changes are reported
+ * to the hosting ZGraphicsView as damage so only the affected area is redrawn, and moves keep the scene's spatial index current.
+ * draw() output is cached as a ZDrawList and replayed until the item is invalidated again.
+ * A stale world transformation implies stale descendants, since computing one first computes its
+ * parent's; marking a subtree stale therefore stops at the first item that already is.
  */
 #include "ZGraphicsItem.h"
+#include "ZDrawRecorder.h"
+#include "ZGraphicsScene.h"
+#include "ZGraphicsView.h"
+#include <algorithm>
+
+ZGraphicsItem::~ZGraphicsItem() {
+    for (ZGraphicsItem* child : children_) {
+        // Now top-level: its world transformation loses this item's, and the scene re-files it.
+        child->parent_ = nullptr;
+        child->transformChanged();
+    }
+    setParentItem(nullptr);
+    if (scene_) scene_->removeItem(this);
+}
+
+void ZGraphicsItem::setParentItem(ZGraphicsItem* parent) {
+    if (parent == parent_) return;
+    for (ZGraphicsItem* p = parent; p; p = p->parent_) {
+        if (p == this) throw ZincX::ZException("ZGraphicsItem::setParentItem would create a cycle");
+    }
+    if (parent_) {
+        auto& siblings = parent_->children_;
+        siblings.erase(std::find(siblings.begin(), siblings.end(), this));
+    }
+    parent_ = parent;
+    if (parent_) parent_->children_.push_back(this);
+    transformChanged();
+}
+
+void ZGraphicsItem::setTransform(const ZincX::ZMatrix& transform) {
+    if (transform == transform_) return;
+    transform_ = transform;
+    transformChanged();
+}
+
+void ZGraphicsItem::transformChanged() {
+    if (worldDirty_) return;
+    worldDirty_ = true;
+    if (scene_) scene_->itemTransformed(this);
+    for (ZGraphicsItem* child : children_) child->transformChanged();
+}
+
+const ZincX::ZMatrix& ZGraphicsItem::worldTransform() const {
+    if (worldDirty_) {
+        worldTransform_ = parent_ ? parent_->worldTransform() * transform_ : transform_;
+        worldBounds_ = worldTransform_.mapRect(bounds_);
+        worldDirty_ = false;
+    }
+    return worldTransform_;
+}
+
+const ZincX::ZRect& ZGraphicsItem::worldBounds() const {
+    worldTransform();
+    return worldBounds_;
+}
+
+bool ZGraphicsItem::containsWorldPoint(const ZincX::ZPoint& point) const {
+    const ZincX::ZMatrix& world = worldTransform();
+    if (world.isIdentity()) return bounds_.contains(point);
+    // Test the pixel's center against the untransformed bounds.
+    const ZincX::ZMatrix local = world.inverted();
+    const float cx = static_cast<float>(point.x) + 0.5f;
+    const float cy = static_cast<float>(point.y) + 0.5f;
+    const float x = local.mapX(cx, cy);
+    const float y = local.mapY(cx, cy);
+    return x >= static_cast<float>(bounds_.x) && x < static_cast<float>(bounds_.x + bounds_.width) &&
+           y >= static_cast<float>(bounds_.y) && y < static_cast<float>(bounds_.y + bounds_.height);
+}
+
+void ZGraphicsItem::setBounds(const ZincX::ZRect& bounds) {
+    if (bounds == bounds_) return;
+    invalidate();
+    bounds_ = bounds;
+    if (!worldDirty_) worldBounds_ = worldTransform_.mapRect(bounds_);
+    if (scene_) scene_->itemMoved(this);
+    invalidate();
+    boundsChanged();
+}
+
+void ZGraphicsItem::setState(ZincX::WidgetState state) {
+    if (state == state_) return;
+    state_ = state;
+    invalidate();
+}
+
+void ZGraphicsItem::setClipsToBounds(bool clip) {
+    if (clip == clipsToBounds_) return;
+    clipsToBounds_ = clip;
+    invalidate();
+}
+
+void ZGraphicsItem::setZValue(int z) {
+    if (z == zValue_) return;
+    zValue_ = z;
+    if (scene_) scene_->itemReordered(this);
+}
+
+void ZGraphicsItem::invalidate() {
+    commandsDirty_ = true;
+    if (scene_) scene_->invalidate(worldBounds());
+}
+
+void ZGraphicsItem::invalidate(const ZincX::ZRect& rect) {
+    commandsDirty_ = true;
+    if (scene_) scene_->invalidate(worldTransform().mapRect(rect.intersected(bounds_)));
+}
+
+ZGraphicsViewBase* ZGraphicsItem::view() const {
+    return scene_ ? scene_->view() : nullptr;
+}
+
+void ZGraphicsItem::setLayerCached(ZincX::StyleLayer layer, bool cached) {
+    std::unique_ptr<ZLayerCache>& cache = layerCaches_[static_cast<std::size_t>(layer)];
+    if (cached == (cache != nullptr)) return;
+    cache = cached ? std::make_unique<ZLayerCache>() : nullptr;
+    invalidate();
+}
+
+void ZGraphicsItem::drawLayers(IZGraphicsBackend* backend) {
+    for (ZincX::StyleLayer layer : { ZincX::StyleLayer::Background, ZincX::StyleLayer::Midground, ZincX::StyleLayer::Foreground }) {
+        ZLayerCache* cache = layerCaches_[static_cast<std::size_t>(layer)].get();
+        if (!cache) {
+            paintLayer(backend, layer);
+            continue;
+        }
+        cache->update(bounds_, layerKey(layer), [this, layer](IZGraphicsBackend& recorder) { paintLayer(&recorder, layer); });
+        backend->drawLayer(*cache, { bounds_.x, bounds_.y });
+    }
+}
+
+void ZGraphicsItem::invalidateLayer(ZincX::StyleLayer layer) {
+    if (ZLayerCache* cache = layerCaches_[static_cast<std::size_t>(layer)].get()) cache->invalidate();
+    invalidate();
+}
+
+void ZGraphicsItem::paintLayer(IZGraphicsBackend*, ZincX::StyleLayer) {}
+
+std::uint64_t ZGraphicsItem::layerKey(ZincX::StyleLayer) const {
+    return static_cast<std::uint64_t>(state_);
+}
+
+void ZGraphicsItem::saveProperty(std::uint32_t id, ZByteWriter& out) const {
+    switch (id) {
+    case BoundsProperty:
+        out.i32(bounds_.x);
+        out.i32(bounds_.y);
+        out.i32(bounds_.width);
+        out.i32(bounds_.height);
+        break;
+    case ZValueProperty:
+        out.i32(zValue_);
+        break;
+    case StateProperty:
+        out.u8(static_cast<std::uint8_t>(state_));
+        break;
+    case TransformProperty:
+        for (int row = 0; row < 2; ++row) {
+            for (int column = 0; column < 3; ++column) out.f32(transform_.m[row][column]);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void ZGraphicsItem::loadProperty(std::uint32_t id, ZByteReader& in) {
+    switch (id) {
+    case BoundsProperty: {
+        ZincX::ZRect bounds;
+        bounds.x = in.i32();
+        bounds.y = in.i32();
+        bounds.width = in.i32();
+        bounds.height = in.i32();
+        setBounds(bounds);
+        break;
+    }
+    case ZValueProperty:
+        setZValue(in.i32());
+        break;
+    case StateProperty: {
+        const std::uint8_t state = in.u8();
+        if (state > static_cast<std::uint8_t>(ZincX::WidgetState::Disabled)) throw ZincX::ZException("ZGraphicsItem: invalid widget state");
+        setState(static_cast<ZincX::WidgetState>(state));
+        break;
+    }
+    case TransformProperty: {
+        ZincX::ZMatrix transform;
+        for (int row = 0; row < 2; ++row) {
+            for (int column = 0; column < 3; ++column) transform.m[row][column] = in.f32();
+        }
+        setTransform(transform);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+const ZDrawList& ZGraphicsItem::commands(ZincX::ZSize surface) {
+    if (commandsDirty_) {
+        commands_.clear();
+        ZDrawRecorder recorder(commands_, surface);
+        draw(&recorder);
+        commandsDirty_ = false;
+    }
+    return commands_;
+}
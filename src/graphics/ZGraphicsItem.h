@@ -5,7 +5,239 @@
  * This file contains the foundational ZGraphicsItem class used throughout the ZincX UI framework.
  * It provides the essential interface and properties for rendering graphical elements, including
  * position, size, and state management, serving as a building block for all drawable objects.
+ *
+ * Each item has a local transformation relative to its parent item. An item's bounds and drawing
+ * are in its own coordinates; the world transformation, the product of the local ones from the
+ * top-level item down, maps them into the view. World matrices and world bounds are cached and
+ * only recomputed after a transformation above them changed, so moving a container by changing
+ * its transformation leaves the children's bounds and recorded commands untouched.
+ *
+ * Items may also draw themselves as the three StyleLayer layers through drawLayers(). Any layer
+ * can then be cached with setLayerCached(): it is recorded, and on raster backends rendered, once
+ * and reused until its layerKey() or the item's bounds change, while the other layers are drawn
+ * over it as usual.
+ *
+ * Through IZStateSerializable, every item exposes its bounds, z value, widget state and local
+ * transformation as properties, so ZUndoRedoManager can undo edits to them and ZSceneSerializer
+ * can save and restore them.
  */
 #pragma once
 #include "../common/ZCommon.h"
 #include "../common/ZCommonEnums.h"
+#include "../common/ZPool.h"
+#include "ZDrawList.h"
+#include "ZLayerCache.h"
+#include "../undo/IZStateSerializable.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class IZGraphicsBackend;
+class ZGraphicsScene;
+class ZGraphicsViewBase;
+
+class ZGraphicsItem : public IZStateSerializable {
+public:
+    /** @brief The properties every item has; subclasses number theirs from PropertyCount on. */
+    enum Property : std::uint32_t {
+        BoundsProperty,    ///< Four i32: x, y, width, height.
+        ZValueProperty,    ///< i32.
+        StateProperty,     ///< u8 WidgetState.
+        TransformProperty, ///< Six f32: the top two rows of the local transformation.
+        PropertyCount
+    };
+
+    ~ZGraphicsItem() override;
+
+    /**
+     * @brief Draws the item through the given backend.
+     *
+     * Drawing must stay within bounds(): the view only redraws items whose bounds overlap the
+     * damaged area, so anything painted outside them is never repaired. Items that lay content
+     * out past their bounds on purpose turn on setClipsToBounds().
+     *
+     * @param backend The backend to issue drawing primitives on.
+     */
+    virtual void draw(IZGraphicsBackend* backend) = 0;
+
+    /** @brief Returns the item's rectangle in its own coordinates; see worldBounds() for the view. */
+    const ZincX::ZRect& bounds() const { return bounds_; }
+
+    /**
+     * @brief Moves or resizes the item, damaging both the old and the new area.
+     *
+     * The scene's spatial index is updated incrementally when the item crosses grid cells.
+     */
+    void setBounds(const ZincX::ZRect& bounds);
+
+    ZincX::WidgetState state() const { return state_; }
+
+    /** @brief Changes the widget state, damaging the item if the state actually changed. */
+    void setState(ZincX::WidgetState state);
+
+    /** @brief Returns the transformation from this item's coordinates to its parent's. */
+    const ZincX::ZMatrix& transform() const { return transform_; }
+
+    /**
+     * @brief Changes the local transformation, moving this item and all its descendants.
+     *
+     * Only the subtree is marked stale; its world matrices are recomputed on next use and the
+     * scene re-files it on its next updateTransforms().
+     */
+    void setTransform(const ZincX::ZMatrix& transform);
+
+    /** @brief Returns the transformation from this item's coordinates to the view's. */
+    const ZincX::ZMatrix& worldTransform() const;
+
+    /** @brief Returns the smallest view rectangle containing the transformed bounds. */
+    const ZincX::ZRect& worldBounds() const;
+
+    /** @brief Maps a point from this item's coordinates to the view's. */
+    ZincX::ZPoint mapToWorld(const ZincX::ZPoint& point) const { return worldTransform().map(point); }
+
+    /** @brief Maps a point from the view's coordinates to this item's. */
+    ZincX::ZPoint mapFromWorld(const ZincX::ZPoint& point) const { return worldTransform().inverted().map(point); }
+
+    /** @brief True if a point in view coordinates falls inside the transformed bounds. */
+    bool containsWorldPoint(const ZincX::ZPoint& point) const;
+
+    /**
+     * @brief Marks the whole item as needing a redraw on the next render.
+     *
+     * This also drops the item's cached draw commands, so draw() runs again on the next frame.
+     */
+    void invalidate();
+
+    /**
+     * @brief Marks part of the item as needing a redraw on the next render.
+     *
+     * Like invalidate(), this drops the cached commands; the item is re-recorded in full.
+     * @param rect The damaged area in the item's coordinates; it is clipped to the item's bounds.
+     */
+    void invalidate(const ZincX::ZRect& rect);
+
+    /**
+     * @brief Returns the stacking order; items with a higher value paint above lower ones.
+     *
+     * Items with equal values paint in the order they were added to the scene.
+     */
+    int zValue() const { return zValue_; }
+    void setZValue(int z);
+
+    /** @brief Returns the item this one belongs to, or nullptr for a top-level item. */
+    ZGraphicsItem* parentItem() const { return parent_; }
+
+    /**
+     * @brief Attaches the item to a parent, detaching it from its previous one.
+     *
+     * The parent chain is the path events bubble along and the chain transformations compose
+     * along; it does not own the children. Destroying a parent leaves its children top-level.
+     *
+     * @param parent The new parent, or nullptr to make the item top-level.
+     */
+    void setParentItem(ZGraphicsItem* parent);
+
+    /** @brief Returns the items whose parent is this item, in attach order. */
+    const std::vector<ZGraphicsItem*>& childItems() const { return children_; }
+
+    /** @brief Returns the scene holding this item, or nullptr if it is not in a scene. */
+    ZGraphicsScene* scene() const { return scene_; }
+
+    /** @brief Returns the view showing this item's scene, or nullptr if there is none. */
+    ZGraphicsViewBase* view() const;
+
+    /**
+     * @brief Keeps one layer drawn by drawLayers() in an offscreen cache.
+     *
+     * Worth it for layers that are costly to draw and rarely change, such as themed backgrounds;
+     * a cached layer costs its area in memory per backend format. Disabling frees the cache.
+     */
+    void setLayerCached(ZincX::StyleLayer layer, bool cached);
+    bool isLayerCached(ZincX::StyleLayer layer) const { return layerCaches_[static_cast<std::size_t>(layer)] != nullptr; }
+
+    /**
+     * @brief Has the view clip the item's drawing to its world bounds.
+     *
+     * For items whose content is laid out past their bounds, such as a row cut by the edge of a
+     * scrolled list. The clip breaks the frame's batches on both sides of the item, so leave it
+     * off for items that draw within their bounds anyway.
+     */
+    void setClipsToBounds(bool clip);
+    bool clipsToBounds() const { return clipsToBounds_; }
+
+    /**
+     * @brief Returns the item's retained draw commands, recording them first if stale.
+     *
+     * draw() is only called when the item was invalidated since the last recording; otherwise
+     * the cached command span is returned as is.
+     *
+     * @param surface The surface size reported to draw() through the recorder.
+     */
+    const ZDrawList& commands(ZincX::ZSize surface);
+
+    std::uint32_t propertyCount() const override { return PropertyCount; }
+    void saveProperty(std::uint32_t id, ZByteWriter& out) const override;
+
+    /** @brief Applies a property through its setter, so the change damages and re-files as usual. */
+    void loadProperty(std::uint32_t id, ZByteReader& in) override;
+
+protected:
+    /**
+     * @brief Draws background, midground and foreground in order with paintLayer().
+     *
+     * Items built from layers implement draw() as a call to this.
+     */
+    void drawLayers(IZGraphicsBackend* backend);
+
+    /** @brief Draws one layer; called by drawLayers(), possibly into a cache. The default draws nothing. */
+    virtual void paintLayer(IZGraphicsBackend* backend, ZincX::StyleLayer layer);
+
+    /**
+     * @brief Identifies what a layer looks like; a cached layer is redrawn when this changes.
+     *
+     * The default is the widget state. Items whose layers depend on more, such as a style,
+     * must fold that in.
+     */
+    virtual std::uint64_t layerKey(ZincX::StyleLayer layer) const;
+
+    /** @brief Redraws one layer on the next frame even if its key is unchanged. */
+    void invalidateLayer(ZincX::StyleLayer layer);
+
+    /** @brief Called after setBounds() changed the bounds. The default does nothing. */
+    virtual void boundsChanged() {}
+
+    /** @brief Called after the item was added to or removed from a scene; scene() is already updated. */
+    virtual void sceneChanged() {}
+
+    ZincX::ZRect bounds_{0, 0, 0, 0};
+    ZincX::WidgetState state_ = ZincX::WidgetState::Normal;
+
+private:
+    friend class ZGraphicsScene;
+
+    /** @brief Marks the world transformation of this item and everything below it stale. */
+    void transformChanged();
+
+    int zValue_ = 0;
+    ZGraphicsItem* parent_ = nullptr;
+    std::vector<ZGraphicsItem*> children_;
+    ZDrawList commands_;                       ///< Cached output of the last draw().
+    bool commandsDirty_ = true;                ///< commands_ must be re-recorded.
+    bool clipsToBounds_ = false;
+    ZGraphicsScene* scene_ = nullptr;
+    std::size_t sceneIndex_ = 0;               ///< Position in the scene's item list.
+    std::uint64_t sceneSequence_ = 0;          ///< Insertion order, breaks z ties.
+    ZincX::ZRect sceneCells_{0, 0, 0, 0};      ///< Grid cells the item is filed under.
+    bool inLargeList_ = false;                 ///< Too big for the grid; kept in a side list.
+    mutable std::uint32_t queryStamp_ = 0;     ///< Deduplicates items during rect queries.
+    ZincX::ZPoolBase* pool_ = nullptr;         ///< Scene pool the item was created in, if any.
+    ZincX::ZMatrix transform_;                 ///< Local: item coordinates to parent coordinates.
+    mutable ZincX::ZMatrix worldTransform_;    ///< Cached product of the transforms up the chain.
+    mutable ZincX::ZRect worldBounds_{0, 0, 0, 0};
+    mutable bool worldDirty_ = true;           ///< The two caches above are stale; so is every descendant's.
+    ZincX::ZRect sceneBounds_{0, 0, 0, 0};     ///< World bounds as last filed and damaged by the scene.
+    bool transformPending_ = false;            ///< Queued for the scene's next updateTransforms().
+    std::array<std::unique_ptr<ZLayerCache>, 3> layerCaches_; ///< Per StyleLayer; null if not cached.
+};
@@ -0,0 +1,238 @@
+/**
+ * @file ZGraphicsScene.cpp
+ * @brief Implementation of the ZGraphicsScene class for the ZincX graphics subsystem.
+ *
+ * Items are bucketed into every grid cell their world bounds overlap. Each item remembers the cell
+ * range it was filed under, so a move only touches the buckets it leaves and enters, and its
+ * index in items_, so removal is a swap-and-pop. Rectangle queries deduplicate items that span
+ * several cells with a per-query stamp rather than a temporary set.
+ */
+#include "ZGraphicsScene.h"
+#include "ZGraphicsItem.h"
+#include "ZGraphicsView.h"
+#include <algorithm>
+
+namespace {
+    int floorDiv(int value, int divisor) {
+        int q = value / divisor;
+        return (value % divisor != 0 && value < 0) ? q - 1 : q;
+    }
+
+    void eraseFrom(std::vector<ZGraphicsItem*>& bucket, ZGraphicsItem* item) {
+        auto it = std::find(bucket.begin(), bucket.end(), item);
+        if (it != bucket.end()) {
+            *it = bucket.back();
+            bucket.pop_back();
+        }
+    }
+}
+
+ZGraphicsScene::ZGraphicsScene(int cellSize)
+    : cellSize_(cellSize > 0 ? cellSize : 1) {}
+
+ZGraphicsScene::~ZGraphicsScene() {
+    for (auto* item : items_) {
+        item->scene_ = nullptr;
+    }
+    pools_.clear();
+}
+
+void ZGraphicsScene::addItem(ZGraphicsItem* item) {
+    if (item->scene_ == this) return;
+    if (item->scene_) item->scene_->removeItem(item);
+
+    item->scene_ = this;
+    item->sceneIndex_ = items_.size();
+    item->sceneSequence_ = nextSequence_++;
+    items_.push_back(item);
+    insertIntoIndex(item);
+    item->invalidate();
+    item->sceneChanged();
+}
+
+void ZGraphicsScene::removeItem(ZGraphicsItem* item) {
+    if (item->scene_ != this) return;
+
+    if (item->transformPending_) {
+        eraseFrom(transformed_, item);
+        item->transformPending_ = false;
+        invalidate(item->sceneBounds_);
+    }
+    item->invalidate();
+    removeFromIndex(item);
+    ZGraphicsItem* last = items_.back();
+    items_[item->sceneIndex_] = last;
+    last->sceneIndex_ = item->sceneIndex_;
+    items_.pop_back();
+    item->scene_ = nullptr;
+    item->sceneChanged();
+}
+
+void ZGraphicsScene::destroyItem(ZGraphicsItem* item) {
+    if (!item || !pools_.contains(item->pool_)) {
+        throw ZincX::ZException("ZGraphicsScene::destroyItem: item was not created by this scene");
+    }
+    // The pool holds the item as its most-derived type.
+    item->pool_->destroyObject(dynamic_cast<void*>(item));
+}
+
+ZincX::ZRect ZGraphicsScene::cellRange(const ZincX::ZRect& bounds) const {
+    if (bounds.isEmpty()) return { 0, 0, 0, 0 };
+    int x0 = floorDiv(bounds.x, cellSize_);
+    int y0 = floorDiv(bounds.y, cellSize_);
+    int x1 = floorDiv(bounds.x + bounds.width - 1, cellSize_);
+    int y1 = floorDiv(bounds.y + bounds.height - 1, cellSize_);
+    return { x0, y0, x1 - x0 + 1, y1 - y0 + 1 };
+}
+
+std::uint64_t ZGraphicsScene::cellKey(int cx, int cy) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cx)) << 32) |
+           static_cast<std::uint32_t>(cy);
+}
+
+void ZGraphicsScene::insertIntoIndex(ZGraphicsItem* item) {
+    item->sceneBounds_ = item->worldBounds();
+    ZincX::ZRect cells = cellRange(item->sceneBounds_);
+    item->sceneCells_ = cells;
+    item->inLargeList_ = cells.area() > kMaxCellsPerItem;
+    if (item->inLargeList_) {
+        large_.push_back(item);
+        return;
+    }
+    for (int cy = cells.y; cy < cells.y + cells.height; ++cy) {
+        for (int cx = cells.x; cx < cells.x + cells.width; ++cx) {
+            grid_[cellKey(cx, cy)].push_back(item);
+        }
+    }
+}
+
+void ZGraphicsScene::removeFromIndex(ZGraphicsItem* item) {
+    if (item->inLargeList_) {
+        eraseFrom(large_, item);
+        return;
+    }
+    const ZincX::ZRect& cells = item->sceneCells_;
+    for (int cy = cells.y; cy < cells.y + cells.height; ++cy) {
+        for (int cx = cells.x; cx < cells.x + cells.width; ++cx) {
+            auto it = grid_.find(cellKey(cx, cy));
+            if (it == grid_.end()) continue;
+            eraseFrom(it->second, item);
+            if (it->second.empty()) grid_.erase(it);
+        }
+    }
+}
+
+void ZGraphicsScene::itemMoved(ZGraphicsItem* item) {
+    // A move of a queued item also settles its pending transformation, so repaint where it was filed.
+    if (item->transformPending_) invalidate(item->sceneBounds_);
+    item->sceneBounds_ = item->worldBounds();
+    ZincX::ZRect cells = cellRange(item->sceneBounds_);
+    const ZincX::ZRect& old = item->sceneCells_;
+    if (cells.x == old.x && cells.y == old.y &&
+        cells.width == old.width && cells.height == old.height) {
+        return;
+    }
+    if (item->inLargeList_ && cells.area() > kMaxCellsPerItem) {
+        // Still too big for the grid; the side list has no position to update.
+        item->sceneCells_ = cells;
+        return;
+    }
+    removeFromIndex(item);
+    insertIntoIndex(item);
+}
+
+void ZGraphicsScene::itemTransformed(ZGraphicsItem* item) {
+    if (item->transformPending_) return;
+    item->transformPending_ = true;
+    transformed_.push_back(item);
+}
+
+void ZGraphicsScene::updateTransforms() {
+    for (ZGraphicsItem* item : transformed_) {
+        item->transformPending_ = false;
+        const ZincX::ZRect old = item->sceneBounds_;
+        if (item->worldBounds() == old) continue;
+        // Recorded commands are in item coordinates and stay valid; only the areas need repainting.
+        invalidate(old);
+        itemMoved(item);
+        invalidate(item->sceneBounds_);
+    }
+    transformed_.clear();
+}
+
+void ZGraphicsScene::itemReordered(ZGraphicsItem* item) {
+    // Buckets are unordered; paint order is resolved per query, so only damage is needed.
+    item->invalidate();
+}
+
+bool ZGraphicsScene::paintsBefore(const ZGraphicsItem* a, const ZGraphicsItem* b) const {
+    if (a->zValue_ != b->zValue_) return a->zValue_ < b->zValue_;
+    return a->sceneSequence_ < b->sceneSequence_;
+}
+
+ZGraphicsItem* ZGraphicsScene::itemAt(const ZincX::ZPoint& point) const {
+    ZGraphicsItem* top = nullptr;
+    auto consider = [&](ZGraphicsItem* item) {
+        if (item->containsWorldPoint(point) && (!top || paintsBefore(top, item))) {
+            top = item;
+        }
+    };
+
+    auto it = grid_.find(cellKey(floorDiv(point.x, cellSize_), floorDiv(point.y, cellSize_)));
+    if (it != grid_.end()) {
+        for (auto* item : it->second) consider(item);
+    }
+    for (auto* item : large_) consider(item);
+    return top;
+}
+
+void ZGraphicsScene::itemsIn(const ZincX::ZRect& rect, std::vector<ZGraphicsItem*>& out) const {
+    out.clear();
+    if (rect.isEmpty()) return;
+
+    if (++queryStamp_ == 0) {
+        // Stamp wrapped: reset every item so stale marks cannot alias the new stamp.
+        for (auto* item : items_) item->queryStamp_ = 0;
+        queryStamp_ = 1;
+    }
+    auto collect = [&](ZGraphicsItem* item) {
+        if (item->queryStamp_ != queryStamp_ && item->worldBounds().intersects(rect)) {
+            item->queryStamp_ = queryStamp_;
+            out.push_back(item);
+        }
+    };
+
+    ZincX::ZRect cells = cellRange(rect);
+    if (cells.area() > static_cast<long long>(grid_.size())) {
+        // Query covers more cells than are occupied: walking the occupied buckets is cheaper.
+        for (const auto& [key, bucket] : grid_) {
+            for (auto* item : bucket) collect(item);
+        }
+    } else {
+        for (int cy = cells.y; cy < cells.y + cells.height; ++cy) {
+            for (int cx = cells.x; cx < cells.x + cells.width; ++cx) {
+                auto it = grid_.find(cellKey(cx, cy));
+                if (it == grid_.end()) continue;
+                for (auto* item : it->second) collect(item);
+            }
+        }
+    }
+    for (auto* item : large_) collect(item);
+
+    std::sort(out.begin(), out.end(), [this](const ZGraphicsItem* a, const ZGraphicsItem* b) {
+        return paintsBefore(a, b);
+    });
+}
+
+void ZGraphicsScene::setCellSize(int cellSize) {
+    cellSize = cellSize > 0 ? cellSize : 1;
+    if (cellSize == cellSize_) return;
+    cellSize_ = cellSize;
+    grid_.clear();
+    large_.clear();
+    for (auto* item : items_) insertIntoIndex(item);
+}
+
+void ZGraphicsScene::invalidate(const ZincX::ZRect& rect) {
+    if (view_) view_->invalidate(rect);
+}
@@ -0,0 +1,133 @@
+/**
+ * @file ZGraphicsScene.h
+ * @brief Defines the scene class that manages items, z-ordering and spatial queries in ZincX.
+ *
+ * This file contains the ZGraphicsScene class. The scene keeps every ZGraphicsItem in a uniform
+ * grid keyed on the item's bounds so point queries (mouse dispatch) and rectangle queries
+ * (viewport culling, damage repair) only look at the handful of items in the touched cells
+ * instead of scanning the whole scene. The grid is updated incrementally as items move.
+ *
+ * Items can also be created by the scene itself with createItem(), which places them in a
+ * per-type ZPool: items of one type then share contiguous slabs instead of being scattered over
+ * the heap, and tearing down the scene releases them all in one pass per type.
+ *
+ * The index files items by their world bounds. A transformation change only queues the changed
+ * items; updateTransforms() re-files them and damages their old and new areas, once per frame no
+ * matter how often they moved in between.
+ */
+#pragma once
+#include "../common/ZCommon.h"
+#include "../common/ZPool.h"
+#include "ZGraphicsItem.h"
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <unordered_map>
+#include <vector>
+
+class ZGraphicsViewBase;
+
+class ZGraphicsScene {
+public:
+    /**
+     * @brief Constructs an empty scene.
+     * @param cellSize Edge length of a grid cell in view units; roughly the size of a typical item.
+     */
+    explicit ZGraphicsScene(int cellSize = 16);
+    ~ZGraphicsScene();
+
+    ZGraphicsScene(const ZGraphicsScene&) = delete;
+    ZGraphicsScene& operator=(const ZGraphicsScene&) = delete;
+
+    void addItem(ZGraphicsItem* item);
+    void removeItem(ZGraphicsItem* item);
+
+    /**
+     * @brief Constructs an item in the scene's pool for T and adds it to the scene.
+     *
+     * The scene owns the item: release it with destroyItem(), never with delete. Items still
+     * alive when the scene is destroyed are destroyed with it.
+     */
+    template <typename T, typename... Args>
+    T* createItem(Args&&... args) {
+        static_assert(std::is_base_of_v<ZGraphicsItem, T>, "createItem requires a ZGraphicsItem");
+        ZincX::ZPool<T>& pool = pools_.get<T>();
+        T* item = pool.create(std::forward<Args>(args)...);
+        static_cast<ZGraphicsItem*>(item)->pool_ = &pool;
+        addItem(item);
+        return item;
+    }
+
+    /**
+     * @brief Destroys an item made by createItem() and recycles its slot.
+     * @throws ZincX::ZException if the item was not created by this scene.
+     */
+    void destroyItem(ZGraphicsItem* item);
+
+    /** @brief Number of live items created with createItem(). */
+    std::size_t pooledItems() const { return pools_.size(); }
+
+    /**
+     * @brief Re-files items whose world transformation changed since the last call.
+     *
+     * ZGraphicsView::render() and ZEventManager call this before querying; code that queries the
+     * scene directly after changing transformations should too.
+     */
+    void updateTransforms();
+
+    /** @brief Returns all items in insertion order. */
+    const std::vector<ZGraphicsItem*>& items() const { return items_; }
+
+    /**
+     * @brief Returns the topmost item whose transformed bounds contain the point.
+     * @param point The point in view coordinates.
+     * @return The item, or nullptr if the point hits nothing.
+     */
+    ZGraphicsItem* itemAt(const ZincX::ZPoint& point) const;
+
+    /**
+     * @brief Collects the items whose bounds intersect a rectangle.
+     * @param rect The query rectangle in view coordinates.
+     * @param out Receives the items in paint order (bottom to top); it is cleared first.
+     */
+    void itemsIn(const ZincX::ZRect& rect, std::vector<ZGraphicsItem*>& out) const;
+
+    /**
+     * @brief Changes the grid cell size and rebuilds the index.
+     * @param cellSize Edge length of a grid cell in view units.
+     */
+    void setCellSize(int cellSize);
+    int cellSize() const { return cellSize_; }
+
+    /** @brief Attaches the view that receives this scene's damage. */
+    void setView(ZGraphicsViewBase* view) { view_ = view; }
+    ZGraphicsViewBase* view() const { return view_; }
+
+    /** @brief Forwards damage to the attached view, if any. */
+    void invalidate(const ZincX::ZRect& rect);
+
+private:
+    friend class ZGraphicsItem;
+
+    /** Items covering more cells than this are kept in a separate list instead of the grid. */
+    static constexpr int kMaxCellsPerItem = 64;
+
+    void itemMoved(ZGraphicsItem* item);
+    void itemTransformed(ZGraphicsItem* item);
+    void itemReordered(ZGraphicsItem* item);
+    void insertIntoIndex(ZGraphicsItem* item);
+    void removeFromIndex(ZGraphicsItem* item);
+    ZincX::ZRect cellRange(const ZincX::ZRect& bounds) const;
+    static std::uint64_t cellKey(int cx, int cy);
+    bool paintsBefore(const ZGraphicsItem* a, const ZGraphicsItem* b) const;
+
+    int cellSize_;
+    std::vector<ZGraphicsItem*> items_;
+    std::unordered_map<std::uint64_t, std::vector<ZGraphicsItem*>> grid_;
+    std::vector<ZGraphicsItem*> large_;
+    std::vector<ZGraphicsItem*> transformed_;  ///< Waiting for updateTransforms().
+    std::uint64_t nextSequence_ = 0;
+    mutable std::uint32_t queryStamp_ = 0;
+    ZGraphicsViewBase* view_ = nullptr;
+    ZincX::ZPoolSet pools_;                    ///< Storage of items made by createItem().
+};
@@ -0,0 +1,80 @@
+/**
+ * @file ZGraphicsView.cpp
+ * @brief Implementation of the ZGraphicsViewBase class for the ZincX graphics subsystem.
+ *
+ * This file provides the backend-independent part of ZGraphicsView: managing the scene and
+ * building each frame; the backend calls themselves are made by the ZGraphicsView template.
+ * Rendering is damage driven: each frame only the invalidated rectangles are redrawn, with the
+ * backend clipped to them and items outside them culled by the scene's spatial index.
+ * The surviving items' cached command spans are gathered into one frame list, sorted by state
+ * and submitted to the backend in a single call. Each span is mapped through its item's world
+ * transformation on the way, which is a plain offset for the common translated item. Items that
+ * clip to their bounds get their span bracketed by a clip to the damaged rectangle's overlap with
+ * them and a clip back to the rectangle.
+ */
+ #include "ZGraphicsView.h"
+ #include "ZGraphicsItem.h"
+ #include "../common/ZArena.h"
+ #ifdef ZINCX_PROFILE
+ #include <algorithm>
+ #endif
+
+ ZGraphicsViewBase::ZGraphicsViewBase() {
+     scene_.setView(this);
+ }
+
+ void ZGraphicsViewBase::invalidate(const ZincX::ZRect& rect) {
+     damage_.add(rect.intersected(viewportRect()));
+ }
+
+ void ZGraphicsViewBase::invalidateAll() {
+     damage_.add(viewportRect());
+ }
+
+ void ZGraphicsViewBase::resize(ZincX::ZSize surface) {
+     if (surface.width == surface_.width && surface.height == surface_.height) return;
+     surface_ = surface;
+     invalidateAll();
+ }
+
+ bool ZGraphicsViewBase::beginFrame(ZincX::ZSize surface) {
+     // A new frame begins even when nothing is redrawn; last frame's transient data is dropped.
+     ZincX::ZArena::frame().reset();
+     resize(surface);
+     scene_.updateTransforms();
+     return !damage_.isEmpty();
+ }
+
+ void ZGraphicsViewBase::buildFrame() {
+     const ZincX::ZSize surface = surface_;
+     frame_.clear();
+ #ifdef ZINCX_PROFILE
+     // An item overlapping several damaged rectangles is drawn once per rectangle but culled only
+     // if it is in none, so culling is counted over the frame's distinct items.
+     ZincX::ZArenaVector<const ZGraphicsItem*> drawn{ ZincX::ZArenaAllocator<const ZGraphicsItem*>(ZincX::ZArena::frame()) };
+ #endif
+     for (const auto& rect : damage_.rects()) {
+         frame_.setClip(rect);
+         frame_.fillRect(rect, background_);
+         scene_.itemsIn(rect, visible_);
+ #ifdef ZINCX_PROFILE
+         drawn.insert(drawn.end(), visible_.begin(), visible_.end());
+ #endif
+         for (auto* item : visible_) {
+             if (!item->clipsToBounds()) {
+                 frame_.append(item->commands(surface), item->worldTransform());
+                 continue;
+             }
+             frame_.setClip(rect.intersected(item->worldBounds()));
+             frame_.append(item->commands(surface), item->worldTransform());
+             frame_.setClip(rect);
+         }
+     }
+     frame_.setClip(viewportRect());
+ #ifdef ZINCX_PROFILE
+     std::sort(drawn.begin(), drawn.end());
+     ZINCX_PROFILE_COUNT(ItemsCulled, scene_.items().size() - static_cast<std::size_t>(std::unique(drawn.begin(), drawn.end()) - drawn.begin()));
+ #endif
+     frame_.sortByState();
+     ZINCX_PROFILE_COUNT(DrawCalls, frame_.size());
+ }
@@ -1,27 +1,155 @@
 /**
- * @file ZGraphicsView.cpp
- * @brief Implementation of the ZGraphicsView class for the ZincX graphics subsystem.
+ * @file ZGraphicsView.h
+ * @brief Defines the view class that hosts and renders graphics items in the ZincX framework.
  *
- * This file provides the implementation for the ZGraphicsView class, handling the management and
- * rendering of ZGraphicsItem objects using a specified graphics backend in the ZincX UI framework.
+ * This file contains the ZGraphicsView class, which owns a rendering backend and draws the
+ * ZGraphicsItem objects added to it, presenting each finished frame through the backend.
+ * Items live in the view's ZGraphicsScene, whose spatial index culls everything
+ * outside the damaged area; render() repaints only that area.
+ *
+ * The view is a template over its backend. ZGraphicsView<> (what `ZGraphicsView view(backend)`
+ * deduces to) owns any IZGraphicsBackend and calls it through the virtual interface, so one
+ * binary can choose among several backends at run time. ZGraphicsView<Backend> instead holds a
+ * concrete backend by value and calls it by qualified name: the calls are bound at compile time,
+ * the backend's submit() can be inlined into render(), and a build configured with ZINCX_BACKEND
+ * links no other backend. Everything else lives in ZGraphicsViewBase, which is what scenes and
+ * items refer to.
  */
- #include "ZGraphicsView.h"
-
- ZGraphicsView::ZGraphicsView(std::unique_ptr<IZGraphicsBackend> backend, ZincX::RenderMode mode)
-     : backend_(std::move(backend)), renderMode_(mode) {
-     backend_->initialize(renderMode_);
- }
- 
- void ZGraphicsView::addItem(ZGraphicsItem* item) {
-     items_.push_back(item);
- }
- 
- void ZGraphicsView::removeItem(ZGraphicsItem* item) {
-     items_.erase(std::remove(items_.begin(), items_.end(), item), items_.end());
- }
- 
- void ZGraphicsView::render() {
-     for (auto* item : items_) {
-         item->draw(backend_.get());
-     }
- }
\ No newline at end of file
+#pragma once
+#include "IZGraphicsBackend.h"
+#include "ZDamageRegion.h"
+#include "ZGraphicsScene.h"
+#include "../debug/ZProfiler.h"
+#include <concepts>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class ZGraphicsViewBase {
+public:
+    ZGraphicsViewBase(const ZGraphicsViewBase&) = delete;
+    ZGraphicsViewBase& operator=(const ZGraphicsViewBase&) = delete;
+
+    void addItem(ZGraphicsItem* item) { scene_.addItem(item); }
+    void removeItem(ZGraphicsItem* item) { scene_.removeItem(item); }
+
+    /** @brief Returns the topmost item under a point, for mouse dispatch. */
+    ZGraphicsItem* itemAt(const ZincX::ZPoint& point) const { return scene_.itemAt(point); }
+
+    ZGraphicsScene& scene() { return scene_; }
+    const ZGraphicsScene& scene() const { return scene_; }
+
+    /**
+     * @brief Schedules a rectangle for redraw on the next render().
+     * @param rect The damaged area in view coordinates.
+     */
+    void invalidate(const ZincX::ZRect& rect);
+
+    /** @brief Schedules the whole viewport for redraw on the next render(). */
+    void invalidateAll();
+
+    /** @brief The backend's drawable area as of the last render(); a size change redraws everything. */
+    ZincX::ZRect viewportRect() const { return { 0, 0, surface_.width, surface_.height }; }
+
+    /** @brief Sets the color damaged areas are cleared to before items are redrawn. */
+    void setBackgroundColor(const ZincX::ZColor& color) { background_ = color; invalidateAll(); }
+
+    const ZDamageRegion& damage() const { return damage_; }
+
+protected:
+    ZGraphicsViewBase();
+    ~ZGraphicsViewBase() = default;
+
+    /** @brief Records the backend's drawable size, damaging the whole viewport if it changed. */
+    void resize(ZincX::ZSize surface);
+
+    /**
+     * @brief Starts a frame: resets the frame arena and brings transformations and size up to date.
+     * @param surface The backend's current drawable size.
+     * @return False if nothing was invalidated, in which case the frame ends here.
+     */
+    bool beginFrame(ZincX::ZSize surface);
+
+    /** @brief Gathers the damaged area's commands into frame_, sorted for submission. */
+    void buildFrame();
+
+    /** @brief Ends a frame whose commands were submitted. */
+    void endFrame() { damage_.clear(); }
+
+    ZDrawList frame_;                     ///< Commands of the frame being rendered.
+
+private:
+    ZGraphicsScene scene_;
+    ZDamageRegion damage_;
+    std::vector<ZGraphicsItem*> visible_; ///< Scratch list reused by buildFrame().
+    ZincX::ZColor background_{0, 0, 0};
+    ZincX::ZSize surface_{ 0, 0 };
+};
+
+template <typename Backend = IZGraphicsBackend>
+class ZGraphicsView final : public ZGraphicsViewBase {
+    static_assert(std::is_base_of_v<IZGraphicsBackend, Backend>, "ZGraphicsView requires an IZGraphicsBackend");
+
+public:
+    /** @brief True for the view that calls its backend through the virtual interface. */
+    static constexpr bool kDynamic = std::is_same_v<Backend, IZGraphicsBackend>;
+
+    /** @brief Takes ownership of any backend and initializes it for @p mode. */
+    explicit ZGraphicsView(std::unique_ptr<IZGraphicsBackend> backend, ZincX::RenderMode mode = ZincX::RenderMode::Text)
+        requires kDynamic
+        : backend_(std::move(backend)) {
+        backend_->initialize(mode);
+        resize(backend_->surfaceSize());
+    }
+
+    /**
+     * @brief Constructs the backend in place from @p args and initializes it for @p mode.
+     *
+     * Backend must be the exact type of the backend, not a base of it: it is never called virtually.
+     */
+    template <typename... Args>
+        requires(!kDynamic && std::constructible_from<Backend, Args...>)
+    explicit ZGraphicsView(ZincX::RenderMode mode, Args&&... args)
+        : backend_(std::forward<Args>(args)...) {
+        backend_.Backend::initialize(mode);
+        resize(backend_.Backend::surfaceSize());
+    }
+
+    Backend& backend() {
+        if constexpr (kDynamic) return *backend_;
+        else return backend_;
+    }
+
+    /**
+     * @brief Redraws the damaged area and presents the frame.
+     *
+     * Does nothing if nothing was invalidated since the previous call. Either way the calling
+     * thread's ZArena::frame() is reset first, so frame-scoped allocations end here.
+     */
+    void render() {
+        if constexpr (kDynamic) {
+            if (!beginFrame(backend_->surfaceSize())) return;
+            ZINCX_PROFILE_SCOPE("ZGraphicsView::render", Rendering);
+            buildFrame();
+            backend_->submit(frame_);
+            endFrame();
+            backend_->present();
+        } else {
+            if (!beginFrame(backend_.Backend::surfaceSize())) return;
+            ZINCX_PROFILE_SCOPE("ZGraphicsView::render", Rendering);
+            buildFrame();
+            backend_.Backend::submit(frame_);
+            endFrame();
+            backend_.Backend::present();
+        }
+    }
+
+private:
+    std::conditional_t<kDynamic, std::unique_ptr<IZGraphicsBackend>, Backend> backend_;
+};
+
+template <typename T>
+ZGraphicsView(std::unique_ptr<T>) -> ZGraphicsView<IZGraphicsBackend>;
+template <typename T>
+ZGraphicsView(std::unique_ptr<T>, ZincX::RenderMode) -> ZGraphicsView<IZGraphicsBackend>;
@@ -0,0 +1,23 @@
+/**
+ * @file ZLayerCache.cpp
+ * @brief Implementation of the ZLayerCache class for the ZincX graphics subsystem.
+ *
+ * This file also holds the default IZGraphicsBackend::drawLayer(), which replays the layer's
+ * commands, so backends without a raster format for layers draw them correctly uncached.
+ */
+#include "ZLayerCache.h"
+
+void ZLayerCache::releaseRasters() {
+    pixels_ = {};
+    cells_ = {};
+}
+
+void ZLayerCache::replay(IZGraphicsBackend& backend, const ZincX::ZPoint& at) const {
+    ZDrawList moved;
+    moved.append(commands_, ZincX::ZMatrix::translation(static_cast<float>(at.x - area_.x), static_cast<float>(at.y - area_.y)));
+    moved.replay(backend);
+}
+
+void IZGraphicsBackend::drawLayer(ZLayerCache& layer, const ZincX::ZPoint& at) {
+    layer.replay(*this, at);
+}
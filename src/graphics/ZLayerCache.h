@@ -0,0 +1,79 @@
+/**
+ * @file ZLayerCache.h
+ * @brief Defines the offscreen cache for one drawing layer of an item in the ZincX framework.
+ *
+ * This file contains ZLayerCache. A layer is recorded once into its own command list and only
+ * recorded again when its key (typically the style revision and widget state) or its area
+ * changes. Items draw it with IZGraphicsBackend::drawLayer(); backends that can keep a raster
+ * copy render the list once into storage the cache owns, as 32 bpp pixels for the software
+ * rasterizer or packed text cells for DOS, and afterwards only copy it. Backends without such
+ * storage replay the recorded commands, which still spares the item from re-recording them.
+ */
+#pragma once
+#include "ZDrawRecorder.h"
+#include "../common/ZCommon.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+class ZLayerCache {
+public:
+    /** @brief A raster copy of the layer in one backend's format. */
+    template <typename Cell>
+    struct Raster {
+        std::vector<Cell> data;        ///< area().width * area().height cells, row by row.
+        std::uint32_t generation = 0;  ///< Recording the data was rendered from; 0 if none.
+        bool opaque = false;           ///< Every cell is covered, so it can be copied without blending.
+    };
+
+    /**
+     * @brief Records the layer again unless the key and area are unchanged.
+     * @param area The area the layer covers, in the item's coordinates.
+     * @param key Identifies the content, e.g. ZStyle::cacheKey() of the current state.
+     * @param paint Called with a recording backend to draw the layer's content.
+     * @return True if @p paint ran.
+     */
+    template <typename Paint>
+    bool update(const ZincX::ZRect& area, std::uint64_t key, Paint&& paint) {
+        if (generation_ != 0 && key == key_ && area == area_) return false;
+        commands_.clear();
+        ZDrawRecorder recorder(commands_, { area.width, area.height });
+        std::forward<Paint>(paint)(static_cast<IZGraphicsBackend&>(recorder));
+        area_ = area;
+        key_ = key;
+        if (++generation_ == 0) generation_ = 1;
+        return true;
+    }
+
+    /** @brief Forces the next update() to record again. */
+    void invalidate() { generation_ = 0; }
+
+    /** @brief Frees the raster copies; they are rebuilt on the next draw. */
+    void releaseRasters();
+
+    /** @brief Draws the recorded commands at @p at through the backend's primitives. */
+    void replay(IZGraphicsBackend& backend, const ZincX::ZPoint& at) const;
+
+    const ZincX::ZRect& area() const { return area_; }
+    const ZDrawList& commands() const { return commands_; }
+
+    /** @brief Changes whenever the commands are recorded again; rasters from another generation are stale. */
+    std::uint32_t generation() const { return generation_; }
+
+    Raster<ZincX::ZColor32>& pixels() { return pixels_; }
+    Raster<std::uint16_t>& cells() { return cells_; }
+
+    /** @brief Memory held by raster copies. */
+    std::size_t rasterBytes() const {
+        return pixels_.data.capacity() * sizeof(ZincX::ZColor32) + cells_.data.capacity() * sizeof(std::uint16_t);
+    }
+
+private:
+    ZDrawList commands_;
+    ZincX::ZRect area_{ 0, 0, 0, 0 };
+    std::uint64_t key_ = 0;
+    std::uint32_t generation_ = 0;
+    Raster<ZincX::ZColor32> pixels_;
+    Raster<std::uint16_t> cells_;
+};
@@ -0,0 +1,175 @@
+/**
+ * @file ZQuadBatch.cpp
+ * @brief Implementation of the ZQuadBatch class for the ZincX graphics subsystem.
+ *
+ * Geometry follows SoftwareGraphicsBackend's pixel rules: spans and outlines include both end
+ * pixels, ellipses cover a (2 * (diameter / 2) + 1) pixel box around their center and polygon
+ * spans are found by intersecting each row's center line with the edges. Only diagonal lines and
+ * ellipses are left for the fragment stage to resolve; everything else is an exact rectangle.
+ */
+#include "ZQuadBatch.h"
+#include "ZLayerCache.h"
+#include <algorithm>
+#include <cmath>
+
+void ZQuadBatch::clear(const ZincX::ZRect& surface) {
+    surface_ = surface;
+    clip_ = surface;
+    instances_.clear();
+    ranges_.clear();
+}
+
+void ZQuadBatch::setClip(const ZincX::ZRect& clip) {
+    clip_ = clip.intersected(surface_);
+}
+
+void ZQuadBatch::add(const ZDrawList& commands, ZGlyphAtlas& atlas, ZTextRunCache& runs, const ZFontKey& font) {
+    const std::size_t instances = instances_.size();
+    const std::size_t ranges = ranges_.size();
+    const std::uint32_t lastCount = ranges ? ranges_.back().count : 0;
+    const ZincX::ZRect clip = clip_;
+    const std::uint32_t generation = atlas.generation();
+
+    append(commands, atlas, runs, font);
+    if (atlas.generation() == generation) return;
+
+    // The atlas was cleared mid-list: glyphs emitted before that point are stale.
+    instances_.resize(instances);
+    ranges_.resize(ranges);
+    if (ranges) ranges_.back().count = lastCount;
+    clip_ = clip;
+    append(commands, atlas, runs, font);
+}
+
+void ZQuadBatch::append(const ZDrawList& commands, ZGlyphAtlas& atlas, ZTextRunCache& runs, const ZFontKey& font) {
+    for (const ZDrawCommand& cmd : commands.commands()) {
+        const ZincX::ZRect& r = cmd.rect;
+        switch (cmd.op) {
+            case ZDrawOp::SetClip: setClip(r); break;
+            case ZDrawOp::FillRect:
+                if (!r.isEmpty()) push(static_cast<float>(r.x), static_cast<float>(r.y), static_cast<float>(r.x + r.width),
+                                       static_cast<float>(r.y + r.height), cmd.color, ZQuadKind::Solid);
+                break;
+            case ZDrawOp::DrawRect: pushFrame(r, cmd.color); break;
+            case ZDrawOp::DrawLine: pushLine({ r.x, r.y }, { r.width, r.height }, cmd.color); break;
+            case ZDrawOp::DrawCircle: pushEllipse({ r.x, r.y }, r.width * 2, r.width * 2, cmd.color, cmd.filled != 0); break;
+            case ZDrawOp::DrawEllipse: pushEllipse({ r.x, r.y }, r.width, r.height, cmd.color, cmd.filled != 0); break;
+            case ZDrawOp::DrawPolygon: pushPolygon(commands.points(cmd), cmd.count, cmd.color, cmd.filled != 0); break;
+            case ZDrawOp::DrawText: pushText(commands.text(cmd), r, cmd.color, cmd.alignment(), atlas, runs, font); break;
+            case ZDrawOp::DrawLayer: {
+                // Instances are already cheap to regenerate; layers are drawn from their commands.
+                const ZLayerCache& layer = commands.layer(cmd);
+                ZDrawList moved;
+                moved.append(layer.commands(), ZincX::ZMatrix::translation(static_cast<float>(r.x - layer.area().x),
+                                                                           static_cast<float>(r.y - layer.area().y)));
+                append(moved, atlas, runs, font);
+                break;
+            }
+        }
+    }
+}
+
+void ZQuadBatch::push(float x0, float y0, float x1, float y1, ZincX::ZColor32 color, ZQuadKind kind) {
+    if (color.a() == 0) return;
+    // Lines are stored by end point and widen half a pixel around them.
+    const float pad = kind == ZQuadKind::Line ? 0.5f : 0.0f;
+    if (std::max(x0, x1) + pad <= clip_.x || std::min(x0, x1) - pad >= clip_.x + clip_.width ||
+        std::max(y0, y1) + pad <= clip_.y || std::min(y0, y1) - pad >= clip_.y + clip_.height) {
+        return;
+    }
+    if (ranges_.empty() || ranges_.back().scissor != clip_) {
+        ranges_.push_back({ clip_, static_cast<std::uint32_t>(instances_.size()), 0 });
+    }
+    instances_.push_back({ x0, y0, x1, y1, 0.0f, 0.0f, 0.0f, 0.0f, color.value, kind });
+    ++ranges_.back().count;
+}
+
+void ZQuadBatch::pushSpan(int x0, int x1, int y, ZincX::ZColor32 color) {
+    if (x1 < x0) return;
+    push(static_cast<float>(x0), static_cast<float>(y), static_cast<float>(x1 + 1), static_cast<float>(y + 1), color,
+         ZQuadKind::Solid);
+}
+
+void ZQuadBatch::pushFrame(const ZincX::ZRect& rect, ZincX::ZColor32 color) {
+    if (rect.isEmpty()) return;
+    const int right = rect.x + rect.width - 1;
+    const int bottom = rect.y + rect.height - 1;
+    pushSpan(rect.x, right, rect.y, color);
+    if (bottom != rect.y) pushSpan(rect.x, right, bottom, color);
+    if (rect.height > 2) {
+        const float top = static_cast<float>(rect.y + 1);
+        const float below = static_cast<float>(bottom);
+        push(static_cast<float>(rect.x), top, static_cast<float>(rect.x + 1), below, color, ZQuadKind::Solid);
+        if (right != rect.x) push(static_cast<float>(right), top, static_cast<float>(right + 1), below, color, ZQuadKind::Solid);
+    }
+}
+
+void ZQuadBatch::pushLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, ZincX::ZColor32 color) {
+    if (start.y == end.y) {
+        pushSpan(std::min(start.x, end.x), std::max(start.x, end.x), start.y, color);
+    } else if (start.x == end.x) {
+        push(static_cast<float>(start.x), static_cast<float>(std::min(start.y, end.y)), static_cast<float>(start.x + 1),
+             static_cast<float>(std::max(start.y, end.y) + 1), color, ZQuadKind::Solid);
+    } else {
+        push(start.x + 0.5f, start.y + 0.5f, end.x + 0.5f, end.y + 0.5f, color, ZQuadKind::Line);
+    }
+}
+
+void ZQuadBatch::pushEllipse(const ZincX::ZPoint& center, int width, int height, ZincX::ZColor32 color, bool filled) {
+    const int a = width / 2;
+    const int b = height / 2;
+    if (a < 0 || b < 0) return;
+    push(static_cast<float>(center.x - a), static_cast<float>(center.y - b), static_cast<float>(center.x + a + 1),
+         static_cast<float>(center.y + b + 1), color, filled ? ZQuadKind::Ellipse : ZQuadKind::EllipseOutline);
+}
+
+void ZQuadBatch::pushPolygon(const ZincX::ZPoint* points, std::size_t count, ZincX::ZColor32 color, bool filled) {
+    if (count == 0) return;
+    if (!filled) {
+        for (std::size_t i = 0; i < count; ++i) pushLine(points[i], points[(i + 1) % count], color);
+        return;
+    }
+    auto [minIt, maxIt] = std::minmax_element(points, points + count,
+        [](const ZincX::ZPoint& l, const ZincX::ZPoint& r) { return l.y < r.y; });
+    for (int y = std::max(minIt->y, clip_.y); y < std::min(maxIt->y + 1, clip_.y + clip_.height); ++y) {
+        const double sy = y + 0.5;
+        crossings_.clear();
+        for (std::size_t i = 0, j = count - 1; i < count; j = i++) {
+            const ZincX::ZPoint& p = points[i];
+            const ZincX::ZPoint& q = points[j];
+            if ((p.y <= sy) != (q.y <= sy)) {
+                crossings_.push_back(p.x + (sy - p.y) * (q.x - p.x) / (q.y - p.y));
+            }
+        }
+        std::sort(crossings_.begin(), crossings_.end());
+        for (std::size_t i = 0; i + 1 < crossings_.size(); i += 2) {
+            pushSpan(static_cast<int>(std::ceil(crossings_[i] - 0.5)), static_cast<int>(std::floor(crossings_[i + 1] - 0.5)), y, color);
+        }
+    }
+}
+
+void ZQuadBatch::pushText(std::string_view text, const ZincX::ZRect& bounds, ZincX::ZColor32 color, ZincX::TextAlignment alignment,
+                          ZGlyphAtlas& atlas, ZTextRunCache& runs, const ZFontKey& font) {
+    if (bounds.isEmpty() || color.a() == 0 || !bounds.intersects(clip_)) return;
+
+    const ZTextRun& run = runs.shape(text, bounds.width, alignment, font, atlas);
+    const int lines = run.visibleLines(bounds.height);
+    int lineTop = bounds.y + run.verticalOffset(bounds.height, alignment);
+    std::size_t g = 0;
+    for (int line = 0; line < lines; ++line, lineTop += run.lineHeight) {
+        for (const std::size_t end = run.lineEnds[static_cast<std::size_t>(line)]; g < end; ++g) {
+            const ZPlacedGlyph& glyph = run.glyphs[g];
+            const ZincX::ZRect& src = glyph.source;
+            const float x = static_cast<float>(bounds.x + glyph.x);
+            const float y = static_cast<float>(lineTop + glyph.y);
+            const std::size_t before = instances_.size();
+            push(x, y, x + src.width, y + src.height, color, ZQuadKind::Glyph);
+            if (instances_.size() == before) continue;
+            ZQuadInstance& quad = instances_.back();
+            quad.u0 = static_cast<float>(src.x);
+            quad.v0 = static_cast<float>(src.y);
+            quad.u1 = static_cast<float>(src.x + src.width);
+            quad.v1 = static_cast<float>(src.y + src.height);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * @file ZQuadBatch.h
+ * @brief Defines the instanced-quad batcher used by the ZincX GPU backends.
+ *
+ * This file contains ZQuadInstance, the per-instance record a GPU backend uploads, and
+ * ZQuadBatch, which turns ZDrawList commands into such records. Every primitive becomes one or
+ * more screen-space quads of a few kinds (solid, atlas glyph, ellipse, thick line) that a single
+ * pipeline draws as six vertices per instance, so a frame costs one instanced draw per clip
+ * rectangle instead of one call per primitive. Outlines are split into edge quads and filled
+ * polygons into scanline spans with the same even-odd rule as SoftwareGraphicsBackend, which
+ * keeps the GPU output pixel-compatible with the software rasterizer.
+ */
+#pragma once
+#include "ZDrawList.h"
+#include "ZGlyphAtlas.h"
+#include "ZTextRunCache.h"
+#include "../common/ZCommon.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/** @brief How the fragment stage shades a ZQuadInstance; values are shared with the shaders. */
+enum class ZQuadKind : std::uint32_t {
+    Solid,          ///< Rectangle of flat color.
+    Glyph,          ///< Rectangle whose alpha comes from the glyph atlas.
+    Ellipse,        ///< Filled ellipse inscribed in the rectangle.
+    EllipseOutline, ///< One pixel wide ellipse outline inscribed in the rectangle.
+    Line            ///< One pixel wide segment between two pixel centers.
+};
+
+/**
+ * @brief One quad as the vertex stage reads it, 40 bytes per instance.
+ *
+ * Coordinates are in pixels with the origin at the surface's top-left corner.
+ */
+struct ZQuadInstance {
+    float x0, y0, x1, y1; ///< Top-left and bottom-right corner; for ZQuadKind::Line the two end points.
+    float u0, v0, u1, v1; ///< Atlas rectangle in texels for ZQuadKind::Glyph; unused otherwise.
+    std::uint32_t color;  ///< Packed 0xAARRGGBB color.
+    ZQuadKind kind;
+};
+
+static_assert(std::is_trivially_copyable_v<ZQuadInstance>, "ZQuadInstance is uploaded with memcpy");
+static_assert(sizeof(ZQuadInstance) == 40, "ZQuadInstance layout is shared with the vertex shader");
+
+/** @brief A run of instances drawn under one scissor rectangle. */
+struct ZQuadRange {
+    ZincX::ZRect scissor;
+    std::uint32_t first;
+    std::uint32_t count;
+};
+
+class ZQuadBatch {
+public:
+    /**
+     * @brief Starts a new frame.
+     * @param surface The drawable area; also the clip until the first SetClip.
+     */
+    void clear(const ZincX::ZRect& surface);
+
+    /**
+     * @brief Appends the quads for a list of commands, continuing the current clip.
+     *
+     * Text is shaped through @p runs and its glyphs are packed into @p atlas. If that fills and
+     * clears the atlas half way through, the list is converted again so none of its glyphs point
+     * at stale rectangles; a backend uploading the atlas detects the change through
+     * ZGlyphAtlas::generation() and glyphCount().
+     *
+     * @param commands The commands to convert, in painter's order.
+     * @param atlas Atlas providing glyph rectangles.
+     * @param runs Cache of shaped strings.
+     * @param font Font text is shaped with.
+     */
+    void add(const ZDrawList& commands, ZGlyphAtlas& atlas, ZTextRunCache& runs, const ZFontKey& font);
+
+    bool empty() const { return instances_.empty(); }
+
+    const std::vector<ZQuadInstance>& instances() const { return instances_; }
+
+    /** @brief Scissor runs covering instances() in order; ranges never hold zero instances. */
+    const std::vector<ZQuadRange>& ranges() const { return ranges_; }
+
+private:
+    void setClip(const ZincX::ZRect& clip);
+    void append(const ZDrawList& commands, ZGlyphAtlas& atlas, ZTextRunCache& runs, const ZFontKey& font);
+
+    /** @brief Adds a quad unless it lies entirely outside the clip. */
+    void push(float x0, float y0, float x1, float y1, ZincX::ZColor32 color, ZQuadKind kind);
+    void pushSpan(int x0, int x1, int y, ZincX::ZColor32 color);
+    void pushFrame(const ZincX::ZRect& rect, ZincX::ZColor32 color);
+    void pushLine(const ZincX::ZPoint& start, const ZincX::ZPoint& end, ZincX::ZColor32 color);
+    void pushEllipse(const ZincX::ZPoint& center, int width, int height, ZincX::ZColor32 color, bool filled);
+    void pushPolygon(const ZincX::ZPoint* points, std::size_t count, ZincX::ZColor32 color, bool filled);
+    void pushText(std::string_view text, const ZincX::ZRect& bounds, ZincX::ZColor32 color, ZincX::TextAlignment alignment,
+                  ZGlyphAtlas& atlas, ZTextRunCache& runs, const ZFontKey& font);
+
+    ZincX::ZRect surface_;
+    ZincX::ZRect clip_;
+    std::vector<ZQuadInstance> instances_;
+    std::vector<ZQuadRange> ranges_;
+    std::vector<double> crossings_; ///< Scanline scratch for polygon fills.
+};
@@ -0,0 +1,239 @@
+/**
+ * @file ZRasterKernels.cpp
+ * @brief Implementation of the software rasterizer span kernels for the ZincX framework.
+ *
+ * Blending works on 16-bit channel lanes: out = div255(src * a + dst * (255 - a)) with the
+ * rounded shift-based division from blendPixel(), so every SIMD width matches the scalar
+ * reference exactly. Span tails shorter than one vector fall back to the scalar loop.
+ * Plain copies go through memcpy, which the C library already vectorizes.
+ */
+#include "ZRasterKernels.h"
+#include <cstring>
+
+#if defined(__DJGPP__) || defined(ZINCX_RASTER_SCALAR)
+#define ZINCX_RASTER_IMPL_SCALAR 1
+#elif defined(__AVX2__)
+#define ZINCX_RASTER_IMPL_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ZINCX_RASTER_IMPL_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define ZINCX_RASTER_IMPL_NEON 1
+#include <arm_neon.h>
+#else
+#define ZINCX_RASTER_IMPL_SCALAR 1
+#endif
+
+using ZincX::ZColor32;
+using ZincX::ZColor565;
+using ZincX::ZPixelSpan;
+
+namespace {
+    void fillScalar(ZColor32* dst, std::size_t count, ZColor32 color) {
+        for (std::size_t i = 0; i < count; ++i) dst[i] = color;
+    }
+
+    void blendScalar(ZColor32* dst, std::size_t count, ZColor32 color) {
+        for (std::size_t i = 0; i < count; ++i) dst[i] = ZRasterKernels::blendPixel(dst[i], color);
+    }
+
+    void blendBlitScalar(ZColor32* dst, const ZColor32* src, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            std::uint8_t a = src[i].a();
+            if (a == 255) dst[i] = src[i];
+            else if (a != 0) dst[i] = ZRasterKernels::blendPixel(dst[i], src[i]);
+        }
+    }
+
+#if defined(ZINCX_RASTER_IMPL_SSE2) || defined(ZINCX_RASTER_IMPL_AVX2)
+    // Per 16-bit lane: (t + (t >> 8)) >> 8, t already carrying the +128 rounding bias.
+    inline __m128i div255(__m128i t) {
+        return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+    }
+
+    // Source-over of 4 pixels given 16-bit lanes of pixels 0-1 (lo) and 2-3 (hi).
+    inline __m128i blend4(__m128i d, __m128i srcTerm, __m128i inv) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv), srcTerm);
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv), srcTerm);
+        return _mm_packus_epi16(div255(lo), div255(hi));
+    }
+
+    inline __m128i blendBlitHalf(__m128i s16, __m128i d16) {
+        const __m128i rgbMask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+        const __m128i alpha255 = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+        const __m128i bias = _mm_set1_epi16(128);
+        __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s16, 0xFF), 0xFF);
+        __m128i ia = _mm_sub_epi16(_mm_set1_epi16(255), a);
+        __m128i s = _mm_or_si128(_mm_and_si128(s16, rgbMask), alpha255);
+        __m128i t = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(s, a), _mm_mullo_epi16(d16, ia)), bias);
+        return div255(t);
+    }
+
+    inline __m128i srcTerm128(ZColor32 c) {
+        std::uint32_t a = c.a();
+        auto lane = [a](std::uint32_t v) { return static_cast<short>(v * a + 128); };
+        short b = lane(c.b()), g = lane(c.g()), r = lane(c.r()), al = lane(255);
+        return _mm_set_epi16(al, r, g, b, al, r, g, b);
+    }
+#endif
+
+#if defined(ZINCX_RASTER_IMPL_AVX2)
+    inline __m256i div255(__m256i t) {
+        return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+    }
+#endif
+
+#if defined(ZINCX_RASTER_IMPL_NEON)
+    inline uint8x8_t div255(uint16x8_t t) {
+        return vshrn_n_u16(vaddq_u16(t, vshrq_n_u16(t, 8)), 8);
+    }
+#endif
+}
+
+namespace ZRasterKernels {
+
+const char* name() {
+#if defined(ZINCX_RASTER_IMPL_AVX2)
+    return "avx2";
+#elif defined(ZINCX_RASTER_IMPL_SSE2)
+    return "sse2";
+#elif defined(ZINCX_RASTER_IMPL_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+void fill(ZPixelSpan<ZColor32> dst, ZColor32 color) {
+    ZColor32* p = dst.data;
+    std::size_t n = dst.size;
+    std::size_t i = 0;
+#if defined(ZINCX_RASTER_IMPL_AVX2)
+    const __m256i v = _mm256_set1_epi32(static_cast<int>(color.value));
+    for (; i + 8 <= n; i += 8) _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), v);
+#elif defined(ZINCX_RASTER_IMPL_SSE2)
+    const __m128i v = _mm_set1_epi32(static_cast<int>(color.value));
+    for (; i + 4 <= n; i += 4) _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), v);
+#elif defined(ZINCX_RASTER_IMPL_NEON)
+    const uint32x4_t v = vdupq_n_u32(color.value);
+    for (; i + 4 <= n; i += 4) vst1q_u32(reinterpret_cast<std::uint32_t*>(p + i), v);
+#endif
+    fillScalar(p + i, n - i, color);
+}
+
+void blend(ZPixelSpan<ZColor32> dst, ZColor32 color) {
+    ZColor32* p = dst.data;
+    std::size_t n = dst.size;
+    std::size_t i = 0;
+#if defined(ZINCX_RASTER_IMPL_AVX2)
+    const __m128i term128 = srcTerm128(color);
+    const __m256i srcTerm = _mm256_broadcastsi128_si256(term128);
+    const __m256i inv = _mm256_set1_epi16(static_cast<short>(255 - color.a()));
+    const __m256i zero = _mm256_setzero_si256();
+    for (; i + 8 <= n; i += 8) {
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), inv), srcTerm);
+        __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), inv), srcTerm);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), _mm256_packus_epi16(div255(lo), div255(hi)));
+    }
+#elif defined(ZINCX_RASTER_IMPL_SSE2)
+    const __m128i srcTerm = srcTerm128(color);
+    const __m128i inv = _mm_set1_epi16(static_cast<short>(255 - color.a()));
+    for (; i + 4 <= n; i += 4) {
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), blend4(d, srcTerm, inv));
+    }
+#elif defined(ZINCX_RASTER_IMPL_NEON)
+    const std::uint16_t a = color.a();
+    const uint8x8_t inv = vdup_n_u8(static_cast<std::uint8_t>(255 - a));
+    const uint16x8_t tb = vdupq_n_u16(static_cast<std::uint16_t>(color.b() * a + 128));
+    const uint16x8_t tg = vdupq_n_u16(static_cast<std::uint16_t>(color.g() * a + 128));
+    const uint16x8_t tr = vdupq_n_u16(static_cast<std::uint16_t>(color.r() * a + 128));
+    const uint16x8_t ta = vdupq_n_u16(static_cast<std::uint16_t>(255 * a + 128));
+    for (; i + 8 <= n; i += 8) {
+        std::uint8_t* bytes = reinterpret_cast<std::uint8_t*>(p + i);
+        uint8x8x4_t d = vld4_u8(bytes);
+        d.val[0] = div255(vmlal_u8(tb, d.val[0], inv));
+        d.val[1] = div255(vmlal_u8(tg, d.val[1], inv));
+        d.val[2] = div255(vmlal_u8(tr, d.val[2], inv));
+        d.val[3] = div255(vmlal_u8(ta, d.val[3], inv));
+        vst4_u8(bytes, d);
+    }
+#endif
+    blendScalar(p + i, n - i, color);
+}
+
+void blit(ZPixelSpan<ZColor32> dst, const ZColor32* src) {
+    std::memcpy(dst.data, src, dst.size * sizeof(ZColor32));
+}
+
+void blendBlit(ZPixelSpan<ZColor32> dst, const ZColor32* src) {
+    ZColor32* p = dst.data;
+    std::size_t n = dst.size;
+    std::size_t i = 0;
+#if defined(ZINCX_RASTER_IMPL_AVX2)
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i rgbMask = _mm256_set_epi16(0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1);
+    const __m256i alpha255 = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+    const __m256i bias = _mm256_set1_epi16(128);
+    const __m256i full = _mm256_set1_epi16(255);
+    auto half = [&](__m256i s16, __m256i d16) {
+        __m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s16, 0xFF), 0xFF);
+        __m256i ia = _mm256_sub_epi16(full, a);
+        __m256i s = _mm256_or_si256(_mm256_and_si256(s16, rgbMask), alpha255);
+        return div255(_mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(s, a), _mm256_mullo_epi16(d16, ia)), bias));
+    };
+    for (; i + 8 <= n; i += 8) {
+        __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        __m256i lo = half(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero));
+        __m256i hi = half(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), _mm256_packus_epi16(lo, hi));
+    }
+#elif defined(ZINCX_RASTER_IMPL_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= n; i += 4) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i lo = blendBlitHalf(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero));
+        __m128i hi = blendBlitHalf(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), _mm_packus_epi16(lo, hi));
+    }
+#elif defined(ZINCX_RASTER_IMPL_NEON)
+    const uint16x8_t bias = vdupq_n_u16(128);
+    const uint8x8_t full = vdup_n_u8(255);
+    for (; i + 8 <= n; i += 8) {
+        std::uint8_t* bytes = reinterpret_cast<std::uint8_t*>(p + i);
+        uint8x8x4_t s = vld4_u8(reinterpret_cast<const std::uint8_t*>(src + i));
+        uint8x8x4_t d = vld4_u8(bytes);
+        uint8x8_t a = s.val[3];
+        uint8x8_t ia = vsub_u8(full, a);
+        for (int c = 0; c < 3; ++c) {
+            d.val[c] = div255(vaddq_u16(vmlal_u8(vmull_u8(s.val[c], a), d.val[c], ia), bias));
+        }
+        d.val[3] = div255(vaddq_u16(vmlal_u8(vmull_u8(full, a), d.val[3], ia), bias));
+        vst4_u8(bytes, d);
+    }
+#endif
+    blendBlitScalar(p + i, src + i, n - i);
+}
+
+void blendMask(ZPixelSpan<ZColor32> dst, const std::uint8_t* coverage, ZColor32 color) {
+    const std::uint32_t alpha = color.a();
+    for (std::size_t i = 0; i < dst.size; ++i) {
+        std::uint32_t c = coverage[i];
+        if (c == 0) continue;
+        std::uint32_t a = c == 255 ? alpha : (alpha * c + 128 + ((alpha * c + 128) >> 8)) >> 8;
+        if (a == 255) dst.data[i] = color;
+        else if (a != 0) dst.data[i] = blendPixel(dst.data[i], ZColor32(color.r(), color.g(), color.b(), static_cast<std::uint8_t>(a)));
+    }
+}
+
+void convertTo565(ZPixelSpan<ZColor565> dst, const ZColor32* src) {
+    // Shift-and-mask loop; compilers vectorize it for every target above.
+    for (std::size_t i = 0; i < dst.size; ++i) dst.data[i] = ZColor565(src[i]);
+}
+
+} // namespace ZRasterKernels
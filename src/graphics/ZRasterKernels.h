@@ -0,0 +1,86 @@
+/**
+ * @file ZRasterKernels.h
+ * @brief Declares the span kernels used by the ZincX software rasterizer.
+ *
+ * This file contains the fill, blend, blit and format-conversion loops that SoftwareGraphicsBackend
+ * runs over framebuffer rows. The implementation is selected at compile time: AVX2 when the
+ * translation unit is built with it (ZINCX_RASTER_AVX2), otherwise SSE2 on x86-64, NEON on ARM,
+ * and a portable scalar path everywhere else, including DJGPP builds for 386/486 targets.
+ * Every variant produces bit-identical results.
+ */
+#pragma once
+#include "../common/ZCommon.h"
+
+namespace ZRasterKernels {
+
+/** @brief Returns the name of the kernel set compiled into this build ("avx2", "sse2", "neon" or "scalar"). */
+const char* name();
+
+/**
+ * @brief Sets every pixel of a span to one color.
+ * @param dst The pixels to overwrite.
+ * @param color The color to store, alpha included.
+ */
+void fill(ZincX::ZPixelSpan<ZincX::ZColor32> dst, ZincX::ZColor32 color);
+
+/**
+ * @brief Composites one color over every pixel of a span (source-over).
+ *
+ * Fully opaque colors should go through fill(); this path is for 0 < alpha < 255.
+ *
+ * @param dst The pixels to blend onto.
+ * @param color The color to composite, non-premultiplied.
+ */
+void blend(ZincX::ZPixelSpan<ZincX::ZColor32> dst, ZincX::ZColor32 color);
+
+/**
+ * @brief Copies pixels from one span to another of the same length.
+ * @param dst The destination pixels.
+ * @param src The source pixels; dst.size pixels are read.
+ */
+void blit(ZincX::ZPixelSpan<ZincX::ZColor32> dst, const ZincX::ZColor32* src);
+
+/**
+ * @brief Composites a span of non-premultiplied pixels over another using per-pixel alpha.
+ * @param dst The destination pixels.
+ * @param src The source pixels; dst.size pixels are read.
+ */
+void blendBlit(ZincX::ZPixelSpan<ZincX::ZColor32> dst, const ZincX::ZColor32* src);
+
+/**
+ * @brief Composites one color over a span through an 8-bit coverage mask, for atlas glyphs.
+ *
+ * Each pixel gets the color at alpha * coverage / 255; full coverage of an opaque color stores
+ * it exactly, as fill() would. Glyph rows are short, so this is scalar on every target.
+ *
+ * @param dst The pixels to blend onto.
+ * @param coverage Coverage values; dst.size are read.
+ * @param color The color to composite, non-premultiplied.
+ */
+void blendMask(ZincX::ZPixelSpan<ZincX::ZColor32> dst, const std::uint8_t* coverage, ZincX::ZColor32 color);
+
+/**
+ * @brief Converts 8888 pixels to 5:6:5, for presenting into 16 bpp video modes.
+ * @param dst The 16-bit destination pixels.
+ * @param src The 32-bit source pixels; dst.size pixels are read.
+ */
+void convertTo565(ZincX::ZPixelSpan<ZincX::ZColor565> dst, const ZincX::ZColor32* src);
+
+/**
+ * @brief Scalar source-over of one pixel, the reference the SIMD paths must match.
+ * @param dst The destination pixel.
+ * @param src The source pixel, non-premultiplied.
+ * @return The composited pixel.
+ */
+constexpr ZincX::ZColor32 blendPixel(ZincX::ZColor32 dst, ZincX::ZColor32 src) {
+    // x / 255 rounded, exact for x in [0, 255 * 255 + 127]: (t + (t >> 8)) >> 8 with t = x + 128.
+    auto div255 = [](std::uint32_t x) { x += 128; return (x + (x >> 8)) >> 8; };
+    std::uint32_t a = src.a();
+    std::uint32_t ia = 255 - a;
+    return ZincX::ZColor32(static_cast<std::uint8_t>(div255(src.r() * a + dst.r() * ia)),
+                           static_cast<std::uint8_t>(div255(src.g() * a + dst.g() * ia)),
+                           static_cast<std::uint8_t>(div255(src.b() * a + dst.b() * ia)),
+                           static_cast<std::uint8_t>(div255(255 * a + dst.a() * ia)));
+}
+
+} // namespace ZRasterKernels
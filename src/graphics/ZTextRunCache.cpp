@@ -0,0 +1,120 @@
+/**
+ * @file ZTextRunCache.cpp
+ * @brief Implementation of the ZTextRunCache class for the ZincX graphics subsystem.
+ *
+ * The index maps a hash of the whole key to the entry; a hit is confirmed by comparing the
+ * stored string and parameters, so a hash collision costs a re-shape, never a wrong run. Lookups
+ * hash the string_view directly and allocate nothing; only a miss copies the string.
+ */
+#include "ZTextRunCache.h"
+#include <functional>
+
+namespace {
+    std::size_t keyHash(std::string_view text, int width, ZincX::TextAlignment alignment, const ZFontKey& font) {
+        std::size_t h = std::hash<std::string_view>()(text);
+        auto mix = [&h](std::size_t v) { h ^= v + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2); };
+        mix(static_cast<std::size_t>(width));
+        mix(static_cast<std::size_t>(alignment));
+        mix(font.font);
+        mix(font.pixelSize);
+        mix(static_cast<std::size_t>(font.weight));
+        return h;
+    }
+}
+
+ZTextRunCache::ZTextRunCache(std::size_t capacity) : capacity_(capacity) {
+    if (capacity == 0) throw ZincX::ZException("ZTextRunCache requires a capacity of at least one run");
+}
+
+void ZTextRunCache::clear() {
+    index_.clear();
+    lru_.clear();
+}
+
+const ZTextRun& ZTextRunCache::shape(std::string_view text, int width, ZincX::TextAlignment alignment,
+                                     const ZFontKey& font, ZGlyphAtlas& atlas) {
+    const std::size_t hash = keyHash(text, width, alignment, font);
+    auto found = index_.find(hash);
+    if (found != index_.end()) {
+        Entry& entry = *found->second;
+        if (entry.text == text && entry.width == width && entry.alignment == alignment && entry.font == font) {
+            lru_.splice(lru_.begin(), lru_, found->second);
+            if (entry.run.atlasGeneration != atlas.generation()) layout(entry, atlas);
+            return entry.run;
+        }
+        // Collision: the slot is reused for the new key.
+        lru_.erase(found->second);
+        index_.erase(found);
+    }
+
+    if (lru_.size() >= capacity_) {
+        index_.erase(lru_.back().hash);
+        lru_.pop_back();
+    }
+    lru_.push_front({ hash, std::string(text), width, alignment, font, {} });
+    index_.emplace(hash, lru_.begin());
+    layout(lru_.front(), atlas);
+    return lru_.front().run;
+}
+
+void ZTextRunCache::layout(Entry& entry, ZGlyphAtlas& atlas) {
+    ZTextRun& run = entry.run;
+    const std::string_view text = entry.text;
+    const int width = entry.width;
+    std::vector<ZGlyphSlot> line;      // copies: a clear() mid-line frees the atlas's slots
+
+    // One retry: if the atlas is cleared mid-run, the slots fetched before it are stale.
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        const std::uint32_t generation = atlas.generation();
+        run.glyphs.clear();
+        run.lineEnds.clear();
+        run.lineHeight = entry.font.pixelSize;
+
+        const std::size_t lineCount = static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n')) + 1;
+        std::size_t begin = 0;
+        for (std::size_t i = 0; i < lineCount; ++i) {
+            std::size_t end = text.find('\n', begin);
+            std::string_view chars = text.substr(begin, end == std::string_view::npos ? std::string_view::npos : end - begin);
+            begin = end + 1;
+
+            // Keep the glyphs whose advance fits entirely inside the width.
+            line.clear();
+            int lineWidth = 0;
+            int gaps = 0;
+            for (char ch : chars) {
+                const ZGlyphSlot& slot = atlas.glyph(entry.font, static_cast<unsigned char>(ch));
+                if (lineWidth + slot.advance > width) break;
+                line.push_back(slot);
+                lineWidth += slot.advance;
+                if (ch == ' ') ++gaps;
+            }
+
+            int x = 0;
+            int slack = 0;
+            switch (entry.alignment) {
+                case ZincX::TextAlignment::Left: break;
+                case ZincX::TextAlignment::Center: x = (width - lineWidth) / 2; break;
+                case ZincX::TextAlignment::Right: x = width - lineWidth; break;
+                case ZincX::TextAlignment::Justified:
+                    if (i + 1 < lineCount && gaps > 0 && lineWidth < width) slack = width - lineWidth;
+                    break;
+            }
+
+            int gap = 0;
+            for (std::size_t c = 0; c < line.size(); ++c) {
+                const ZGlyphSlot& slot = line[c];
+                if (slot.rect.width > 0) run.glyphs.push_back({ x + slot.bearingX, slot.bearingY, slot.rect });
+                x += slot.advance;
+                if (slack > 0 && chars[c] == ' ') {
+                    // Spread the slack in pixels over the word gaps, leftmost gaps taking the remainder.
+                    x += slack / gaps + (gap < slack % gaps ? 1 : 0);
+                    ++gap;
+                }
+            }
+            run.lineEnds.push_back(static_cast<std::uint32_t>(run.glyphs.size()));
+        }
+
+        run.atlasGeneration = atlas.generation();
+        if (run.atlasGeneration == generation) break;
+    }
+}
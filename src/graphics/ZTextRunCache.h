@@ -0,0 +1,95 @@
+/**
+ * @file ZTextRunCache.h
+ * @brief Defines the shaped text run cache used by the ZincX text renderers.
+ *
+ * This file contains ZTextRun, a string laid out into lines of positioned atlas glyphs, and
+ * ZTextRunCache, an LRU cache of runs keyed by (string hash, bounds width, alignment, font).
+ * Shaping covers everything that depends on those: splitting at newlines, truncating lines to
+ * the width, horizontal alignment and the gap widening of TextAlignment::Justified. An unchanged
+ * label therefore redraws as one pass over its glyph list, each glyph a copy from the atlas.
+ * Vertical placement depends on the bounds height and is applied when drawing.
+ */
+#pragma once
+#include "ZGlyphAtlas.h"
+#include "../common/ZCommon.h"
+#include "../common/ZCommonEnums.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/** @brief One glyph of a run: where to draw it and which atlas rectangle to copy. */
+struct ZPlacedGlyph {
+    int x;               ///< Left edge relative to the bounds' left edge.
+    int y;               ///< Top edge relative to the top of its line.
+    ZincX::ZRect source; ///< Rectangle in the atlas.
+};
+
+/** @brief A shaped string. */
+struct ZTextRun {
+    std::vector<ZPlacedGlyph> glyphs;      ///< All visible glyphs, line by line.
+    std::vector<std::uint32_t> lineEnds;   ///< One past each line's last glyph in glyphs.
+    int lineHeight = 0;
+    std::uint32_t atlasGeneration = 0;     ///< Atlas generation the source rectangles belong to.
+
+    std::size_t lineCount() const { return lineEnds.size(); }
+
+    /** @brief Number of lines that fit in a given height. */
+    int visibleLines(int height) const {
+        return lineHeight > 0 ? std::min(static_cast<int>(lineEnds.size()), height / lineHeight) : 0;
+    }
+
+    /** @brief Top of the first line relative to the bounds' top edge. */
+    int verticalOffset(int height, ZincX::TextAlignment alignment) const {
+        return alignment == ZincX::TextAlignment::Center ? (height - visibleLines(height) * lineHeight) / 2 : 0;
+    }
+};
+
+class ZTextRunCache {
+public:
+    /**
+     * @brief Creates an empty cache.
+     * @param capacity Maximum number of runs kept; the least recently drawn one is dropped first.
+     */
+    explicit ZTextRunCache(std::size_t capacity);
+
+    /**
+     * @brief Returns the run for a string, shaping it if it is not cached or its glyphs are stale.
+     * @param text The string; each byte is one glyph, as the built-in font expects.
+     * @param width Width of the bounds the text is drawn in.
+     * @param alignment Horizontal alignment.
+     * @param font Font to shape with.
+     * @param atlas Atlas providing glyph metrics and rectangles.
+     * @return The run, valid until the next call.
+     */
+    const ZTextRun& shape(std::string_view text, int width, ZincX::TextAlignment alignment,
+                          const ZFontKey& font, ZGlyphAtlas& atlas);
+
+    void clear();
+
+    std::size_t size() const { return lru_.size(); }
+
+    /** @brief Number of shape() calls that laid the text out anew; for profiling. */
+    std::size_t shapeCount() const { return shapes_; }
+
+private:
+    struct Entry {
+        std::size_t hash;
+        std::string text;
+        int width;
+        ZincX::TextAlignment alignment;
+        ZFontKey font;
+        ZTextRun run;
+    };
+
+    static void layout(Entry& entry, ZGlyphAtlas& atlas);
+
+    std::size_t capacity_;
+    std::list<Entry> lru_;   ///< Front = most recently drawn.
+    std::unordered_map<std::size_t, std::list<Entry>::iterator> index_;
+    std::size_t shapes_ = 0;
+};
@@ -0,0 +1,32 @@
+// Instanced quad fragment stage for VulkanGraphicsBackend: flat color, atlas coverage for
+// glyphs and an analytic edge for ellipses. Output is blended with straight alpha.
+#version 450
+
+layout(set = 0, binding = 0) uniform sampler2D atlas; // R8 glyph coverage, read texel for texel
+
+layout(location = 0) in vec2 inLocal;
+layout(location = 1) flat in vec4 inColor;
+layout(location = 2) flat in uint inKind;
+layout(location = 3) flat in vec2 inRadii;
+
+layout(location = 0) out vec4 outColor;
+
+const uint KIND_GLYPH = 1u;
+const uint KIND_ELLIPSE = 2u;
+const uint KIND_ELLIPSE_OUTLINE = 3u;
+
+void main() {
+    float coverage = 1.0;
+    if (inKind == KIND_GLYPH) {
+        coverage = texelFetch(atlas, ivec2(inLocal), 0).r;
+    } else if (inKind == KIND_ELLIPSE || inKind == KIND_ELLIPSE_OUTLINE) {
+        // Signed distance to the edge in pixels, from the implicit function and its gradient.
+        vec2 p = inLocal / inRadii;
+        float f = dot(p, p) - 1.0;
+        float distance = f / max(length(2.0 * p / inRadii), 1e-4);
+        coverage = inKind == KIND_ELLIPSE ? clamp(0.5 - distance, 0.0, 1.0)
+                                          : clamp(1.0 - abs(distance + 0.5), 0.0, 1.0);
+    }
+    if (coverage <= 0.0) discard;
+    outColor = vec4(inColor.rgb, inColor.a * coverage);
+}
@@ -0,0 +1,44 @@
+// Instanced quad vertex stage for VulkanGraphicsBackend; one ZQuadInstance per instance,
+// six vertices per quad taken from gl_VertexIndex. Keep the inputs in sync with ZQuadBatch.h.
+#version 450
+
+layout(location = 0) in vec4 inRect;   // x0, y0, x1, y1 in pixels; line end points for KIND_LINE
+layout(location = 1) in vec4 inTexels; // atlas rectangle for KIND_GLYPH
+layout(location = 2) in uint inColor;  // 0xAARRGGBB
+layout(location = 3) in uint inKind;   // ZQuadKind
+
+layout(push_constant) uniform Viewport {
+    vec2 scale; // 2 / surface size
+} viewport;
+
+layout(location = 0) out vec2 outLocal;      // atlas texel, or offset from the ellipse center in pixels
+layout(location = 1) flat out vec4 outColor;
+layout(location = 2) flat out uint outKind;
+layout(location = 3) flat out vec2 outRadii;
+
+const uint KIND_GLYPH = 1u;
+const uint KIND_LINE = 4u;
+
+const vec2 kCorners[6] = vec2[](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(0.0, 1.0),
+                                vec2(0.0, 1.0), vec2(1.0, 0.0), vec2(1.0, 1.0));
+
+void main() {
+    vec2 corner = kCorners[gl_VertexIndex];
+    vec2 position;
+    if (inKind == KIND_LINE) {
+        // One pixel wide, extended half a pixel past both ends so the end pixels are covered.
+        vec2 along = inRect.zw - inRect.xy;
+        vec2 stride = 0.5 * along / max(length(along), 1e-4);
+        vec2 normal = vec2(-stride.y, stride.x);
+        position = mix(inRect.xy - stride, inRect.zw + stride, corner.x) + mix(-normal, normal, corner.y);
+    } else {
+        position = mix(inRect.xy, inRect.zw, corner);
+    }
+
+    outLocal = inKind == KIND_GLYPH ? mix(inTexels.xy, inTexels.zw, corner) : position - 0.5 * (inRect.xy + inRect.zw);
+    outRadii = 0.5 * abs(inRect.zw - inRect.xy);
+    vec4 bgra = unpackUnorm4x8(inColor);
+    outColor = bgra.zyxw;
+    outKind = inKind;
+    gl_Position = vec4(position * viewport.scale - 1.0, 0.0, 1.0);
+}
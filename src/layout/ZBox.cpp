@@ -0,0 +1,101 @@
+/**
+ * @file ZBox.cpp
+ * @brief Implementation of the ZBox class for the ZincX layout subsystem.
+ *
+ * Sizes are computed in a scratch vector so arranging does not allocate once the box has seen
+ * its child count. Arithmetic on shares uses long long; sizes are bounded by
+ * ZLayoutConstraints::kUnbounded so products cannot overflow.
+ */
+#include "ZBox.h"
+#include "../common/ZArena.h"
+#include <algorithm>
+
+ZBox::ZBox(ZincX::LayoutOrientation orientation, int spacing)
+    : orientation_(orientation), spacing_(spacing) {}
+
+void ZBox::setSpacing(int spacing) {
+    if (spacing == spacing_) return;
+    spacing_ = spacing;
+    invalidateMeasure();
+}
+
+ZincX::ZSize ZBox::measureContent() {
+    const bool horizontal = orientation_ == ZincX::LayoutOrientation::Horizontal;
+    int main = 0;
+    int cross = 0;
+    for (auto& child : children_) {
+        ZincX::ZSize outer = outerSize(*child);
+        main += horizontal ? outer.width : outer.height;
+        cross = std::max(cross, horizontal ? outer.height : outer.width);
+    }
+    if (!children_.empty()) main += spacing_ * static_cast<int>(children_.size() - 1);
+    return horizontal ? ZincX::ZSize{ main, cross } : ZincX::ZSize{ cross, main };
+}
+
+void ZBox::arrangeContent(const ZincX::ZRect& content) {
+    const std::size_t count = children_.size();
+    if (count == 0) return;
+    const bool horizontal = orientation_ == ZincX::LayoutOrientation::Horizontal;
+    auto mainOf = [horizontal](ZincX::ZSize s) { return horizontal ? s.width : s.height; };
+    auto marginsOf = [horizontal](const ZincX::ZMargin& m) { return horizontal ? m.left + m.right : m.top + m.bottom; };
+
+    // Scratch for this call only; nested arranges stack their own scopes on top.
+    ZincX::ZArena& arena = ZincX::ZArena::frame();
+    ZincX::ZArena::Scope scope(arena);
+    ZincX::ZArenaVector<int> sizes(count, 0, ZincX::ZArenaAllocator<int>(arena));
+    int total = 0;
+    int totalStretch = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        sizes[i] = mainOf(outerSize(*children_[i]));
+        total += sizes[i];
+        totalStretch += std::max(children_[i]->constraints().stretch, 0);
+    }
+    const int available = (horizontal ? content.width : content.height) - spacing_ * static_cast<int>(count - 1);
+    int extra = available - total;
+
+    if (extra > 0 && totalStretch > 0) {
+        // Share the surplus by stretch factor, capped at each child's maximum.
+        int given = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const ZLayoutConstraints& c = children_[i]->constraints();
+            if (c.stretch <= 0) continue;
+            int share = static_cast<int>(static_cast<long long>(extra) * c.stretch / totalStretch);
+            int cap = mainOf(c.maximum) + marginsOf(c.margin) - sizes[i];
+            share = std::min(share, std::max(cap, 0));
+            sizes[i] += share;
+            given += share;
+        }
+        // Rounding leftovers go to the last stretchable child that still has room.
+        for (std::size_t i = count; i-- > 0 && given < extra;) {
+            const ZLayoutConstraints& c = children_[i]->constraints();
+            if (c.stretch <= 0) continue;
+            int room = mainOf(c.maximum) + marginsOf(c.margin) - sizes[i];
+            int add = std::min(extra - given, std::max(room, 0));
+            sizes[i] += add;
+            given += add;
+        }
+    } else if (extra < 0) {
+        // Take the deficit from each child in proportion to how far it can shrink.
+        long long shrinkable = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const ZLayoutConstraints& c = children_[i]->constraints();
+            shrinkable += std::max(sizes[i] - mainOf(c.minimum) - marginsOf(c.margin), 0);
+        }
+        if (shrinkable > 0) {
+            long long deficit = std::min<long long>(-extra, shrinkable);
+            for (std::size_t i = 0; i < count; ++i) {
+                const ZLayoutConstraints& c = children_[i]->constraints();
+                long long room = std::max(sizes[i] - mainOf(c.minimum) - marginsOf(c.margin), 0);
+                sizes[i] -= static_cast<int>((deficit * room + shrinkable - 1) / shrinkable);
+            }
+        }
+    }
+
+    int pos = horizontal ? content.x : content.y;
+    for (std::size_t i = 0; i < count; ++i) {
+        ZincX::ZRect cell = horizontal ? ZincX::ZRect{ pos, content.y, sizes[i], content.height }
+                                       : ZincX::ZRect{ content.x, pos, content.width, sizes[i] };
+        placeChild(i, cell, horizontal, !horizontal);
+        pos += sizes[i] + spacing_;
+    }
+}
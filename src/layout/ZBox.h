@@ -0,0 +1,62 @@
+/**
+ * @file ZBox.h
+ * @brief Defines the box layouts of the ZincX layout subsystem.
+ *
+ * This file contains ZBox, which lines its children up along one axis, and the fixed-orientation
+ * conveniences ZHBox and ZVBox. Along the main axis children get their measured size; surplus
+ * space is shared by stretch factor and a deficit is taken from children in proportion to how far
+ * they can shrink. On the cross axis each child is placed according to its alignment.
+ */
+#pragma once
+#include "ZLayoutNode.h"
+#include <memory>
+#include <utility>
+#include <vector>
+
+class ZBox : public ZLayoutNode {
+public:
+    /**
+     * @brief Constructs an empty box.
+     * @param orientation The main axis.
+     * @param spacing Gap between adjacent children, in pixels.
+     */
+    explicit ZBox(ZincX::LayoutOrientation orientation, int spacing = 0);
+
+    ZincX::LayoutOrientation orientation() const { return orientation_; }
+
+    int spacing() const { return spacing_; }
+    void setSpacing(int spacing);
+
+    /**
+     * @brief Appends a child along the main axis.
+     * @param child The node to take ownership of.
+     * @return The added node.
+     */
+    ZLayoutNode* addChild(std::unique_ptr<ZLayoutNode> child) { return adoptChild(std::move(child)); }
+
+    /** @brief Constructs a node of type T in place and appends it. */
+    template <typename T, typename... Args>
+    T* add(Args&&... args) {
+        return static_cast<T*>(addChild(std::make_unique<T>(std::forward<Args>(args)...)));
+    }
+
+protected:
+    ZincX::ZSize measureContent() override;
+    void arrangeContent(const ZincX::ZRect& content) override;
+
+private:
+    ZincX::LayoutOrientation orientation_;
+    int spacing_;
+};
+
+/** @brief A box whose children run left to right. */
+class ZHBox : public ZBox {
+public:
+    explicit ZHBox(int spacing = 0) : ZBox(ZincX::LayoutOrientation::Horizontal, spacing) {}
+};
+
+/** @brief A box whose children run top to bottom. */
+class ZVBox : public ZBox {
+public:
+    explicit ZVBox(int spacing = 0) : ZBox(ZincX::LayoutOrientation::Vertical, spacing) {}
+};
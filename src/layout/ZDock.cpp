@@ -0,0 +1,76 @@
+/**
+ * @file ZDock.cpp
+ * @brief Implementation of the ZDock class for the ZincX layout subsystem.
+ *
+ * Measurement walks the children backwards: the innermost child's size is wrapped by each
+ * earlier strip in turn, which yields the smallest rectangle that fits every docked child.
+ */
+#include "ZDock.h"
+#include <algorithm>
+
+ZLayoutNode* ZDock::addChild(std::unique_ptr<ZLayoutNode> child, ZincX::DockArea area) {
+    ZLayoutNode* node = adoptChild(std::move(child));
+    areas_.push_back(area);
+    return node;
+}
+
+void ZDock::childRemoved(std::size_t index) {
+    areas_.erase(areas_.begin() + static_cast<std::ptrdiff_t>(index));
+}
+
+ZincX::ZSize ZDock::measureContent() {
+    ZincX::ZSize size{ 0, 0 };
+    for (std::size_t i = children_.size(); i-- > 0;) {
+        ZincX::ZSize outer = outerSize(*children_[i]);
+        switch (areas_[i]) {
+            case ZincX::DockArea::Left:
+            case ZincX::DockArea::Right:
+                size = { size.width + outer.width, std::max(size.height, outer.height) };
+                break;
+            case ZincX::DockArea::Top:
+            case ZincX::DockArea::Bottom:
+                size = { std::max(size.width, outer.width), size.height + outer.height };
+                break;
+            case ZincX::DockArea::Fill:
+                size = { std::max(size.width, outer.width), std::max(size.height, outer.height) };
+                break;
+        }
+    }
+    return size;
+}
+
+void ZDock::arrangeContent(const ZincX::ZRect& content) {
+    ZincX::ZRect remaining = content;
+    for (std::size_t i = 0; i < children_.size(); ++i) {
+        ZincX::ZSize outer = outerSize(*children_[i]);
+        int w = std::clamp(outer.width, 0, std::max(remaining.width, 0));
+        int h = std::clamp(outer.height, 0, std::max(remaining.height, 0));
+        ZincX::ZRect cell = remaining;
+        switch (areas_[i]) {
+            case ZincX::DockArea::Left:
+                cell.width = w;
+                remaining.x += w;
+                remaining.width -= w;
+                break;
+            case ZincX::DockArea::Right:
+                cell.x = remaining.x + remaining.width - w;
+                cell.width = w;
+                remaining.width -= w;
+                break;
+            case ZincX::DockArea::Top:
+                cell.height = h;
+                remaining.y += h;
+                remaining.height -= h;
+                break;
+            case ZincX::DockArea::Bottom:
+                cell.y = remaining.y + remaining.height - h;
+                cell.height = h;
+                remaining.height -= h;
+                break;
+            case ZincX::DockArea::Fill:
+                break;
+        }
+        // Strips span the dock across their cross axis; alignment applies inside the strip.
+        placeChild(i, cell);
+    }
+}
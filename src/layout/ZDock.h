@@ -0,0 +1,32 @@
+/**
+ * @file ZDock.h
+ * @brief Defines the dock layout of the ZincX layout subsystem.
+ *
+ * This file contains ZDock, which attaches children to the edges of its rectangle in insertion
+ * order: each docked child takes a strip of the space the previous ones left, and a Fill child
+ * takes whatever remains. This is the usual arrangement for toolbars, side panels and status bars
+ * around a central view.
+ */
+#pragma once
+#include "ZLayoutNode.h"
+#include <memory>
+#include <vector>
+
+class ZDock : public ZLayoutNode {
+public:
+    /**
+     * @brief Docks a child.
+     * @param child The node to take ownership of.
+     * @param area The edge to attach to, or DockArea::Fill for the remaining space.
+     * @return The added node.
+     */
+    ZLayoutNode* addChild(std::unique_ptr<ZLayoutNode> child, ZincX::DockArea area);
+
+protected:
+    ZincX::ZSize measureContent() override;
+    void arrangeContent(const ZincX::ZRect& content) override;
+    void childRemoved(std::size_t index) override;
+
+private:
+    std::vector<ZincX::DockArea> areas_; ///< Parallel to children_.
+};
@@ -0,0 +1,176 @@
+/**
+ * @file ZGrid.cpp
+ * @brief Implementation of the ZGrid class for the ZincX layout subsystem.
+ *
+ * Measurement first sizes every track from single-span children, then grows the tracks under
+ * each spanning child evenly until it fits. Arrangement only redistributes the cached track
+ * sizes, so a grid whose content did not change re-arranges without measuring any child.
+ */
+#include "ZGrid.h"
+#include "../common/ZArena.h"
+#include <algorithm>
+#include <numeric>
+
+namespace {
+    // Grows (or shrinks, toward zero) track sizes to fill the available length.
+    void distribute(ZincX::ZArenaVector<int>& sizes, const std::vector<int>& stretch, int available) {
+        int total = std::accumulate(sizes.begin(), sizes.end(), 0);
+        int extra = available - total;
+        if (extra == 0 || sizes.empty()) return;
+        if (extra > 0) {
+            long long totalStretch = 0;
+            for (std::size_t i = 0; i < sizes.size(); ++i) totalStretch += std::max(stretch[i], 0);
+            if (totalStretch == 0) return;
+            int given = 0;
+            std::size_t last = 0;
+            for (std::size_t i = 0; i < sizes.size(); ++i) {
+                if (stretch[i] <= 0) continue;
+                int share = static_cast<int>(extra * static_cast<long long>(stretch[i]) / totalStretch);
+                sizes[i] += share;
+                given += share;
+                last = i;
+            }
+            sizes[last] += extra - given;
+            return;
+        }
+        // Not enough room: shrink every track in proportion to its size.
+        long long deficit = std::min(-extra, total);
+        for (int& size : sizes) {
+            if (total > 0) size -= static_cast<int>((deficit * size + total - 1) / total);
+            size = std::max(size, 0);
+        }
+    }
+}
+
+ZGrid::ZGrid(int spacing) : spacing_(spacing) {}
+
+ZLayoutNode* ZGrid::addChild(std::unique_ptr<ZLayoutNode> child, int row, int column, int rowSpan, int columnSpan) {
+    if (row < 0 || column < 0 || rowSpan < 1 || columnSpan < 1) {
+        throw ZincX::ZException("ZGrid::addChild: invalid cell");
+    }
+    ZLayoutNode* node = adoptChild(std::move(child));
+    cells_.push_back({ row, column, rowSpan, columnSpan });
+    updateTrackCounts();
+    return node;
+}
+
+void ZGrid::childRemoved(std::size_t index) {
+    cells_.erase(cells_.begin() + static_cast<std::ptrdiff_t>(index));
+    updateTrackCounts();
+}
+
+void ZGrid::updateTrackCounts() {
+    rows_ = 0;
+    columns_ = 0;
+    for (const Cell& cell : cells_) {
+        rows_ = std::max(rows_, cell.row + cell.rowSpan);
+        columns_ = std::max(columns_, cell.column + cell.columnSpan);
+    }
+    columnStretch_.resize(static_cast<std::size_t>(std::max(columns_, static_cast<int>(columnStretch_.size()))), 0);
+    rowStretch_.resize(static_cast<std::size_t>(std::max(rows_, static_cast<int>(rowStretch_.size()))), 0);
+}
+
+void ZGrid::setColumnStretch(int column, int stretch) {
+    if (column < 0) return;
+    if (static_cast<std::size_t>(column) >= columnStretch_.size()) columnStretch_.resize(static_cast<std::size_t>(column) + 1, 0);
+    if (columnStretch_[static_cast<std::size_t>(column)] == stretch) return;
+    columnStretch_[static_cast<std::size_t>(column)] = stretch;
+    invalidateArrange();
+}
+
+void ZGrid::setRowStretch(int row, int stretch) {
+    if (row < 0) return;
+    if (static_cast<std::size_t>(row) >= rowStretch_.size()) rowStretch_.resize(static_cast<std::size_t>(row) + 1, 0);
+    if (rowStretch_[static_cast<std::size_t>(row)] == stretch) return;
+    rowStretch_[static_cast<std::size_t>(row)] = stretch;
+    invalidateArrange();
+}
+
+void ZGrid::setSpacing(int spacing) {
+    if (spacing == spacing_) return;
+    spacing_ = spacing;
+    invalidateMeasure();
+}
+
+ZincX::ZSize ZGrid::measureContent() {
+    columnWidths_.assign(static_cast<std::size_t>(columns_), 0);
+    rowHeights_.assign(static_cast<std::size_t>(rows_), 0);
+
+    // Single-cell children set the base track sizes.
+    for (std::size_t i = 0; i < children_.size(); ++i) {
+        const Cell& cell = cells_[i];
+        ZincX::ZSize outer = outerSize(*children_[i]);
+        if (cell.columnSpan == 1) {
+            int& w = columnWidths_[static_cast<std::size_t>(cell.column)];
+            w = std::max(w, outer.width);
+        }
+        if (cell.rowSpan == 1) {
+            int& h = rowHeights_[static_cast<std::size_t>(cell.row)];
+            h = std::max(h, outer.height);
+        }
+    }
+
+    // Spanning children widen their tracks evenly where the tracks are too small.
+    auto grow = [this](std::vector<int>& tracks, int first, int span, int needed) {
+        int have = spacing_ * (span - 1);
+        for (int t = first; t < first + span; ++t) have += tracks[static_cast<std::size_t>(t)];
+        int missing = needed - have;
+        for (int t = first; t < first + span && missing > 0; ++t) {
+            int add = (missing + (first + span - t) - 1) / (first + span - t);
+            tracks[static_cast<std::size_t>(t)] += add;
+            missing -= add;
+        }
+    };
+    for (std::size_t i = 0; i < children_.size(); ++i) {
+        const Cell& cell = cells_[i];
+        if (cell.columnSpan == 1 && cell.rowSpan == 1) continue;
+        ZincX::ZSize outer = outerSize(*children_[i]);
+        if (cell.columnSpan > 1) grow(columnWidths_, cell.column, cell.columnSpan, outer.width);
+        if (cell.rowSpan > 1) grow(rowHeights_, cell.row, cell.rowSpan, outer.height);
+    }
+
+    auto extent = [this](const std::vector<int>& tracks) {
+        int total = std::accumulate(tracks.begin(), tracks.end(), 0);
+        return tracks.empty() ? 0 : total + spacing_ * static_cast<int>(tracks.size() - 1);
+    };
+    return { extent(columnWidths_), extent(rowHeights_) };
+}
+
+void ZGrid::arrangeContent(const ZincX::ZRect& content) {
+    if (children_.empty()) return;
+    // Track sizes, then offsets; one extra slot each for the end of the last track.
+    ZincX::ZArena& arena = ZincX::ZArena::frame();
+    ZincX::ZArena::Scope scope(arena);
+    auto scratch = [&arena](const std::vector<int>& measured) {
+        ZincX::ZArenaVector<int> tracks{ ZincX::ZArenaAllocator<int>(arena) };
+        tracks.reserve(measured.size() + 1);
+        tracks.assign(measured.begin(), measured.end());
+        return tracks;
+    };
+    ZincX::ZArenaVector<int> columns = scratch(columnWidths_);
+    ZincX::ZArenaVector<int> rows = scratch(rowHeights_);
+    distribute(columns, columnStretch_, content.width - spacing_ * std::max(columns_ - 1, 0));
+    distribute(rows, rowStretch_, content.height - spacing_ * std::max(rows_ - 1, 0));
+
+    // Turn sizes into start offsets followed by the end of the last track.
+    auto offsets = [this](ZincX::ZArenaVector<int>& tracks, int origin) {
+        int pos = origin;
+        for (int& t : tracks) {
+            int size = t;
+            t = pos;
+            pos += size + spacing_;
+        }
+        tracks.push_back(pos);
+    };
+    offsets(columns, content.x);
+    offsets(rows, content.y);
+
+    for (std::size_t i = 0; i < children_.size(); ++i) {
+        const Cell& cell = cells_[i];
+        int x0 = columns[static_cast<std::size_t>(cell.column)];
+        int x1 = columns[static_cast<std::size_t>(cell.column + cell.columnSpan)] - spacing_;
+        int y0 = rows[static_cast<std::size_t>(cell.row)];
+        int y1 = rows[static_cast<std::size_t>(cell.row + cell.rowSpan)] - spacing_;
+        placeChild(i, { x0, y0, x1 - x0, y1 - y0 });
+    }
+}
@@ -0,0 +1,68 @@
+/**
+ * @file ZGrid.h
+ * @brief Defines the grid layout of the ZincX layout subsystem.
+ *
+ * This file contains ZGrid, which places children in rows and columns, optionally spanning
+ * several of each. Track sizes come from the largest child in each track and are cached with the
+ * grid's measurement; surplus space is shared by per-row and per-column stretch factors.
+ */
+#pragma once
+#include "ZLayoutNode.h"
+#include <memory>
+#include <vector>
+
+class ZGrid : public ZLayoutNode {
+public:
+    /**
+     * @brief Constructs an empty grid.
+     * @param spacing Gap between adjacent rows and columns, in pixels.
+     */
+    explicit ZGrid(int spacing = 0);
+
+    /**
+     * @brief Places a child in a cell range.
+     * @param child The node to take ownership of.
+     * @param row First row.
+     * @param column First column.
+     * @param rowSpan Number of rows covered, at least 1.
+     * @param columnSpan Number of columns covered, at least 1.
+     * @return The added node.
+     */
+    ZLayoutNode* addChild(std::unique_ptr<ZLayoutNode> child, int row, int column, int rowSpan = 1, int columnSpan = 1);
+
+    /** @brief Sets the share of surplus width a column receives; changes arrangement only. */
+    void setColumnStretch(int column, int stretch);
+
+    /** @brief Sets the share of surplus height a row receives; changes arrangement only. */
+    void setRowStretch(int row, int stretch);
+
+    int spacing() const { return spacing_; }
+    void setSpacing(int spacing);
+
+    int rowCount() const { return rows_; }
+    int columnCount() const { return columns_; }
+
+protected:
+    ZincX::ZSize measureContent() override;
+    void arrangeContent(const ZincX::ZRect& content) override;
+    void childRemoved(std::size_t index) override;
+
+private:
+    struct Cell {
+        int row;
+        int column;
+        int rowSpan;
+        int columnSpan;
+    };
+
+    void updateTrackCounts();
+
+    int spacing_;
+    int rows_ = 0;
+    int columns_ = 0;
+    std::vector<Cell> cells_;          ///< Parallel to children_.
+    std::vector<int> columnWidths_;    ///< Measured track sizes, valid with the cached measurement.
+    std::vector<int> rowHeights_;
+    std::vector<int> columnStretch_;
+    std::vector<int> rowStretch_;
+};
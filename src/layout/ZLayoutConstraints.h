@@ -0,0 +1,32 @@
+/**
+ * @file ZLayoutConstraints.h
+ * @brief Defines the per-node sizing constraints of the ZincX layout subsystem.
+ *
+ * This file contains ZLayoutConstraints, the set of size limits, size hint, margin, stretch
+ * factor and alignment a layout node exposes to its parent container. Changing any of them on a
+ * node invalidates the cached measurement of that node and its ancestors only.
+ */
+#pragma once
+#include "../common/ZCommon.h"
+#include "../common/ZCommonEnums.h"
+#include <algorithm>
+
+struct ZLayoutConstraints {
+    /** Upper bound used for "no maximum"; small enough that sums of sizes cannot overflow. */
+    static constexpr int kUnbounded = 1 << 24;
+
+    ZincX::ZSize minimum{0, 0};                     ///< Smallest size the node accepts.
+    ZincX::ZSize maximum{kUnbounded, kUnbounded};   ///< Largest size the node accepts.
+    ZincX::ZSize preferred{-1, -1};                 ///< Size hint; a negative component means "use the content size".
+    ZincX::ZMargin margin{0, 0, 0, 0};              ///< Space kept free around the node by its parent.
+    int stretch = 0;                                ///< Share of surplus space along a box's main axis.
+    ZincX::LayoutAlignment alignment = ZincX::LayoutAlignment::Stretch; ///< Placement within the assigned cell.
+
+    bool operator==(const ZLayoutConstraints&) const = default;
+
+    /** @brief Clamps a size to [minimum, maximum]. */
+    ZincX::ZSize clamp(ZincX::ZSize size) const {
+        return { std::clamp(size.width, minimum.width, std::max(minimum.width, maximum.width)),
+                 std::clamp(size.height, minimum.height, std::max(minimum.height, maximum.height)) };
+    }
+};
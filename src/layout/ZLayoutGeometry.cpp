@@ -0,0 +1,43 @@
+/**
+ * @file ZLayoutGeometry.cpp
+ * @brief Implementation of the ZLayoutGeometry class for the ZincX layout subsystem.
+ *
+ * Slots are recycled through a free list so the arrays stay dense across edits. commit() scans
+ * the change flags linearly; at one byte per node that is far cheaper than the setBounds() calls
+ * it issues, and it keeps the parallel pass free of any shared append.
+ */
+#include "ZLayoutGeometry.h"
+#include "ZLayoutNode.h"
+
+ZLayoutGeometry::Slot ZLayoutGeometry::allocate(ZLayoutNode* owner) {
+    if (!free_.empty()) {
+        Slot slot = free_.back();
+        free_.pop_back();
+        owners_[slot] = owner;
+        changed_[slot] = 0;
+        setRect(slot, { 0, 0, 0, 0 });
+        return slot;
+    }
+    auto slot = static_cast<Slot>(owners_.size());
+    x_.push_back(0);
+    y_.push_back(0);
+    width_.push_back(0);
+    height_.push_back(0);
+    changed_.push_back(0);
+    owners_.push_back(owner);
+    return slot;
+}
+
+void ZLayoutGeometry::release(Slot slot) {
+    owners_[slot] = nullptr;
+    changed_[slot] = 0;
+    free_.push_back(slot);
+}
+
+void ZLayoutGeometry::commit() {
+    for (std::size_t slot = 0; slot < changed_.size(); ++slot) {
+        if (!changed_[slot]) continue;
+        changed_[slot] = 0;
+        if (owners_[slot]) owners_[slot]->applyGeometry();
+    }
+}
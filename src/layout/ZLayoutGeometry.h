@@ -0,0 +1,81 @@
+/**
+ * @file ZLayoutGeometry.h
+ * @brief Defines the structure-of-arrays geometry store of the ZincX layout subsystem.
+ *
+ * This file contains ZLayoutGeometry, which holds the arranged rectangle of every node in one
+ * layout tree as four parallel arrays (x, y, width, height) indexed by a per-node slot. A parallel
+ * arrange pass writes disjoint slots from several threads without touching any widget; commit()
+ * then applies the changed rectangles to the wrapped items serially, on the calling thread. The
+ * flat arrays are also what a batched backend pass consumes directly.
+ */
+#pragma once
+#include "../common/ZCommon.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class ZCompute;
+class ZLayoutNode;
+
+class ZLayoutGeometry {
+public:
+    using Slot = std::uint32_t;
+
+    ZLayoutGeometry() = default;
+    ZLayoutGeometry(const ZLayoutGeometry&) = delete;
+    ZLayoutGeometry& operator=(const ZLayoutGeometry&) = delete;
+
+    /**
+     * @brief Reserves a slot for a node, reusing a released one if available.
+     * @param owner The node the slot belongs to; receives applyGeometry() calls.
+     * @return The slot index.
+     */
+    Slot allocate(ZLayoutNode* owner);
+
+    /** @brief Returns a slot to the free list. */
+    void release(Slot slot);
+
+    ZincX::ZRect rect(Slot slot) const { return { x_[slot], y_[slot], width_[slot], height_[slot] }; }
+
+    void setRect(Slot slot, const ZincX::ZRect& rect) {
+        x_[slot] = rect.x;
+        y_[slot] = rect.y;
+        width_[slot] = rect.width;
+        height_[slot] = rect.height;
+    }
+
+    /**
+     * @brief Flags a slot for the next commit().
+     *
+     * Safe to call concurrently for distinct slots: each flag is its own byte.
+     */
+    void markChanged(Slot slot) { changed_[slot] = 1; }
+
+    /** @brief Calls applyGeometry() on the owner of every flagged slot and clears the flags. */
+    void commit();
+
+    /** @brief Number of slots, including released ones; the length of the arrays below. */
+    std::size_t size() const { return owners_.size(); }
+
+    /** @name Raw arrays, indexed by slot. Released slots hold stale values. */
+    ///@{
+    const std::vector<int>& xs() const { return x_; }
+    const std::vector<int>& ys() const { return y_; }
+    const std::vector<int>& widths() const { return width_; }
+    const std::vector<int>& heights() const { return height_; }
+    ///@}
+
+    /** @brief The pool used by the layout pass in progress, or null outside a pass or when serial. */
+    ZCompute* compute() const { return compute_; }
+    void setCompute(ZCompute* compute) { compute_ = compute; }
+
+private:
+    std::vector<int> x_;
+    std::vector<int> y_;
+    std::vector<int> width_;
+    std::vector<int> height_;
+    std::vector<std::uint8_t> changed_;
+    std::vector<ZLayoutNode*> owners_;
+    std::vector<Slot> free_;
+    ZCompute* compute_ = nullptr;
+};
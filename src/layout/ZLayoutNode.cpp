@@ -0,0 +1,219 @@
+/**
+ * @file ZLayoutNode.cpp
+ * @brief Implementation of the ZLayoutNode and ZLayoutItem classes for the ZincX layout subsystem.
+ *
+ * Dirty state has two levels. measureDirty_ means the cached size is stale and lives only on the
+ * changed node and its ancestors; arrangeDirty_ follows the same path and tells arrange() to
+ * descend even though the node's own rectangle did not change. Everything off that path keeps
+ * both flags clear and is skipped unless its parent hands it a different rectangle.
+ *
+ * The parallel pass relies on subtrees being disjoint: a child's measure() and arrange() touch
+ * only nodes below it and their slots, the geometry arrays are never resized during a pass, and
+ * no graphics item is touched until the serial commit.
+ */
+#include "ZLayoutNode.h"
+#include "../compute/ZCompute.h"
+#include "../debug/ZProfiler.h"
+#include "../graphics/ZGraphicsItem.h"
+#include <algorithm>
+
+namespace {
+    constexpr ZincX::ZPadding toPadding(const ZincX::ZMargin& m) {
+        return { m.left, m.top, m.right, m.bottom };
+    }
+
+    // Offset of a span of the given size inside the available length.
+    int alignOffset(ZincX::LayoutAlignment alignment, int available, int size) {
+        switch (alignment) {
+            case ZincX::LayoutAlignment::Center: return (available - size) / 2;
+            case ZincX::LayoutAlignment::End: return available - size;
+            case ZincX::LayoutAlignment::Start:
+            case ZincX::LayoutAlignment::Stretch: return 0;
+        }
+        return 0;
+    }
+
+    // Runs fn(child, index) over all children on the pool, in chunks of about
+    // kParallelSubtree nodes so a box of many leaves is not split one leaf per task.
+    template <typename F>
+    void forEachChildParallel(ZCompute& compute, std::vector<std::unique_ptr<ZLayoutNode>>& children,
+                              std::size_t subtreeSize, F&& fn) {
+        std::size_t grain = std::max<std::size_t>(1, children.size() * ZLayoutNode::kParallelSubtree / subtreeSize);
+        compute.parallelFor(0, children.size(), [&](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) fn(*children[i], i);
+        }, grain);
+    }
+}
+
+ZLayoutNode::~ZLayoutNode() {
+    // Children release their slots into store_, which may be ownStore_; destroy them first.
+    children_.clear();
+    if (store_ && store_ != ownStore_.get()) store_->release(slot_);
+}
+
+ZLayoutGeometry& ZLayoutNode::geometry() {
+    if (!store_) {
+        ownStore_ = std::make_unique<ZLayoutGeometry>();
+        store_ = ownStore_.get();
+        slot_ = store_->allocate(this);
+    }
+    return *store_;
+}
+
+void ZLayoutNode::attachGeometry(ZLayoutGeometry* store) {
+    ZincX::ZRect current = rect();
+    if (store_) store_->release(slot_);
+    store_ = store;
+    slot_ = store->allocate(this);
+    store->setRect(slot_, current);
+    for (auto& child : children_) child->attachGeometry(store);
+}
+
+ZCompute* ZLayoutNode::parallelPool() const {
+    if (children_.size() < 2 || subtreeSize_ < kParallelSubtree || !store_) return nullptr;
+    return store_->compute();
+}
+
+void ZLayoutNode::setConstraints(const ZLayoutConstraints& constraints) {
+    if (constraints == constraints_) return;
+    constraints_ = constraints;
+    invalidateMeasure();
+}
+
+void ZLayoutNode::setSizeHint(ZincX::ZSize preferred) {
+    if (preferred == constraints_.preferred) return;
+    constraints_.preferred = preferred;
+    invalidateMeasure();
+}
+
+void ZLayoutNode::setPadding(const ZincX::ZPadding& padding) {
+    if (padding == padding_) return;
+    padding_ = padding;
+    invalidateMeasure();
+}
+
+void ZLayoutNode::invalidateMeasure() {
+    for (ZLayoutNode* node = this; node; node = node->parent_) {
+        if (node->measureDirty_ && node != this) break;
+        node->measureDirty_ = true;
+        node->arrangeDirty_ = true;
+    }
+}
+
+void ZLayoutNode::invalidateArrange() {
+    for (ZLayoutNode* node = this; node && !(node->arrangeDirty_ && node != this); node = node->parent_) {
+        node->arrangeDirty_ = true;
+    }
+}
+
+ZLayoutNode* ZLayoutNode::adoptChild(std::unique_ptr<ZLayoutNode> child) {
+    if (!child) throw ZincX::ZException("ZLayoutNode: cannot add a null child");
+    if (child->parent_) throw ZincX::ZException("ZLayoutNode: child already has a parent");
+    child->parent_ = this;
+    child->attachGeometry(&geometry());
+    child->ownStore_.reset();
+    for (ZLayoutNode* node = this; node; node = node->parent_) node->subtreeSize_ += child->subtreeSize_;
+    children_.push_back(std::move(child));
+    invalidateMeasure();
+    return children_.back().get();
+}
+
+void ZLayoutNode::removeChild(ZLayoutNode* child) {
+    auto it = std::find_if(children_.begin(), children_.end(),
+                           [child](const std::unique_ptr<ZLayoutNode>& c) { return c.get() == child; });
+    if (it == children_.end()) throw ZincX::ZException("ZLayoutNode::removeChild: not a child of this node");
+    for (ZLayoutNode* node = this; node; node = node->parent_) node->subtreeSize_ -= child->subtreeSize_;
+    childRemoved(static_cast<std::size_t>(it - children_.begin()));
+    children_.erase(it);
+    invalidateMeasure();
+}
+
+ZincX::ZSize ZLayoutNode::measure() {
+    if (measureDirty_) {
+        // Measure the children first so measureContent() only reads cached sizes.
+        if (ZCompute* compute = parallelPool()) {
+            forEachChildParallel(*compute, children_, subtreeSize_, [](ZLayoutNode& child, std::size_t) { child.measure(); });
+        }
+        ++measureCount_;
+        ZincX::ZSize content = measureContent();
+        const ZincX::ZSize& hint = constraints_.preferred;
+        ZincX::ZSize size{ hint.width >= 0 ? hint.width : content.width + padding_.left + padding_.right,
+                           hint.height >= 0 ? hint.height : content.height + padding_.top + padding_.bottom };
+        measured_ = constraints_.clamp(size);
+        measureDirty_ = false;
+    }
+    return measured_;
+}
+
+void ZLayoutNode::arrange(const ZincX::ZRect& rect) {
+    ZLayoutGeometry& store = geometry();
+    if (arranged_ && !arrangeDirty_ && rect == store.rect(slot_)) return;
+    measure();
+    store.setRect(slot_, rect);
+    arranged_ = true;
+    childRects_.resize(children_.size(), ZincX::ZRect{ 0, 0, 0, 0 });
+    arrangeContent(rect.deflate(padding_));
+    if (ZCompute* compute = parallelPool()) {
+        forEachChildParallel(*compute, children_, subtreeSize_,
+                             [this](ZLayoutNode& child, std::size_t i) { child.arrange(childRects_[i]); });
+    } else {
+        for (std::size_t i = 0; i < children_.size(); ++i) children_[i]->arrange(childRects_[i]);
+    }
+    arrangeDirty_ = false;
+}
+
+void ZLayoutNode::layout(const ZincX::ZRect& rect, ZCompute* compute) {
+    ZINCX_PROFILE_SCOPE("ZLayoutNode::layout", Layout);
+    ZINCX_PROFILE_COUNT(LayoutPasses, 1);
+    ZLayoutGeometry& store = geometry();
+    store.setCompute(compute);
+    try {
+        measure();
+        arrange(rect);
+    } catch (...) {
+        store.setCompute(nullptr);
+        throw;
+    }
+    store.setCompute(nullptr);
+    store.commit();
+}
+
+ZincX::ZSize ZLayoutNode::outerSize(ZLayoutNode& child) {
+    ZincX::ZSize size = child.measure();
+    const ZincX::ZMargin& m = child.constraints_.margin;
+    return { size.width + m.left + m.right, size.height + m.top + m.bottom };
+}
+
+void ZLayoutNode::placeChild(std::size_t index, const ZincX::ZRect& cell, bool fillWidth, bool fillHeight) {
+    ZLayoutNode& child = *children_[index];
+    const ZLayoutConstraints& c = child.constraints_;
+    ZincX::ZRect area = cell.deflate(toPadding(c.margin));
+    ZincX::ZSize measured = child.measure();
+    bool stretch = c.alignment == ZincX::LayoutAlignment::Stretch;
+    int width = fillWidth || stretch ? std::min(area.width, c.maximum.width) : std::min(area.width, measured.width);
+    int height = fillHeight || stretch ? std::min(area.height, c.maximum.height) : std::min(area.height, measured.height);
+    width = std::max(width, 0);
+    height = std::max(height, 0);
+    childRects_[index] = { area.x + alignOffset(c.alignment, area.width, width),
+                           area.y + alignOffset(c.alignment, area.height, height), width, height };
+}
+
+ZLayoutItem::ZLayoutItem(ZGraphicsItem* item, ZincX::ZSize sizeHint)
+    : item_(item), natural_{ item ? item->bounds().width : 0, item ? item->bounds().height : 0 } {
+    ZLayoutConstraints c;
+    c.preferred = sizeHint;
+    setConstraints(c);
+}
+
+ZincX::ZSize ZLayoutItem::measureContent() {
+    return natural_;
+}
+
+void ZLayoutItem::arrangeContent(const ZincX::ZRect&) {
+    if (item_) markGeometryChanged();
+}
+
+void ZLayoutItem::applyGeometry() {
+    // setBounds() is a no-op for an unchanged rectangle, so re-arranging never damages the view.
+    item_->setBounds(rect().deflate(padding()));
+}
@@ -0,0 +1,227 @@
+/**
+ * @file ZLayoutNode.h
+ * @brief Defines the node base class of the ZincX incremental layout engine.
+ *
+ * This file contains ZLayoutNode, the common base of layout containers (ZBox, ZGrid, ZDock) and
+ * ZLayoutItem, the leaf that positions a ZGraphicsItem. Layout runs in two passes: measure()
+ * computes each node's desired size bottom-up and caches it, arrange() assigns rectangles
+ * top-down. Both are incremental: a change marks only the node and its ancestors dirty, a clean
+ * node returns its cached measurement, and arrange() skips any subtree whose rectangle did not
+ * change and which holds no dirty node. Relayout after editing one widget therefore touches one
+ * root-to-leaf path plus the siblings whose rectangles actually moved.
+ *
+ * Rectangles live in the tree's ZLayoutGeometry rather than in the nodes. Given a ZCompute pool,
+ * layout() measures and arranges the children of large subtrees in parallel; leaves only record
+ * their rectangles, and the changed ones are applied to the graphics items serially at the end.
+ */
+#pragma once
+#include "ZLayoutConstraints.h"
+#include "ZLayoutGeometry.h"
+#include "../common/ZConfig.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#ifdef ZINCX_THREAD_SAFE
+#include <atomic>
+#endif
+
+class ZCompute;
+class ZGraphicsItem;
+
+class ZLayoutNode {
+public:
+    virtual ~ZLayoutNode();
+
+    ZLayoutNode(const ZLayoutNode&) = delete;
+    ZLayoutNode& operator=(const ZLayoutNode&) = delete;
+
+    const ZLayoutConstraints& constraints() const { return constraints_; }
+
+    /** @brief Replaces the node's constraints, invalidating its measurement if they changed. */
+    void setConstraints(const ZLayoutConstraints& constraints);
+
+    /** @brief Changes only the size hint; see ZLayoutConstraints::preferred. */
+    void setSizeHint(ZincX::ZSize preferred);
+
+    const ZincX::ZPadding& padding() const { return padding_; }
+
+    /** @brief Sets the space between the node's rectangle and its content. */
+    void setPadding(const ZincX::ZPadding& padding);
+
+    ZLayoutNode* parent() const { return parent_; }
+    std::size_t childCount() const { return children_.size(); }
+    ZLayoutNode* child(std::size_t index) const { return children_[index].get(); }
+
+    /**
+     * @brief Removes and destroys a child.
+     * @param child A direct child of this node.
+     */
+    void removeChild(ZLayoutNode* child);
+
+    /**
+     * @brief Returns the desired outer size (margins excluded), measuring only if dirty.
+     * @return The content size plus padding, clamped to the constraints.
+     */
+    ZincX::ZSize measure();
+
+    /**
+     * @brief Places the node in a rectangle and arranges its children.
+     *
+     * Returns immediately if the rectangle equals the previous one and nothing below is dirty.
+     * Leaves only record their rectangles; they reach the graphics items on geometry().commit(),
+     * which layout() calls.
+     *
+     * @param rect The node's rectangle in view coordinates, margins already removed.
+     */
+    void arrange(const ZincX::ZRect& rect);
+
+    /**
+     * @brief Runs a full incremental pass with the node as root and applies the result.
+     *
+     * Calls measure(), then arrange(rect), then commits the changed rectangles to the items.
+     *
+     * @param rect The root rectangle.
+     * @param compute Pool for measuring and arranging large sibling subtrees in parallel;
+     *        null runs the whole pass on the calling thread.
+     */
+    void layout(const ZincX::ZRect& rect, ZCompute* compute = nullptr);
+
+    /** @brief The rectangle assigned by the last arrange(). */
+    ZincX::ZRect rect() const { return store_ ? store_->rect(slot_) : ZincX::ZRect{ 0, 0, 0, 0 }; }
+
+    /** @brief The geometry store shared by this node's whole tree, created on first use. */
+    ZLayoutGeometry& geometry();
+
+    /** @brief This node's index into geometry(). */
+    ZLayoutGeometry::Slot geometrySlot() { geometry(); return slot_; }
+
+    /** @brief Number of nodes in this subtree, the node itself included. */
+    std::size_t subtreeSize() const { return subtreeSize_; }
+
+    /** @brief True if a measure or arrange pass is pending anywhere in this subtree. */
+    bool needsLayout() const { return measureDirty_ || arrangeDirty_; }
+
+    /**
+     * @brief Marks the node's measurement stale and propagates to its ancestors.
+     *
+     * Subclasses call this when content that affects their size changes. Propagation stops at the
+     * first ancestor that is already dirty.
+     */
+    void invalidateMeasure();
+
+    /**
+     * @brief Forces the next arrange() to re-run arrangeContent() without re-measuring.
+     *
+     * For changes that only affect how space is shared out, such as stretch factors.
+     */
+    void invalidateArrange();
+
+    /** @brief Number of measureContent() calls made so far, process-wide; for profiling. */
+    static std::size_t measureCount() { return measureCount_; }
+
+    /** Smallest subtree whose children a parallel pass fans out; also the target work per chunk. */
+    static constexpr std::size_t kParallelSubtree = 64;
+
+protected:
+    ZLayoutNode() = default;
+
+    /**
+     * @brief Adopts a child node.
+     * @param child The node to take ownership of.
+     * @return The adopted node.
+     */
+    ZLayoutNode* adoptChild(std::unique_ptr<ZLayoutNode> child);
+
+    /** @brief Computes the size of the content, padding excluded. */
+    virtual ZincX::ZSize measureContent() = 0;
+
+    /**
+     * @brief Positions the content inside the given rectangle (padding already removed).
+     *
+     * Containers assign each child a cell with placeChild(); the children are arranged after
+     * this returns, possibly in parallel. Leaves call markGeometryChanged() and apply the
+     * rectangle in applyGeometry().
+     */
+    virtual void arrangeContent(const ZincX::ZRect& content) = 0;
+
+    /**
+     * @brief Applies the node's committed rectangle to whatever it wraps.
+     *
+     * Called serially by ZLayoutGeometry::commit() for nodes that called markGeometryChanged().
+     */
+    virtual void applyGeometry() {}
+
+    /** @brief Schedules applyGeometry() for the next commit; safe to call from a parallel pass. */
+    void markGeometryChanged() { store_->markChanged(slot_); }
+
+    /** @brief Called before a child is destroyed so containers can drop per-child data. */
+    virtual void childRemoved(std::size_t /*index*/) {}
+
+    /**
+     * @brief Assigns a child its rectangle within a cell, honoring its margin, maximum size and alignment.
+     * @param index The child's index in children_.
+     * @param cell The space allotted to the child, margins included.
+     * @param fillWidth Use the full cell width regardless of alignment (a box's main axis).
+     * @param fillHeight Use the full cell height regardless of alignment.
+     */
+    void placeChild(std::size_t index, const ZincX::ZRect& cell, bool fillWidth = false, bool fillHeight = false);
+
+    /** @brief Returns a child's measured size plus its margins. */
+    static ZincX::ZSize outerSize(ZLayoutNode& child);
+
+    std::vector<std::unique_ptr<ZLayoutNode>> children_;
+
+private:
+    friend class ZLayoutGeometry;
+
+    /** @brief Moves this subtree's slots into another store. */
+    void attachGeometry(ZLayoutGeometry* store);
+
+    /** @brief The pool to fan out children on, or null if this subtree should run serially. */
+    ZCompute* parallelPool() const;
+
+    ZLayoutConstraints constraints_;
+    ZincX::ZPadding padding_{0, 0, 0, 0};
+    ZLayoutNode* parent_ = nullptr;
+    ZincX::ZSize measured_{0, 0};
+    std::vector<ZincX::ZRect> childRects_;       ///< Rectangles placeChild() assigned, by child index.
+    std::unique_ptr<ZLayoutGeometry> ownStore_;  ///< Set only while the node is a root.
+    ZLayoutGeometry* store_ = nullptr;
+    ZLayoutGeometry::Slot slot_ = 0;
+    std::size_t subtreeSize_ = 1;
+    bool measureDirty_ = true;   ///< measured_ is stale.
+    bool arrangeDirty_ = true;   ///< This node or a descendant must re-run arrangeContent().
+    bool arranged_ = false;      ///< The slot holds a real assignment.
+
+#ifdef ZINCX_THREAD_SAFE
+    static inline std::atomic<std::size_t> measureCount_{0};
+#else
+    static inline std::size_t measureCount_ = 0;
+#endif
+};
+
+/**
+ * @brief A layout leaf that sizes and positions one graphics item.
+ */
+class ZLayoutItem : public ZLayoutNode {
+public:
+    /**
+     * @brief Wraps an item.
+     * @param item The item to position; may be null for a spacer. Not owned.
+     * @param sizeHint The preferred size; negative components fall back to the item's size at
+     *        construction, so the arranged size never feeds back into the measurement.
+     */
+    explicit ZLayoutItem(ZGraphicsItem* item, ZincX::ZSize sizeHint = { -1, -1 });
+
+    ZGraphicsItem* item() const { return item_; }
+
+protected:
+    ZincX::ZSize measureContent() override;
+    void arrangeContent(const ZincX::ZRect& content) override;
+    void applyGeometry() override;
+
+private:
+    ZGraphicsItem* item_;
+    ZincX::ZSize natural_;
+};
@@ -0,0 +1,187 @@
+/**
+ * @file ZModel.cpp
+ * @brief Implementation of the ZModel class for the ZincX MVC subsystem.
+ *
+ * A batch keeps at most one structural run, inserted or removed, plus a sorted list of disjoint
+ * changed ranges. Structural changes are applied to the pending ranges as they arrive, so the
+ * ranges always use the row numbers of the model as it is now: cells in front of an insertion
+ * keep their numbers, cells behind it move down, and a range the insertion falls into is split
+ * around the new rows, which observers read anyway. When the list grows past kMaxBatchRanges the
+ * two ranges with the smallest gap are merged, trading a few extra redrawn rows for a bounded
+ * number of notifications.
+ */
+#include "ZModel.h"
+#include <algorithm>
+
+namespace {
+    void unite(ZModelRange& into, const ZModelRange& range) {
+        const std::size_t endRow = std::max(into.endRow(), range.endRow());
+        const std::size_t endColumn = std::max(into.endColumn(), range.endColumn());
+        into.firstRow = std::min(into.firstRow, range.firstRow);
+        into.firstColumn = std::min(into.firstColumn, range.firstColumn);
+        into.rowCount = endRow - into.firstRow;
+        into.columnCount = endColumn - into.firstColumn;
+    }
+}
+
+void ZModel::fetch(std::size_t, std::size_t) const {}
+
+void ZModel::endBatch() {
+    if (batchDepth_ == 0 || --batchDepth_ > 0) return;
+    if (pendingReset_) {
+        pendingReset_ = false;
+        reset.emit();
+        return;
+    }
+    // Take the pending state first: slots may change the model and notify again.
+    const std::size_t insertedFirst = insertedFirst_, insertedCount = insertedCount_;
+    const std::size_t removedFirst = removedFirst_, removedCount = removedCount_;
+    insertedCount_ = removedCount_ = 0;
+    std::vector<Changed> changed;
+    changed.swap(changed_);
+
+    if (removedCount) rowsRemoved.emit(removedFirst, removedCount);
+    if (insertedCount) rowsInserted.emit(insertedFirst, insertedCount);
+    for (const Changed& c : changed) dataChanged.emit(c.range, c.roles);
+    if (changed_.empty()) {
+        changed.clear();
+        changed_.swap(changed);
+    }
+}
+
+void ZModel::notifyRowsInserted(std::size_t first, std::size_t count) {
+    if (count == 0) return;
+    if (batchDepth_ == 0) {
+        rowsInserted.emit(first, count);
+        return;
+    }
+    if (pendingReset_) return;
+    if (removedCount_ == 0 && (insertedCount_ == 0 || (first >= insertedFirst_ && first <= insertedFirst_ + insertedCount_))) {
+        if (insertedCount_ == 0) insertedFirst_ = first;
+        insertedCount_ += count;
+        shiftChanged(first, count, true);
+    } else {
+        notifyReset();
+    }
+}
+
+void ZModel::notifyRowsRemoved(std::size_t first, std::size_t count) {
+    if (count == 0) return;
+    if (batchDepth_ == 0) {
+        rowsRemoved.emit(first, count);
+        return;
+    }
+    if (pendingReset_) return;
+    if (insertedCount_ > 0) {
+        // Only rows that were inserted in this batch can go without anyone having seen them.
+        if (first < insertedFirst_ || first + count > insertedFirst_ + insertedCount_) {
+            notifyReset();
+            return;
+        }
+        insertedCount_ -= count;
+    } else if (removedCount_ == 0) {
+        removedFirst_ = first;
+        removedCount_ = count;
+    } else if (first <= removedFirst_ && removedFirst_ <= first + count) {
+        // Rows on either side of the earlier removal, which now meet at removedFirst_.
+        removedFirst_ = first;
+        removedCount_ += count;
+    } else {
+        notifyReset();
+        return;
+    }
+    shiftChanged(first, count, false);
+}
+
+void ZModel::notifyDataChanged(const ZModelRange& range, ZModelRoles roles) {
+    if (range.isEmpty() || roles == 0) return;
+    if (batchDepth_ == 0) {
+        dataChanged.emit(range, roles);
+        return;
+    }
+    if (pendingReset_) return;
+    if (insertedCount_ > 0 && range.firstRow >= insertedFirst_ && range.endRow() <= insertedFirst_ + insertedCount_) return;
+    addChanged(range, roles);
+}
+
+void ZModel::notifyReset() {
+    if (batchDepth_ == 0) {
+        reset.emit();
+        return;
+    }
+    pendingReset_ = true;
+    insertedCount_ = removedCount_ = 0;
+    changed_.clear();
+}
+
+void ZModel::addChanged(const ZModelRange& range, ZModelRoles roles) {
+    // The first range that overlaps or touches the new one, then every further one it reaches.
+    auto begin = std::lower_bound(changed_.begin(), changed_.end(), range.firstRow,
+                                  [](const Changed& c, std::size_t row) { return c.range.endRow() < row; });
+    Changed merged{ range, roles };
+    auto end = begin;
+    for (; end != changed_.end() && end->range.firstRow <= merged.range.endRow(); ++end) {
+        unite(merged.range, end->range);
+        merged.roles |= end->roles;
+    }
+    if (begin == end) {
+        changed_.insert(begin, merged);
+        if (changed_.size() > kMaxBatchRanges) mergeClosest();
+    } else {
+        *begin = merged;
+        changed_.erase(begin + 1, end);
+    }
+}
+
+void ZModel::shiftChanged(std::size_t first, std::size_t count, bool inserted) {
+    if (inserted) {
+        for (std::size_t i = 0; i < changed_.size(); ++i) {
+            ZModelRange& range = changed_[i].range;
+            if (range.firstRow >= first) {
+                range.firstRow += count;
+            } else if (range.endRow() > first) {
+                Changed after = changed_[i];
+                after.range.firstRow = first + count;
+                after.range.rowCount = range.endRow() - first;
+                range.rowCount = first - range.firstRow;
+                changed_.insert(changed_.begin() + static_cast<std::ptrdiff_t>(++i), after);
+            }
+        }
+        while (changed_.size() > kMaxBatchRanges) mergeClosest();
+        return;
+    }
+    const std::size_t end = first + count;
+    auto map = [first, end, count](std::size_t row) { return row <= first ? row : row >= end ? row - count : first; };
+    std::size_t kept = 0;
+    for (const Changed& c : changed_) {
+        const std::size_t from = map(c.range.firstRow);
+        const std::size_t to = map(c.range.endRow());
+        if (to <= from) continue;
+        // The removal may have closed the gap to the previous range.
+        if (kept > 0 && changed_[kept - 1].range.endRow() == from) {
+            unite(changed_[kept - 1].range, { from, to - from, c.range.firstColumn, c.range.columnCount });
+            changed_[kept - 1].roles |= c.roles;
+            continue;
+        }
+        Changed& out = changed_[kept++];
+        out = c;
+        out.range.firstRow = from;
+        out.range.rowCount = to - from;
+    }
+    changed_.resize(kept);
+}
+
+void ZModel::mergeClosest() {
+    std::size_t best = 0;
+    std::size_t bestGap = static_cast<std::size_t>(-1);
+    for (std::size_t i = 0; i + 1 < changed_.size(); ++i) {
+        const std::size_t gap = changed_[i + 1].range.firstRow - changed_[i].range.endRow();
+        if (gap < bestGap) {
+            bestGap = gap;
+            best = i;
+        }
+    }
+    unite(changed_[best].range, changed_[best + 1].range);
+    changed_[best].roles |= changed_[best + 1].roles;
+    changed_.erase(changed_.begin() + static_cast<std::ptrdiff_t>(best) + 1);
+}
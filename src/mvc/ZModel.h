@@ -0,0 +1,140 @@
+/**
+ * @file ZModel.h
+ * @brief Defines the data model interface of the ZincX MVC subsystem.
+ *
+ * This file contains ZModel, a table of rows and columns that views read from, ZModelRange, a
+ * block of its cells, and ZModelBatch, a scope that coalesces change notifications. A model only
+ * answers for the cells it is asked about: views pull the rows they show by index range,
+ * announcing each range with fetch() before reading it cell by cell, so a model of millions of
+ * rows can compute or page in its data on demand instead of holding it all.
+ *
+ * Observers register through the model's signals, which say what changed: rows inserted or
+ * removed, or a range of cells whose roles changed, so a view redraws only what it shows of the
+ * change. Between beginBatch() and endBatch() a model emits nothing; it folds its changes into
+ * one structural change and a few disjoint changed ranges and emits those when the batch ends.
+ * A feed applying thousands of updates per frame inside one batch costs each view a handful of
+ * notifications per frame rather than one per update.
+ *
+ * Like the scene graph, models are read and notified from the UI thread only.
+ */
+#pragma once
+#include "../common/ZCommonEnums.h"
+#include "../event/ZSignal.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** @brief Bit mask of ZincX::ModelRole values. */
+using ZModelRoles = std::uint32_t;
+
+constexpr ZModelRoles zRole(ZincX::ModelRole role) { return ZModelRoles(1) << static_cast<unsigned>(role); }
+
+constexpr ZModelRoles kAllModelRoles = ~ZModelRoles(0);
+
+/** @brief A block of cells: rows [firstRow, firstRow + rowCount) by columns [firstColumn, firstColumn + columnCount). */
+struct ZModelRange {
+    std::size_t firstRow = 0;
+    std::size_t rowCount = 0;
+    std::size_t firstColumn = 0;
+    std::size_t columnCount = 0;
+
+    std::size_t endRow() const { return firstRow + rowCount; }
+    std::size_t endColumn() const { return firstColumn + columnCount; }
+    bool isEmpty() const { return rowCount == 0 || columnCount == 0; }
+};
+
+class ZModel {
+public:
+    /** @brief Most disjoint changed ranges a batch keeps; beyond this the closest ones are merged. */
+    static constexpr std::size_t kMaxBatchRanges = 32;
+
+    ZModel() = default;
+    virtual ~ZModel() = default;
+
+    ZModel(const ZModel&) = delete;
+    ZModel& operator=(const ZModel&) = delete;
+
+    virtual std::size_t rowCount() const = 0;
+    virtual std::size_t columnCount() const { return 1; }
+
+    /**
+     * @brief Writes the display text of one cell.
+     *
+     * @p out is assigned rather than returned so views can reuse its capacity row after row.
+     */
+    virtual void data(std::size_t row, std::size_t column, std::string& out) const = 0;
+
+    /**
+     * @brief Announces that rows [first, first + count) are about to be read.
+     *
+     * Views call this once per run of newly shown rows. Models backed by slow storage load the
+     * range in one go here; the default does nothing.
+     */
+    virtual void fetch(std::size_t first, std::size_t count) const;
+
+    /** @brief Starts holding back notifications; batches nest, and only the outermost one counts. */
+    void beginBatch() { ++batchDepth_; }
+
+    /** @brief Ends a batch; the outermost end emits the coalesced changes. */
+    void endBatch();
+
+    bool isBatching() const { return batchDepth_ > 0; }
+
+    /** @brief Emitted after rows [first, first + count) were inserted; later rows moved down by count. */
+    mutable ZSignal<std::size_t, std::size_t> rowsInserted;
+
+    /** @brief Emitted after rows [first, first + count) were removed; later rows moved up by count. */
+    mutable ZSignal<std::size_t, std::size_t> rowsRemoved;
+
+    /** @brief Emitted after the given roles of a range of cells changed. */
+    mutable ZSignal<ZModelRange, ZModelRoles> dataChanged;
+
+    /** @brief Emitted after the rows changed wholesale; observers must re-read everything. */
+    mutable ZSignal<> reset;
+
+protected:
+    /**
+     * @name Notifications for subclasses
+     * Call these after changing the data; they emit at once or, in a batch, when it ends.
+     * Inside a batch, insertions that extend one run, removals that extend one run, or removals
+     * from the run just inserted coalesce; any other mix of structural changes becomes a reset.
+     * Changed ranges are kept in the coordinates of the batch's end, so they stay valid for
+     * observers that see the structural change first.
+     * @{
+     */
+    void notifyRowsInserted(std::size_t first, std::size_t count);
+    void notifyRowsRemoved(std::size_t first, std::size_t count);
+    void notifyDataChanged(const ZModelRange& range, ZModelRoles roles = kAllModelRoles);
+    void notifyReset();
+    /** @} */
+
+private:
+    struct Changed {
+        ZModelRange range;
+        ZModelRoles roles;
+    };
+
+    void addChanged(const ZModelRange& range, ZModelRoles roles);
+    void shiftChanged(std::size_t first, std::size_t count, bool inserted);
+    void mergeClosest();
+
+    int batchDepth_ = 0;
+    bool pendingReset_ = false;
+    std::size_t insertedFirst_ = 0, insertedCount_ = 0;
+    std::size_t removedFirst_ = 0, removedCount_ = 0;
+    std::vector<Changed> changed_; ///< Sorted by first row; row spans never overlap or touch.
+};
+
+/** @brief Holds a model batch for the lifetime of the scope. */
+class ZModelBatch {
+public:
+    explicit ZModelBatch(ZModel& model) : model_(model) { model_.beginBatch(); }
+    ~ZModelBatch() { model_.endBatch(); }
+
+    ZModelBatch(const ZModelBatch&) = delete;
+    ZModelBatch& operator=(const ZModelBatch&) = delete;
+
+private:
+    ZModel& model_;
+};
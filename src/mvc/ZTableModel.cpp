@@ -0,0 +1,46 @@
+/**
+ * @file ZTableModel.cpp
+ * @brief Implementation of the ZTableModel class for the ZincX MVC subsystem.
+ */
+#include "ZTableModel.h"
+#include <algorithm>
+
+ZTableModel::ZTableModel(std::size_t columns) : columns_(columns) {}
+
+void ZTableModel::setText(std::size_t row, std::size_t column, std::string_view text) {
+    std::string& cell = cells_[row * columns_ + column];
+    if (cell == text) return;
+    cell.assign(text);
+    notifyDataChanged({ row, 1, column, 1 }, zRole(ZincX::ModelRole::Display));
+}
+
+void ZTableModel::insertRows(std::size_t first, std::size_t count) {
+    if (count == 0 || columns_ == 0) return;
+    first = std::min(first, rowCount());
+    cells_.insert(cells_.begin() + static_cast<std::ptrdiff_t>(first * columns_), count * columns_, std::string());
+    notifyRowsInserted(first, count);
+}
+
+void ZTableModel::appendRow(const std::vector<std::string>& cells) {
+    if (columns_ == 0) return;
+    const std::size_t row = rowCount();
+    cells_.resize(cells_.size() + columns_);
+    std::copy_n(cells.begin(), std::min(cells.size(), columns_), cells_.begin() + static_cast<std::ptrdiff_t>(row * columns_));
+    notifyRowsInserted(row, 1);
+}
+
+void ZTableModel::removeRows(std::size_t first, std::size_t count) {
+    const std::size_t rows = rowCount();
+    if (first >= rows) return;
+    count = std::min(count, rows - first);
+    if (count == 0) return;
+    cells_.erase(cells_.begin() + static_cast<std::ptrdiff_t>(first * columns_),
+                 cells_.begin() + static_cast<std::ptrdiff_t>((first + count) * columns_));
+    notifyRowsRemoved(first, count);
+}
+
+void ZTableModel::clear() {
+    if (cells_.empty()) return;
+    cells_.clear();
+    notifyReset();
+}
@@ -0,0 +1,43 @@
+/**
+ * @file ZTableModel.h
+ * @brief Defines the in-memory table model of the ZincX MVC subsystem.
+ *
+ * This file contains ZTableModel, a ZModel that stores the text of every cell, row after row in
+ * one vector. Each edit notifies exactly what it changed; an edit that leaves a cell as it was
+ * notifies nothing, so feeds that resend unchanged values cost the views nothing.
+ */
+#pragma once
+#include "ZModel.h"
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class ZTableModel : public ZModel {
+public:
+    explicit ZTableModel(std::size_t columns);
+
+    std::size_t rowCount() const override { return columns_ ? cells_.size() / columns_ : 0; }
+    std::size_t columnCount() const override { return columns_; }
+    void data(std::size_t row, std::size_t column, std::string& out) const override { out = text(row, column); }
+
+    const std::string& text(std::size_t row, std::size_t column) const { return cells_[row * columns_ + column]; }
+
+    /** @brief Replaces one cell's text, notifying the Display role if it changed. */
+    void setText(std::size_t row, std::size_t column, std::string_view text);
+
+    /** @brief Inserts @p count empty rows in front of row @p first; @p first may be rowCount(). */
+    void insertRows(std::size_t first, std::size_t count);
+
+    /** @brief Appends one row; missing cells are left empty and extra ones ignored. */
+    void appendRow(const std::vector<std::string>& cells);
+
+    void removeRows(std::size_t first, std::size_t count);
+
+    /** @brief Removes every row. */
+    void clear();
+
+private:
+    std::size_t columns_;
+    std::vector<std::string> cells_; ///< Row-major.
+};
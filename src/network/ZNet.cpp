@@ -0,0 +1,478 @@
+/**
+ * @file ZNet.cpp
+ * @brief Implementation of the ZNet class for the ZincX networking layer.
+ *
+ * Readiness is level-triggered on every platform: a socket left unread because the receive
+ * buffers ran out, or past the end of one epoll_wait() batch, is simply reported again by the
+ * next poll. Reads of one TCP connection that land back to back in a buffer are reported as one
+ * event; UDP datagrams are reported one event each, since their boundaries carry meaning, but are
+ * packed into the same buffers. Sockets are closed as soon as their Disconnected or Failed event
+ * is queued, so a connection never outlives the event that ends it.
+ *
+ * An event the full queue refuses is held, with its receive buffer, and every later event is held
+ * behind it, so order is kept; the loops that read sockets stop as soon as anything is held. The
+ * next poll queues the held events before it waits, and touches no socket until all of them are
+ * in, which leaves the unread data in the kernel like an empty buffer pool does.
+ */
+#include "ZNet.h"
+#include "../event/ZEventManager.h"
+#include <algorithm>
+#include <array>
+#include <memory>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#define ZINCX_NET_EPOLL
+#endif
+
+namespace {
+#ifdef _WIN32
+    using Socket = SOCKET;
+    constexpr Socket kInvalidSocket = INVALID_SOCKET;
+    constexpr int kSendFlags = 0;
+    int lastError() { return WSAGetLastError(); }
+    bool wouldBlock(int error) { return error == WSAEWOULDBLOCK; }
+    bool inProgress(int error) { return error == WSAEWOULDBLOCK; }
+    void closeSocket(Socket s) { closesocket(s); }
+    bool setNonBlocking(Socket s) {
+        u_long on = 1;
+        return ioctlsocket(s, FIONBIO, &on) == 0;
+    }
+#else
+    using Socket = int;
+    constexpr Socket kInvalidSocket = -1;
+#ifdef MSG_NOSIGNAL
+    constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+    constexpr int kSendFlags = 0;
+#endif
+    int lastError() { return errno; }
+    bool wouldBlock(int error) { return error == EAGAIN || error == EWOULDBLOCK || error == EINTR; }
+    bool inProgress(int error) { return error == EINPROGRESS; }
+    void closeSocket(Socket s) { ::close(s); }
+    bool setNonBlocking(Socket s) {
+        const int flags = fcntl(s, F_GETFL, 0);
+        return flags >= 0 && fcntl(s, F_SETFL, flags | O_NONBLOCK) == 0;
+    }
+#endif
+
+    Socket native(std::uintptr_t socket) { return static_cast<Socket>(socket); }
+
+    using AddressList = std::unique_ptr<addrinfo, decltype(&freeaddrinfo)>;
+
+    AddressList resolveNumeric(const std::string& address, std::uint16_t port, ZincX::Protocol protocol, bool passive) {
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = protocol == ZincX::Protocol::TCP ? SOCK_STREAM : SOCK_DGRAM;
+        hints.ai_flags = AI_NUMERICHOST | AI_NUMERICSERV | (passive ? AI_PASSIVE : 0);
+        addrinfo* result = nullptr;
+        if (getaddrinfo(address.c_str(), std::to_string(port).c_str(), &hints, &result) != 0 || !result) {
+            throw ZincX::ZException("ZNet: '" + address + "' is not a numeric address");
+        }
+        return AddressList(result, &freeaddrinfo);
+    }
+
+    Socket openSocket(const addrinfo& info) {
+        const Socket s = ::socket(info.ai_family, info.ai_socktype, info.ai_protocol);
+        if (s == kInvalidSocket) throw ZincX::ZException("ZNet: cannot create a socket");
+        if (!setNonBlocking(s)) {
+            closeSocket(s);
+            throw ZincX::ZException("ZNet: cannot make a socket non-blocking");
+        }
+#ifdef SO_NOSIGPIPE
+        int on = 1;
+        setsockopt(s, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof on);
+#endif
+        return s;
+    }
+
+    // Telemetry is many small writes; waiting to coalesce them only adds latency.
+    void setNoDelay(Socket s) {
+        int on = 1;
+        setsockopt(s, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&on), sizeof on);
+    }
+}
+
+ZNet::ZNet(ZEventManager& events, std::size_t bufferBytes, std::size_t bufferCount)
+    : events_(&events), bufferBytes_(std::max<std::size_t>(bufferBytes, 1)), storage_(bufferBytes_ * std::max<std::size_t>(bufferCount, 1)) {
+    for (std::size_t i = storage_.size() / bufferBytes_; i-- > 0;) freeBuffers_.push_back(static_cast<std::uint32_t>(i));
+#ifdef _WIN32
+    WSADATA data;
+    if (WSAStartup(MAKEWORD(2, 2), &data) != 0) throw ZincX::ZException("ZNet: cannot start Winsock");
+#endif
+#ifdef ZINCX_NET_EPOLL
+    poller_ = epoll_create1(EPOLL_CLOEXEC);
+    if (poller_ < 0) throw ZincX::ZException("ZNet: cannot create an epoll instance");
+#endif
+}
+
+ZNet::~ZNet() {
+    for (auto& entry : connections_) closeSocket(native(entry.second.socket));
+#ifdef ZINCX_NET_EPOLL
+    ::close(poller_);
+#endif
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
+
+ZNet::ConnectionId ZNet::connect(const std::string& address, std::uint16_t port, ZincX::Protocol protocol) {
+    const AddressList info = resolveNumeric(address, port, protocol, false);
+    const Socket s = openSocket(*info);
+    if (protocol == ZincX::Protocol::TCP) setNoDelay(s);
+    int error = 0;
+    if (::connect(s, info->ai_addr, static_cast<socklen_t>(info->ai_addrlen)) != 0) error = lastError();
+
+    const bool pending = error != 0 && inProgress(error);
+    const ConnectionId id = add(static_cast<std::uintptr_t>(s), protocol,
+                                pending ? ZincX::ConnectionState::Connecting : ZincX::ConnectionState::Connected, false);
+    if (id == kNoConnection) throw ZincX::ZException("ZNet: cannot watch a socket");
+    if (error != 0 && !pending) fail(id, connections_.at(id), ZincX::ConnectionState::Failed, error);
+    else if (!pending) post(ZNetEvent(id, ZincX::ConnectionState::Connected));
+    return id;
+}
+
+ZNet::ConnectionId ZNet::listen(std::uint16_t port, ZincX::Protocol protocol, const std::string& address) {
+    const AddressList info = resolveNumeric(address, port, protocol, true);
+    const Socket s = openSocket(*info);
+#ifndef _WIN32
+    int on = 1;
+    setsockopt(s, SOL_SOCKET, SO_REUSEADDR, &on, sizeof on);
+#endif
+    if (::bind(s, info->ai_addr, static_cast<socklen_t>(info->ai_addrlen)) != 0 ||
+        (protocol == ZincX::Protocol::TCP && ::listen(s, SOMAXCONN) != 0)) {
+        closeSocket(s);
+        throw ZincX::ZException("ZNet: cannot listen on " + address + ":" + std::to_string(port));
+    }
+    const ConnectionId id = add(static_cast<std::uintptr_t>(s), protocol, ZincX::ConnectionState::Connected, true);
+    if (id == kNoConnection) throw ZincX::ZException("ZNet: cannot watch a socket");
+    return id;
+}
+
+bool ZNet::send(ConnectionId id, std::span<const std::uint8_t> data) {
+    const auto it = connections_.find(id);
+    if (it == connections_.end() || it->second.listening) return false;
+    Connection& connection = it->second;
+    const Socket s = native(connection.socket);
+
+    if (connection.protocol == ZincX::Protocol::UDP) {
+        const auto sent = ::send(s, reinterpret_cast<const char*>(data.data()), static_cast<int>(data.size()), kSendFlags);
+        return sent >= 0 && static_cast<std::size_t>(sent) == data.size();
+    }
+    if (connection.state == ZincX::ConnectionState::Connected && connection.outbox.empty()) {
+        const auto sent = ::send(s, reinterpret_cast<const char*>(data.data()), static_cast<int>(data.size()), kSendFlags);
+        if (sent >= 0 && static_cast<std::size_t>(sent) == data.size()) return true;
+        if (sent < 0) {
+            const int error = lastError();
+            if (!wouldBlock(error)) {
+                fail(id, connection, ZincX::ConnectionState::Failed, error);
+                return false;
+            }
+        } else {
+            data = data.subspan(static_cast<std::size_t>(sent));
+        }
+    }
+    connection.outbox.insert(connection.outbox.end(), data.begin(), data.end());
+    if (connection.state == ZincX::ConnectionState::Connected) watch(id, connection, true);
+    return true;
+}
+
+void ZNet::close(ConnectionId id) {
+    std::erase_if(held_, [id](const ZNetEvent& event) { return event.connection == id; });
+    const auto it = connections_.find(id);
+    if (it != connections_.end()) remove(id, it->second);
+}
+
+std::size_t ZNet::poll(int timeoutMs) {
+    posted_ = 0;
+    // Buffers of held events stay in use until those events are queued and dispatched.
+    std::erase_if(usedBuffers_, [this](std::uint32_t buffer) {
+        if (std::ranges::any_of(held_, [buffer](const ZNetEvent& event) { return event.size > 0 && event.buffer == buffer; })) return false;
+        freeBuffers_.push_back(buffer);
+        return true;
+    });
+    buffer_ = kNoBuffer;
+    filled_ = 0;
+
+    std::size_t queued = 0;
+    while (queued < held_.size() && events_->queueEvent(held_[queued])) ++queued;
+    held_.erase(held_.begin(), held_.begin() + static_cast<std::ptrdiff_t>(queued));
+    posted_ += queued;
+    if (!held_.empty()) return posted_;
+
+    ready_.clear();
+    waitReady(timeoutMs);
+    for (const auto& [id, flags] : ready_) {
+        // Connections not handled once the queue is full stay ready for the next poll.
+        if (!held_.empty()) break;
+        // An earlier connection's events may have closed this one.
+        const auto it = connections_.find(id);
+        if (it == connections_.end()) continue;
+        Connection& connection = it->second;
+        if (connection.state == ZincX::ConnectionState::Connecting) {
+            finishConnect(id, connection);
+        } else if (connection.listening && connection.protocol == ZincX::Protocol::TCP) {
+            acceptAll(id, connection);
+        } else {
+            if ((flags & Writable) && !connection.outbox.empty()) {
+                flush(id, connection);
+                if (!connections_.contains(id)) continue;
+            }
+            if (flags & (Readable | Error)) receive(id, connection);
+        }
+    }
+    return posted_;
+}
+
+std::span<const std::uint8_t> ZNet::data(const ZNetEvent& event) const {
+    const std::size_t start = static_cast<std::size_t>(event.buffer) * bufferBytes_ + event.offset;
+    if (event.size == 0 || event.offset + event.size > bufferBytes_ || start + event.size > storage_.size()) return {};
+    return { storage_.data() + start, event.size };
+}
+
+ZincX::ConnectionState ZNet::state(ConnectionId id) const {
+    const auto it = connections_.find(id);
+    return it != connections_.end() ? it->second.state : ZincX::ConnectionState::Disconnected;
+}
+
+std::uint16_t ZNet::localPort(ConnectionId id) const {
+    const auto it = connections_.find(id);
+    if (it == connections_.end()) return 0;
+    sockaddr_storage address{};
+    socklen_t length = sizeof address;
+    if (getsockname(native(it->second.socket), reinterpret_cast<sockaddr*>(&address), &length) != 0) return 0;
+    if (address.ss_family == AF_INET) return ntohs(reinterpret_cast<const sockaddr_in&>(address).sin_port);
+    if (address.ss_family == AF_INET6) return ntohs(reinterpret_cast<const sockaddr_in6&>(address).sin6_port);
+    return 0;
+}
+
+ZNet::ConnectionId ZNet::add(std::uintptr_t socket, ZincX::Protocol protocol, ZincX::ConnectionState state, bool listening) {
+    if (nextId_ == kNoConnection) ++nextId_;
+    const ConnectionId id = nextId_;
+    const bool write = state == ZincX::ConnectionState::Connecting;
+#ifdef ZINCX_NET_EPOLL
+    epoll_event event{};
+    event.events = EPOLLIN | (write ? EPOLLOUT : 0u);
+    event.data.u64 = id;
+    if (epoll_ctl(poller_, EPOLL_CTL_ADD, native(socket), &event) != 0) {
+        closeSocket(native(socket));
+        return kNoConnection;
+    }
+#elif !defined(_WIN32)
+    // select() cannot watch descriptors past FD_SETSIZE.
+    if (native(socket) >= FD_SETSIZE) {
+        closeSocket(native(socket));
+        return kNoConnection;
+    }
+#endif
+    ++nextId_;
+    Connection& connection = connections_[id];
+    connection.socket = socket;
+    connection.protocol = protocol;
+    connection.state = state;
+    connection.listening = listening;
+    connection.watchingWrite = write;
+    return id;
+}
+
+void ZNet::remove(ConnectionId id, Connection& connection) {
+#ifdef ZINCX_NET_EPOLL
+    epoll_ctl(poller_, EPOLL_CTL_DEL, native(connection.socket), nullptr);
+#endif
+    closeSocket(native(connection.socket));
+    connections_.erase(id);
+}
+
+void ZNet::watch(ConnectionId id, Connection& connection, bool write) {
+    if (connection.watchingWrite == write) return;
+    connection.watchingWrite = write;
+#ifdef ZINCX_NET_EPOLL
+    epoll_event event{};
+    event.events = EPOLLIN | (write ? EPOLLOUT : 0u);
+    event.data.u64 = id;
+    epoll_ctl(poller_, EPOLL_CTL_MOD, native(connection.socket), &event);
+#else
+    (void)id;
+#endif
+}
+
+void ZNet::waitReady(int timeoutMs) {
+#ifdef ZINCX_NET_EPOLL
+    std::array<epoll_event, 256> events;
+    const int count = epoll_wait(poller_, events.data(), static_cast<int>(events.size()), timeoutMs);
+    for (int i = 0; i < count; ++i) {
+        const std::uint32_t mask = events[i].events;
+        const unsigned flags = ((mask & EPOLLIN) ? Readable : 0u) | ((mask & EPOLLOUT) ? Writable : 0u) |
+                               ((mask & (EPOLLERR | EPOLLHUP)) ? Error : 0u);
+        ready_.emplace_back(static_cast<ConnectionId>(events[i].data.u64), flags);
+    }
+#else
+    if (connections_.empty()) return;
+    fd_set read, write, error;
+    FD_ZERO(&read);
+    FD_ZERO(&write);
+    FD_ZERO(&error);
+    Socket highest = 0;
+    for (const auto& [id, connection] : connections_) {
+        const Socket s = native(connection.socket);
+        FD_SET(s, &read);
+        FD_SET(s, &error);
+        if (connection.watchingWrite) FD_SET(s, &write);
+        highest = std::max(highest, s);
+    }
+    timeval timeout{ timeoutMs / 1000, (timeoutMs % 1000) * 1000 };
+    if (select(static_cast<int>(highest) + 1, &read, &write, &error, timeoutMs < 0 ? nullptr : &timeout) <= 0) return;
+    for (const auto& [id, connection] : connections_) {
+        const Socket s = native(connection.socket);
+        const unsigned flags = (FD_ISSET(s, &read) ? Readable : 0u) | (FD_ISSET(s, &write) ? Writable : 0u) |
+                               (FD_ISSET(s, &error) ? Error : 0u);
+        if (flags) ready_.emplace_back(id, flags);
+    }
+#endif
+}
+
+void ZNet::finishConnect(ConnectionId id, Connection& connection) {
+    int error = 0;
+    socklen_t length = sizeof error;
+    getsockopt(native(connection.socket), SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &length);
+    if (error != 0) {
+        fail(id, connection, ZincX::ConnectionState::Failed, error);
+        return;
+    }
+    connection.state = ZincX::ConnectionState::Connected;
+    post(ZNetEvent(id, ZincX::ConnectionState::Connected));
+    if (!connection.outbox.empty()) flush(id, connection);
+    else watch(id, connection, false);
+}
+
+void ZNet::acceptAll(ConnectionId id, Connection& connection) {
+    for (;;) {
+        // Adding the accepted connection leaves references to other connections valid.
+        const Socket s = ::accept(native(connection.socket), nullptr, nullptr);
+        if (s == kInvalidSocket) return;
+        if (!setNonBlocking(s)) {
+            closeSocket(s);
+            continue;
+        }
+        setNoDelay(s);
+        const ConnectionId accepted = add(static_cast<std::uintptr_t>(s), ZincX::Protocol::TCP, ZincX::ConnectionState::Connected, false);
+        if (accepted == kNoConnection) continue;
+        ZNetEvent event(accepted, ZincX::ConnectionState::Connected);
+        event.listener = id;
+        if (!post(event)) return;
+    }
+}
+
+void ZNet::receive(ConnectionId id, Connection& connection) {
+    const Socket s = native(connection.socket);
+    if (connection.protocol == ZincX::Protocol::UDP) {
+        const std::size_t datagram = std::min(bufferBytes_, ZincX::NET_MAX_DATAGRAM_BYTES);
+        while (takeBuffer(datagram)) {
+            const auto received = ::recv(s, reinterpret_cast<char*>(&storage_[buffer_ * bufferBytes_ + filled_]),
+                                         static_cast<int>(datagram), 0);
+            // Errors on a datagram socket (an ICMP unreachable, say) concern one earlier datagram only.
+            if (received < 0) return;
+            if (received == 0) continue;
+            ZNetEvent event(id, connection.state);
+            event.buffer = buffer_;
+            event.offset = static_cast<std::uint32_t>(filled_);
+            event.size = static_cast<std::uint32_t>(received);
+            filled_ += static_cast<std::size_t>(received);
+            if (!post(event)) return;
+        }
+        return;
+    }
+
+    ZNetEvent chunk(id, ZincX::ConnectionState::Connected);
+    auto postChunk = [&] {
+        const bool queued = chunk.size == 0 || post(chunk);
+        chunk.size = 0;
+        return queued;
+    };
+    for (;;) {
+        if (buffer_ == kNoBuffer || filled_ == bufferBytes_) {
+            if (!postChunk() || !takeBuffer(1)) return;
+        }
+        if (chunk.size == 0) {
+            chunk.buffer = buffer_;
+            chunk.offset = static_cast<std::uint32_t>(filled_);
+        }
+        const auto received = ::recv(s, reinterpret_cast<char*>(&storage_[buffer_ * bufferBytes_ + filled_]),
+                                     static_cast<int>(bufferBytes_ - filled_), 0);
+        if (received > 0) {
+            filled_ += static_cast<std::size_t>(received);
+            chunk.size += static_cast<std::uint32_t>(received);
+            continue;
+        }
+        postChunk();
+        if (received == 0) {
+            fail(id, connection, ZincX::ConnectionState::Disconnected, 0);
+            return;
+        }
+        const int error = lastError();
+        if (!wouldBlock(error)) fail(id, connection, ZincX::ConnectionState::Failed, error);
+        return;
+    }
+}
+
+void ZNet::flush(ConnectionId id, Connection& connection) {
+    while (connection.outboxSent < connection.outbox.size()) {
+        const auto sent = ::send(native(connection.socket),
+                                 reinterpret_cast<const char*>(connection.outbox.data() + connection.outboxSent),
+                                 static_cast<int>(connection.outbox.size() - connection.outboxSent), kSendFlags);
+        if (sent > 0) {
+            connection.outboxSent += static_cast<std::size_t>(sent);
+            continue;
+        }
+        const int error = lastError();
+        if (sent < 0 && wouldBlock(error)) {
+            watch(id, connection, true);
+            return;
+        }
+        fail(id, connection, ZincX::ConnectionState::Failed, error);
+        return;
+    }
+    connection.outbox.clear();
+    connection.outboxSent = 0;
+    watch(id, connection, false);
+}
+
+void ZNet::fail(ConnectionId id, Connection& connection, ZincX::ConnectionState state, int error) {
+    ZNetEvent event(id, state);
+    event.error = error;
+    post(event);
+    remove(id, connection);
+}
+
+bool ZNet::takeBuffer(std::size_t room) {
+    if (buffer_ != kNoBuffer && bufferBytes_ - filled_ >= room) return true;
+    if (freeBuffers_.empty()) return false;
+    buffer_ = freeBuffers_.back();
+    freeBuffers_.pop_back();
+    usedBuffers_.push_back(buffer_);
+    filled_ = 0;
+    return true;
+}
+
+bool ZNet::post(const ZNetEvent& event) {
+    if (held_.empty() && events_->queueEvent(event)) {
+        ++posted_;
+        return true;
+    }
+    held_.push_back(event);
+    return false;
+}
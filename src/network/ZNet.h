@@ -0,0 +1,155 @@
+/**
+ * @file ZNet.h
+ * @brief Defines the non-blocking networking layer of the ZincX framework.
+ *
+ * This file contains ZNet, which owns a set of TCP and UDP connections and turns their I/O into
+ * ZNetEvents on a ZEventManager. Sockets are non-blocking and never read or written outside
+ * poll() and send(), both called from the UI thread: poll() waits for readiness (epoll on Linux,
+ * select() elsewhere, including the DOS and Win16 socket stacks) for at most the given timeout,
+ * then drains every ready socket in one pass and queues the results. Listeners therefore run in
+ * dispatchEvents() like input listeners, never on a network thread, and a frame costs one wait
+ * however many connections are streaming.
+ *
+ * Received bytes go into a fixed pool of receive buffers; consecutive reads of one poll are
+ * packed into the same buffer, and each event names the slice it received. ZNet::data() returns
+ * that slice in place, so handlers parse straight from the buffer the socket was read into. A
+ * buffer is recycled by the next poll(): handlers copy what they keep. When the pool is empty,
+ * poll() leaves the remaining sockets unread until the next poll, so a flood is throttled by the
+ * kernel's socket buffers instead of growing the UI thread's memory. The same holds when the
+ * event manager's queue is full: the event that did not fit is kept and queued by the next poll,
+ * before any socket is read again, so no data or state change is lost.
+ *
+ * Connections are opened with numeric addresses only; resolving a host name can block, so do it
+ * elsewhere. Like the event manager's dispatch side, ZNet is used from the UI thread only.
+ */
+#pragma once
+#include "../common/ZCommon.h"
+#include "../common/ZConfig.h"
+#include "../event/ZEvent.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class ZEventManager;
+
+class ZNet {
+public:
+    using ConnectionId = std::uint32_t;
+
+    /** @brief Never returned for a connection. */
+    static constexpr ConnectionId kNoConnection = 0;
+
+    /**
+     * @param events Receives the network events; must outlive this object.
+     * @param bufferBytes Size of one receive buffer.
+     * @param bufferCount Number of receive buffers; together they bound the data read per poll().
+     */
+    explicit ZNet(ZEventManager& events, std::size_t bufferBytes = ZincX::NET_RECV_BUFFER_BYTES,
+                  std::size_t bufferCount = ZincX::NET_RECV_BUFFERS);
+
+    /** @brief Closes every connection without posting events. */
+    ~ZNet();
+
+    ZNet(const ZNet&) = delete;
+    ZNet& operator=(const ZNet&) = delete;
+
+    /**
+     * @brief Starts connecting to a numeric IPv4 or IPv6 address without waiting.
+     *
+     * A Connected or Failed event follows from a later poll(). UDP connections are connected at
+     * once; they exchange datagrams with that address only.
+     * @throws ZincX::ZException if the address is not numeric or no socket can be created.
+     */
+    ConnectionId connect(const std::string& address, std::uint16_t port, ZincX::Protocol protocol = ZincX::Protocol::TCP);
+
+    /**
+     * @brief Opens a listening connection.
+     *
+     * For TCP, each accepted connection is reported by a Connected event whose listener is this
+     * connection. For UDP, every datagram sent to the port arrives as a data event on it.
+     * @param port The port to bind, or 0 for any; see localPort().
+     * @throws ZincX::ZException if the address cannot be bound.
+     */
+    ConnectionId listen(std::uint16_t port, ZincX::Protocol protocol = ZincX::Protocol::TCP,
+                        const std::string& address = "0.0.0.0");
+
+    /**
+     * @brief Sends data without blocking.
+     *
+     * TCP data the socket does not take at once is kept and written by later polls, in order;
+     * data sent while still connecting waits for the connection. A UDP call sends one datagram.
+     * @return False if the connection is unknown, closed or listening, or the datagram was not sent.
+     */
+    bool send(ConnectionId id, std::span<const std::uint8_t> data);
+
+    /** @brief Closes a connection at once; no further events are posted for it. */
+    void close(ConnectionId id);
+
+    /**
+     * @brief Handles the I/O of every ready connection and queues the resulting events.
+     *
+     * Recycles the receive buffers of the previous poll first, so call it once per frame, before
+     * dispatchEvents(). Events a full queue refused earlier are queued next; while any still do
+     * not fit, no socket is read and the call returns at once.
+     * @param timeoutMs How long to wait if nothing is ready; 0 returns at once.
+     * @return The number of events queued.
+     */
+    std::size_t poll(int timeoutMs = 0);
+
+    /** @brief The bytes a data event received; valid until the next poll(). */
+    std::span<const std::uint8_t> data(const ZNetEvent& event) const;
+
+    /** @brief State of a connection; Disconnected once it is closed or unknown. */
+    ZincX::ConnectionState state(ConnectionId id) const;
+
+    /** @brief The local port a connection is bound to, or 0 if it is unknown. */
+    std::uint16_t localPort(ConnectionId id) const;
+
+    std::size_t connectionCount() const { return connections_.size(); }
+
+private:
+    enum Ready : unsigned { Readable = 1, Writable = 2, Error = 4 };
+    static constexpr std::uint32_t kNoBuffer = 0xFFFFFFFFu;
+
+    struct Connection {
+        std::uintptr_t socket;
+        ZincX::Protocol protocol;
+        ZincX::ConnectionState state;
+        bool listening = false;
+        bool watchingWrite = false;          ///< Write readiness is being waited for.
+        std::vector<std::uint8_t> outbox;    ///< TCP data not yet taken by the socket.
+        std::size_t outboxSent = 0;          ///< Leading outbox bytes already written.
+    };
+
+    ConnectionId add(std::uintptr_t socket, ZincX::Protocol protocol, ZincX::ConnectionState state, bool listening);
+    void remove(ConnectionId id, Connection& connection);
+    void watch(ConnectionId id, Connection& connection, bool write);
+    void waitReady(int timeoutMs);
+    void finishConnect(ConnectionId id, Connection& connection);
+    void acceptAll(ConnectionId id, Connection& connection);
+    void receive(ConnectionId id, Connection& connection);
+    void flush(ConnectionId id, Connection& connection);
+    void fail(ConnectionId id, Connection& connection, ZincX::ConnectionState state, int error);
+    bool takeBuffer(std::size_t room);
+
+    /** @brief Queues an event, or holds it for the next poll(); false if held, so reading stops. */
+    bool post(const ZNetEvent& event);
+
+    ZEventManager* events_;
+    std::size_t bufferBytes_;
+    std::vector<std::uint8_t> storage_;      ///< All receive buffers, back to back.
+    std::vector<std::uint32_t> freeBuffers_;
+    std::vector<std::uint32_t> usedBuffers_; ///< Handed out since the last poll().
+    std::uint32_t buffer_ = kNoBuffer;       ///< Buffer being filled by this poll.
+    std::size_t filled_ = 0;
+    std::unordered_map<ConnectionId, Connection> connections_;
+    std::vector<std::pair<ConnectionId, unsigned>> ready_;
+    std::vector<ZNetEvent> held_;            ///< Events the full queue refused, oldest first.
+    ConnectionId nextId_ = 1;
+    std::size_t posted_ = 0;
+    int poller_ = -1;                        ///< The epoll instance on Linux.
+};
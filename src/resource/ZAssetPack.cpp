@@ -0,0 +1,260 @@
+/**
+ * @file ZAssetPack.cpp
+ * @brief Implementation of the ZAssetPack, ZPackedResource and ZAssetPackBuilder classes.
+ *
+ * Integers are decoded byte by byte, so the archive reads the same on every target and index
+ * fields need no alignment inside the mapping. Every offset and length is checked against the
+ * file size at open, which lets view() and read() trust the index afterwards.
+ */
+#include "ZAssetPack.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__DJGPP__)
+    // No mapping: stream from the file.
+#elif defined(_WIN32)
+#define ZINCX_PACK_MMAP_WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#define ZINCX_PACK_MMAP_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    constexpr char kMagic[4] = { 'Z', 'P', 'A', 'K' };
+
+    std::uint32_t readU32(const std::uint8_t* p) {
+        return std::uint32_t(p[0]) | std::uint32_t(p[1]) << 8 | std::uint32_t(p[2]) << 16 | std::uint32_t(p[3]) << 24;
+    }
+
+    std::uint64_t readU64(const std::uint8_t* p) {
+        return std::uint64_t(readU32(p)) | std::uint64_t(readU32(p + 4)) << 32;
+    }
+
+    void writeU32(std::vector<std::uint8_t>& out, std::uint32_t v) {
+        for (int i = 0; i < 4; ++i) out.push_back(static_cast<std::uint8_t>(v >> (8 * i)));
+    }
+
+    void writeU64(std::vector<std::uint8_t>& out, std::uint64_t v) {
+        writeU32(out, static_cast<std::uint32_t>(v));
+        writeU32(out, static_cast<std::uint32_t>(v >> 32));
+    }
+
+    std::uint64_t alignUp(std::uint64_t value, std::uint64_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    // Reads size bytes at offset, ASSET_PACK_READ_CHUNK at a time.
+    void readAt(std::FILE* file, std::uint64_t offset, std::uint8_t* out, std::size_t size) {
+        if (std::fseek(file, static_cast<long>(offset), SEEK_SET) != 0) throw ZincX::ZException("ZAssetPack: seek failed");
+        while (size > 0) {
+            std::size_t chunk = std::min(size, ZincX::ASSET_PACK_READ_CHUNK);
+            if (std::fread(out, 1, chunk, file) != chunk) throw ZincX::ZException("ZAssetPack: read failed");
+            out += chunk;
+            size -= chunk;
+        }
+    }
+}
+
+ZAssetPack::ZAssetPack(const std::string& path) {
+#if defined(ZINCX_PACK_MMAP_POSIX)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw ZincX::ZException("ZAssetPack: cannot open " + path);
+    struct stat info{};
+    if (::fstat(fd, &info) != 0 || static_cast<std::uint64_t>(info.st_size) < kHeaderSize) {
+        ::close(fd);
+        throw ZincX::ZException("ZAssetPack: not an asset pack: " + path);
+    }
+    mappedSize_ = static_cast<std::size_t>(info.st_size);
+    void* mapping = ::mmap(nullptr, mappedSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) throw ZincX::ZException("ZAssetPack: cannot map " + path);
+    base_ = static_cast<const std::uint8_t*>(mapping);
+    try {
+        parseIndex(base_, mappedSize_, mappedSize_);
+    } catch (...) {
+        ::munmap(mapping, mappedSize_);
+        throw;
+    }
+#elif defined(ZINCX_PACK_MMAP_WIN32)
+    HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) throw ZincX::ZException("ZAssetPack: cannot open " + path);
+    LARGE_INTEGER size{};
+    HANDLE mapping = nullptr;
+    const void* view = nullptr;
+    if (::GetFileSizeEx(file, &size) && static_cast<std::uint64_t>(size.QuadPart) >= kHeaderSize) {
+        mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping) view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    }
+    if (!view) {
+        if (mapping) ::CloseHandle(mapping);
+        ::CloseHandle(file);
+        throw ZincX::ZException("ZAssetPack: cannot map " + path);
+    }
+    file_ = file;
+    mapping_ = mapping;
+    base_ = static_cast<const std::uint8_t*>(view);
+    mappedSize_ = static_cast<std::size_t>(size.QuadPart);
+    try {
+        parseIndex(base_, mappedSize_, mappedSize_);
+    } catch (...) {
+        ::UnmapViewOfFile(view);
+        ::CloseHandle(mapping);
+        ::CloseHandle(file);
+        throw;
+    }
+#else
+    stream_ = std::fopen(path.c_str(), "rb");
+    if (!stream_) throw ZincX::ZException("ZAssetPack: cannot open " + path);
+    try {
+        if (std::fseek(stream_, 0, SEEK_END) != 0) throw ZincX::ZException("ZAssetPack: seek failed");
+        const auto fileSize = static_cast<std::uint64_t>(std::ftell(stream_));
+        if (fileSize < kHeaderSize) throw ZincX::ZException("ZAssetPack: not an asset pack: " + path);
+        // Read the header, then the index, then the names the index points at.
+        index_.resize(kHeaderSize);
+        readAt(stream_, 0, index_.data(), kHeaderSize);
+        const std::uint64_t indexEnd = kHeaderSize + std::uint64_t(readU32(index_.data() + 8)) * kEntrySize;
+        if (indexEnd > fileSize) throw ZincX::ZException("ZAssetPack: truncated index in " + path);
+        index_.resize(static_cast<std::size_t>(indexEnd));
+        readAt(stream_, kHeaderSize, index_.data() + kHeaderSize, index_.size() - kHeaderSize);
+        std::uint64_t namesEnd = indexEnd;
+        for (std::size_t at = kHeaderSize; at < indexEnd; at += kEntrySize) {
+            namesEnd = std::max(namesEnd, std::uint64_t(readU32(&index_[at + 16])) + readU32(&index_[at + 20]));
+        }
+        if (namesEnd > fileSize) throw ZincX::ZException("ZAssetPack: truncated names in " + path);
+        index_.resize(static_cast<std::size_t>(namesEnd));
+        readAt(stream_, indexEnd, index_.data() + indexEnd, index_.size() - static_cast<std::size_t>(indexEnd));
+        parseIndex(index_.data(), index_.size(), fileSize);
+    } catch (...) {
+        std::fclose(stream_);
+        throw;
+    }
+#endif
+}
+
+ZAssetPack::~ZAssetPack() {
+#if defined(ZINCX_PACK_MMAP_POSIX)
+    ::munmap(const_cast<std::uint8_t*>(base_), mappedSize_);
+#elif defined(ZINCX_PACK_MMAP_WIN32)
+    ::UnmapViewOfFile(base_);
+    ::CloseHandle(static_cast<HANDLE>(mapping_));
+    ::CloseHandle(static_cast<HANDLE>(file_));
+#else
+    std::fclose(stream_);
+#endif
+}
+
+void ZAssetPack::parseIndex(const std::uint8_t* data, std::size_t available, std::uint64_t fileSize) {
+    if (std::memcmp(data, kMagic, sizeof kMagic) != 0) throw ZincX::ZException("ZAssetPack: bad magic");
+    if (readU32(data + 4) != kVersion) throw ZincX::ZException("ZAssetPack: unsupported version");
+    const std::uint32_t count = readU32(data + 8);
+    if (kHeaderSize + std::uint64_t(count) * kEntrySize > available) throw ZincX::ZException("ZAssetPack: truncated index");
+
+    entries_.reserve(count);
+    byName_.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const std::uint8_t* e = data + kHeaderSize + std::size_t(i) * kEntrySize;
+        const std::uint64_t offset = readU64(e);
+        const std::uint64_t size = readU64(e + 8);
+        const std::uint32_t nameOffset = readU32(e + 16);
+        const std::uint32_t nameLength = readU32(e + 20);
+        const std::uint32_t type = readU32(e + 24);
+        if (std::uint64_t(nameOffset) + nameLength > available || offset > fileSize || size > fileSize - offset ||
+            type > static_cast<std::uint32_t>(ZincX::ResourceType::Shader)) {
+            throw ZincX::ZException("ZAssetPack: corrupt index entry");
+        }
+        std::string_view name(reinterpret_cast<const char*>(data + nameOffset), nameLength);
+        entries_.push_back({ name, static_cast<ZincX::ResourceType>(type), offset, size });
+        byName_[name] = i;
+    }
+}
+
+const ZAssetPack::Entry* ZAssetPack::find(std::string_view name) const {
+    auto it = byName_.find(name);
+    return it == byName_.end() ? nullptr : &entries_[it->second];
+}
+
+std::span<const std::uint8_t> ZAssetPack::view(const Entry& entry) const {
+    if (!base_) return {};
+    return { base_ + entry.offset, static_cast<std::size_t>(entry.size) };
+}
+
+std::vector<std::uint8_t> ZAssetPack::read(const Entry& entry) const {
+    if (base_) {
+        auto bytes = view(entry);
+        return { bytes.begin(), bytes.end() };
+    }
+    std::vector<std::uint8_t> out(static_cast<std::size_t>(entry.size));
+#ifdef ZINCX_THREAD_SAFE
+    std::lock_guard<std::mutex> lock(streamMutex_);
+#endif
+    readAt(stream_, entry.offset, out.data(), out.size());
+    return out;
+}
+
+ZPackedResource::ZPackedResource(std::shared_ptr<const ZAssetPack> pack, const ZAssetPack::Entry& entry)
+    : pack_(std::move(pack)), type_(entry.type) {
+    if (pack_->isMapped()) {
+        data_ = pack_->view(entry);
+    } else {
+        copy_ = pack_->read(entry);
+        data_ = copy_;
+    }
+}
+
+void ZAssetPackBuilder::add(const std::string& name, ZincX::ResourceType type, std::vector<std::uint8_t> data) {
+    auto it = std::find_if(assets_.begin(), assets_.end(), [&](const Asset& a) { return a.name == name; });
+    if (it != assets_.end()) {
+        it->type = type;
+        it->data = std::move(data);
+        return;
+    }
+    assets_.push_back({ name, type, std::move(data) });
+}
+
+void ZAssetPackBuilder::save(const std::string& path) const {
+    const std::uint64_t namesStart = ZAssetPack::kHeaderSize + assets_.size() * ZAssetPack::kEntrySize;
+    std::uint64_t namesEnd = namesStart;
+    for (const Asset& a : assets_) namesEnd += a.name.size();
+
+    std::vector<std::uint8_t> head;
+    head.insert(head.end(), kMagic, kMagic + sizeof kMagic);
+    writeU32(head, ZAssetPack::kVersion);
+    writeU32(head, static_cast<std::uint32_t>(assets_.size()));
+    writeU32(head, 0);
+
+    std::uint64_t nameAt = namesStart;
+    std::uint64_t dataAt = alignUp(namesEnd, ZAssetPack::kDataAlignment);
+    for (const Asset& a : assets_) {
+        writeU64(head, dataAt);
+        writeU64(head, a.data.size());
+        writeU32(head, static_cast<std::uint32_t>(nameAt));
+        writeU32(head, static_cast<std::uint32_t>(a.name.size()));
+        writeU32(head, static_cast<std::uint32_t>(a.type));
+        writeU32(head, 0);
+        nameAt += a.name.size();
+        dataAt = alignUp(dataAt + a.data.size(), ZAssetPack::kDataAlignment);
+    }
+    for (const Asset& a : assets_) head.insert(head.end(), a.name.begin(), a.name.end());
+    head.resize(static_cast<std::size_t>(alignUp(head.size(), ZAssetPack::kDataAlignment)), 0);
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) throw ZincX::ZException("ZAssetPackBuilder: cannot create " + path);
+    bool ok = std::fwrite(head.data(), 1, head.size(), file) == head.size();
+    static const std::uint8_t padding[ZAssetPack::kDataAlignment] = {};
+    for (const Asset& a : assets_) {
+        if (!ok) break;
+        ok = a.data.empty() || std::fwrite(a.data.data(), 1, a.data.size(), file) == a.data.size();
+        std::size_t pad = static_cast<std::size_t>(alignUp(a.data.size(), ZAssetPack::kDataAlignment) - a.data.size());
+        ok = ok && (pad == 0 || std::fwrite(padding, 1, pad, file) == pad);
+    }
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok) throw ZincX::ZException("ZAssetPackBuilder: write failed for " + path);
+}
@@ -0,0 +1,140 @@
+/**
+ * @file ZAssetPack.h
+ * @brief Defines the read-only packed asset archive of the ZincX resource subsystem.
+ *
+ * This file contains ZAssetPack, which opens a single archive of fonts, images and theme data
+ * and looks assets up by name through its header index, ZPackedResource, the resource
+ * ZResourceManager hands out for a packed asset, and ZAssetPackBuilder, which writes archives.
+ * On Linux, macOS and Windows the archive is memory-mapped and assets are views into the
+ * mapping, so opening it costs one system call and reading an asset copies nothing. Under DJGPP
+ * (and any target without mapping) only the index is read at open; asset data is streamed from
+ * the file in ZincX::ASSET_PACK_READ_CHUNK pieces on demand.
+ *
+ * Layout, all integers little-endian:
+ * - Header, 16 bytes: magic "ZPAK", u32 version (1), u32 entry count, u32 reserved.
+ * - Index, 32 bytes per entry: u64 data offset, u64 data size, u32 name offset, u32 name length,
+ *   u32 ResourceType, u32 reserved. Offsets are from the start of the file.
+ * - Names (not terminated), then data, each asset aligned to 16 bytes.
+ */
+#pragma once
+#include "ZResourceManager.h"
+#include "../common/ZCommon.h"
+#include "../common/ZCommonEnums.h"
+#include "../common/ZConfig.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#ifdef ZINCX_THREAD_SAFE
+#include <mutex>
+#endif
+
+class ZAssetPack {
+public:
+    struct Entry {
+        std::string_view name;
+        ZincX::ResourceType type;
+        std::uint64_t offset;
+        std::uint64_t size;
+    };
+
+    /**
+     * @brief Opens an archive and reads its index.
+     * @param path The archive file.
+     * @throws ZincX::ZException if the file cannot be opened or is not a valid archive.
+     */
+    explicit ZAssetPack(const std::string& path);
+    ~ZAssetPack();
+
+    ZAssetPack(const ZAssetPack&) = delete;
+    ZAssetPack& operator=(const ZAssetPack&) = delete;
+
+    /** @brief True if the archive is memory-mapped and view() returns data. */
+    bool isMapped() const { return base_ != nullptr; }
+
+    std::size_t entryCount() const { return entries_.size(); }
+    const Entry& entry(std::size_t index) const { return entries_[index]; }
+
+    /** @brief Looks an asset up by name. @return The entry, or null if absent. */
+    const Entry* find(std::string_view name) const;
+
+    /** @brief The asset's bytes inside the mapping; empty if the archive is not mapped. */
+    std::span<const std::uint8_t> view(const Entry& entry) const;
+
+    /** @brief Copies the asset's bytes out of the archive; works whether or not it is mapped. */
+    std::vector<std::uint8_t> read(const Entry& entry) const;
+
+    static constexpr std::uint32_t kVersion = 1;
+    static constexpr std::size_t kHeaderSize = 16;
+    static constexpr std::size_t kEntrySize = 32;
+    static constexpr std::size_t kDataAlignment = 16;
+
+private:
+    /** @brief Validates the index region and fills entries_ and byName_. */
+    void parseIndex(const std::uint8_t* data, std::size_t available, std::uint64_t fileSize);
+
+    std::vector<Entry> entries_;
+    std::unordered_map<std::string_view, std::size_t> byName_;
+    std::vector<std::uint8_t> index_;   ///< Header, index and names when not mapped; names point here.
+    const std::uint8_t* base_ = nullptr;
+    std::size_t mappedSize_ = 0;
+#ifdef _WIN32
+    void* file_ = nullptr;      ///< HANDLE of the archive.
+    void* mapping_ = nullptr;   ///< HANDLE of the file mapping.
+#endif
+    std::FILE* stream_ = nullptr;   ///< Open only when not mapped.
+#ifdef ZINCX_THREAD_SAFE
+    mutable std::mutex streamMutex_;
+#endif
+};
+
+/**
+ * @brief A packed asset as handed out by ZResourceManager.
+ *
+ * Holds the archive open for as long as it lives. For a mapped archive the data is a view into
+ * the mapping and costs no heap memory, so it is charged zero bytes against the cache budget.
+ */
+class ZPackedResource : public ZResource {
+public:
+    ZPackedResource(std::shared_ptr<const ZAssetPack> pack, const ZAssetPack::Entry& entry);
+
+    ZincX::ResourceType type() const override { return type_; }
+    std::size_t byteSize() const override { return copy_.size(); }
+
+    std::span<const std::uint8_t> data() const { return data_; }
+
+    /** @brief True if data() points into the archive mapping rather than a private copy. */
+    bool isZeroCopy() const { return copy_.empty() && !data_.empty(); }
+
+private:
+    std::shared_ptr<const ZAssetPack> pack_;
+    ZincX::ResourceType type_;
+    std::vector<std::uint8_t> copy_;
+    std::span<const std::uint8_t> data_;
+};
+
+/**
+ * @brief Collects assets in memory and writes them as an archive; for asset build tools.
+ */
+class ZAssetPackBuilder {
+public:
+    /** @brief Adds an asset; a later asset with the same name replaces an earlier one. */
+    void add(const std::string& name, ZincX::ResourceType type, std::vector<std::uint8_t> data);
+
+    /** @brief Writes the archive. @throws ZincX::ZException on I/O failure. */
+    void save(const std::string& path) const;
+
+private:
+    struct Asset {
+        std::string name;
+        ZincX::ResourceType type;
+        std::vector<std::uint8_t> data;
+    };
+    std::vector<Asset> assets_;
+};
@@ -0,0 +1,249 @@
+/**
+ * @file ZResourceManager.cpp
+ * @brief Implementation of the ZResourceManager class for the ZincX resource subsystem.
+ *
+ * A loading entry sits in its shard, uncharged and not yet evictable, so concurrent load() calls
+ * find and share it. The load task runs the loader without holding any lock, then charges the real size
+ * and reclaims space. If the entry was evicted or replaced meanwhile, the task sees a different
+ * request under the key and leaves the cache alone; its handles still receive the resource.
+ * Eviction follows each shard's own LRU order, so across shards it is approximate, while the
+ * byte count it enforces is exact.
+ */
+#include "ZResourceManager.h"
+#include "ZAssetPack.h"
+#include "../debug/ZProfiler.h"
+#include <iterator>
+
+#ifdef ZINCX_THREAD_SAFE
+#include <thread>
+#endif
+
+ZResourceManager::ZResourceManager(std::size_t budgetBytes, std::size_t shardCount, ZCompute* compute)
+    : compute_(compute ? compute : &ZCompute::shared()) {
+    if (shardCount == 0) throw ZincX::ZException("ZResourceManager requires at least one shard");
+    shards_.reserve(shardCount);
+    for (std::size_t i = 0; i < shardCount; ++i) shards_.push_back(std::make_unique<Shard>());
+    budget_ = budgetBytes;
+}
+
+ZResourceManager::~ZResourceManager() {
+#ifdef ZINCX_THREAD_SAFE
+    while (inFlight_.load(std::memory_order_acquire) != 0) {
+        if (!compute_->backend().runPendingTask()) std::this_thread::yield();
+    }
+#endif
+}
+
+void ZResourceManager::setLoader(ZincX::ResourceType type, Loader loader) {
+    loaders_[static_cast<std::size_t>(type)] = std::move(loader);
+}
+
+void ZResourceManager::mountPack(std::shared_ptr<const ZAssetPack> pack) {
+    if (!pack) throw ZincX::ZException("ZResourceManager::mountPack: null pack");
+    packs_.push_back(std::move(pack));
+}
+
+std::size_t ZResourceManager::budget() const {
+    return budget_;
+}
+
+void ZResourceManager::setBudget(std::size_t budgetBytes) {
+    budget_ = budgetBytes;
+    reclaim(0, nullptr);
+}
+
+std::size_t ZResourceManager::usedBytes() const {
+    return used_;
+}
+
+void ZResourceManager::erase(Shard& shard, std::list<Entry>::iterator it) {
+    used_ -= it->bytes;
+    shard.index.erase(it->key);
+    shard.lru.erase(it);
+}
+
+void ZResourceManager::reclaim(std::size_t firstShard, const ZResourceRequest* keep) {
+    // The first pass spares the entry that was just charged; only if nothing else is left does
+    // the second pass evict it too.
+    for (int pass = 0; pass < 2 && used_ > budget_; ++pass) {
+        for (std::size_t k = 0; k < shards_.size() && used_ > budget_; ++k) {
+            Shard& shard = *shards_[(firstShard + k) % shards_.size()];
+            [[maybe_unused]] auto lock = shard.lock();
+            auto it = shard.lru.end();
+            while (used_ > budget_ && it != shard.lru.begin()) {
+                auto victim = std::prev(it);
+                if (!victim->loaded || (pass == 0 && victim->request.get() == keep)) {
+                    it = victim;   // Still loading or spared.
+                    continue;
+                }
+                erase(shard, victim);
+                ++shard.evictions;
+            }
+        }
+    }
+}
+
+ZResourceHandle ZResourceManager::load(ZincX::ResourceType type, const std::string& name, ZincX::TaskPriority priority) {
+    if (!loaders_[static_cast<std::size_t>(type)] && packs_.empty()) {
+        throw ZincX::ZException("ZResourceManager::load: no loader or pack for this resource type");
+    }
+    Key key{ type, name };
+    Shard& shard = *shards_[shardIndex(key)];
+
+    using Result = std::shared_ptr<const ZResource>;
+    std::shared_ptr<ZResourceRequest> request;
+    std::shared_ptr<ZFutureState<Result>> done;
+    {
+        [[maybe_unused]] auto lock = shard.lock();
+        auto found = shard.index.find(key);
+        if (found != shard.index.end()) {
+            touch(shard, found->second);
+            return ZResourceHandle(found->second->request);
+        }
+        // Only a miss allocates. The future exists before the entry is visible, so a concurrent
+        // load() can wait on it.
+        request = std::make_shared<ZResourceRequest>();
+        done = std::make_shared<ZFutureState<Result>>(&compute_->backend());
+        request->done = ZFuture<Result>(done);
+        shard.lru.push_front({ key, request, 0 });
+        shard.index.emplace(std::move(key), shard.lru.begin());
+    }
+
+#ifdef ZINCX_THREAD_SAFE
+    inFlight_.fetch_add(1, std::memory_order_relaxed);
+#endif
+    compute_->backend().submit([this, type, name, request, done] {
+        zFulfill(*done, [&] { return runLoad(Key{ type, name }, request); });
+    }, priority);
+    return ZResourceHandle(std::move(request));
+}
+
+std::shared_ptr<const ZResource> ZResourceManager::runLoad(const Key& key, const std::shared_ptr<ZResourceRequest>& request) {
+    ZINCX_PROFILE_SCOPE("ZResourceManager::load", Resource);
+    ZINCX_PROFILE_COUNT(ResourceLoads, 1);
+    const std::size_t home = shardIndex(key);
+    Shard& shard = *shards_[home];
+    auto finish = [this] {
+#ifdef ZINCX_THREAD_SAFE
+        inFlight_.fetch_sub(1, std::memory_order_release);
+#endif
+    };
+
+    std::shared_ptr<const ZResource> resource;
+    try {
+        std::unique_ptr<ZResource> loaded;
+        for (auto pack = packs_.rbegin(); pack != packs_.rend() && !loaded; ++pack) {
+            const ZAssetPack::Entry* entry = (*pack)->find(key.name);
+            if (entry && entry->type == key.type) loaded = std::make_unique<ZPackedResource>(*pack, *entry);
+        }
+        if (!loaded) {
+            const Loader& loader = loaders_[static_cast<std::size_t>(key.type)];
+            if (!loader) throw ZincX::ZException("ZResourceManager: not in any mounted pack: " + key.name);
+            loaded = loader(key.name);
+        }
+        if (!loaded) throw ZincX::ZException("ZResourceManager: loader returned nothing for " + key.name);
+        resource = std::move(loaded);
+    } catch (...) {
+        {
+            [[maybe_unused]] auto lock = shard.lock();
+            auto found = shard.index.find(key);
+            if (found != shard.index.end() && found->second->request == request) erase(shard, found->second);
+        }
+        request->error = std::current_exception();
+        request->publish(ZincX::LoadState::Failed);
+        finish();
+        throw;
+    }
+
+    request->resource = resource;
+    {
+        [[maybe_unused]] auto lock = shard.lock();
+        auto found = shard.index.find(key);
+        if (found != shard.index.end() && found->second->request == request) {
+            found->second->bytes = resource->byteSize();
+            found->second->loaded = true;
+            used_ += found->second->bytes;
+        }
+    }
+    reclaim(home, request.get());
+    request->publish(ZincX::LoadState::Loaded);
+    finish();
+    return resource;
+}
+
+ZResourceHandle ZResourceManager::find(ZincX::ResourceType type, const std::string& name) {
+    Key key{ type, name };
+    Shard& shard = *shards_[shardIndex(key)];
+    [[maybe_unused]] auto lock = shard.lock();
+    auto found = shard.index.find(key);
+    if (found == shard.index.end()) return {};
+    touch(shard, found->second);
+    return ZResourceHandle(found->second->request);
+}
+
+ZResourceHandle ZResourceManager::insert(const std::string& name, std::unique_ptr<ZResource> resource) {
+    if (!resource) throw ZincX::ZException("ZResourceManager::insert: null resource");
+    using Result = std::shared_ptr<const ZResource>;
+    Key key{ resource->type(), name };
+    const std::size_t home = shardIndex(key);
+    Shard& shard = *shards_[home];
+
+    auto request = std::make_shared<ZResourceRequest>();
+    const std::size_t bytes = resource->byteSize();
+    request->resource = std::move(resource);
+    request->publish(ZincX::LoadState::Loaded);
+    auto done = std::make_shared<ZFutureState<Result>>(&compute_->backend());
+    done->value.emplace(request->resource);
+    done->complete();
+    request->done = ZFuture<Result>(std::move(done));
+
+    {
+        [[maybe_unused]] auto lock = shard.lock();
+        auto found = shard.index.find(key);
+        if (found != shard.index.end()) erase(shard, found->second);
+        shard.lru.push_front({ key, request, bytes, true });
+        shard.index.emplace(std::move(key), shard.lru.begin());
+        used_ += bytes;
+    }
+    reclaim(home, request.get());
+    return ZResourceHandle(std::move(request));
+}
+
+bool ZResourceManager::evict(ZincX::ResourceType type, const std::string& name) {
+    Key key{ type, name };
+    Shard& shard = *shards_[shardIndex(key)];
+    [[maybe_unused]] auto lock = shard.lock();
+    auto found = shard.index.find(key);
+    if (found == shard.index.end()) return false;
+    erase(shard, found->second);
+    return true;
+}
+
+void ZResourceManager::clear() {
+    for (auto& shard : shards_) {
+        [[maybe_unused]] auto lock = shard->lock();
+        for (auto it = shard->lru.begin(); it != shard->lru.end();) {
+            auto next = std::next(it);
+            if (it->loaded) erase(*shard, it);
+            it = next;
+        }
+    }
+}
+
+std::size_t ZResourceManager::size() const {
+    std::size_t total = 0;
+    for (const auto& shard : shards_) {
+        [[maybe_unused]] auto lock = shard->lock();
+        total += shard->lru.size();
+    }
+    return total;
+}
+
+std::size_t ZResourceManager::evictionCount() const {
+    std::size_t total = 0;
+    for (const auto& shard : shards_) {
+        [[maybe_unused]] auto lock = shard->lock();
+        total += shard->evictions;
+    }
+    return total;
+}
@@ -0,0 +1,294 @@
+/**
+ * @file ZResourceManager.h
+ * @brief Defines the resource cache and asynchronous loader of the ZincX framework.
+ *
+ * This file contains ZResource, the base of cached assets, ZResourceHandle, the caller's view of
+ * a (possibly still loading) resource, and ZResourceManager, a size-bounded LRU cache keyed by
+ * ResourceType and name. The cache is split into independently locked shards so threads loading
+ * different assets rarely contend; each shard keeps its own LRU order, and lookups and eviction
+ * are O(1). One byte count covers all shards and is held to the budget
+ * (ZincX::RESOURCE_CACHE_BYTES by default) exactly. Loads run on the ZCompute pool and publish
+ * their LoadState through the handle; on DOS the pool runs them inline. Mounted asset packs
+ * (ZAssetPack) are consulted before the per-type loaders.
+ */
+#pragma once
+#include "../common/ZCommon.h"
+#include "../common/ZCommonEnums.h"
+#include "../common/ZConfig.h"
+#include "../compute/ZCompute.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef ZINCX_THREAD_SAFE
+#include <atomic>
+#include <mutex>
+#endif
+
+class ZAssetPack;
+
+/**
+ * @brief Base class of everything ZResourceManager caches.
+ */
+class ZResource {
+public:
+    virtual ~ZResource() = default;
+
+    virtual ZincX::ResourceType type() const = 0;
+
+    /** @brief Bytes charged against the cache budget; should cover all memory the resource owns. */
+    virtual std::size_t byteSize() const = 0;
+};
+
+/**
+ * @brief A resource that is a plain byte buffer, such as shader source or an undecoded file.
+ */
+class ZBlobResource : public ZResource {
+public:
+    ZBlobResource(ZincX::ResourceType type, std::vector<std::uint8_t> bytes)
+        : type_(type), bytes_(std::move(bytes)) {}
+
+    ZincX::ResourceType type() const override { return type_; }
+    std::size_t byteSize() const override { return bytes_.size(); }
+
+    const std::vector<std::uint8_t>& bytes() const { return bytes_; }
+
+private:
+    ZincX::ResourceType type_;
+    std::vector<std::uint8_t> bytes_;
+};
+
+/** @brief Shared progress of one load; owned jointly by the cache entry and all handles. */
+struct ZResourceRequest {
+    ZincX::LoadState state() const {
+#ifdef ZINCX_THREAD_SAFE
+        return loadState.load(std::memory_order_acquire);
+#else
+        return loadState;
+#endif
+    }
+
+    void publish(ZincX::LoadState state) {
+#ifdef ZINCX_THREAD_SAFE
+        loadState.store(state, std::memory_order_release);
+#else
+        loadState = state;
+#endif
+    }
+
+    std::shared_ptr<const ZResource> resource;   ///< Written once, before the state becomes Loaded.
+    std::exception_ptr error;                    ///< Written once, before the state becomes Failed.
+    ZFuture<std::shared_ptr<const ZResource>> done;
+#ifdef ZINCX_THREAD_SAFE
+    std::atomic<ZincX::LoadState> loadState{ZincX::LoadState::Loading};
+#else
+    ZincX::LoadState loadState = ZincX::LoadState::Loading;
+#endif
+};
+
+/**
+ * @brief A copyable reference to a cached or loading resource.
+ *
+ * A handle keeps its resource alive after the cache evicts it; eviction only stops the cache
+ * from handing it out again.
+ */
+class ZResourceHandle {
+public:
+    ZResourceHandle() = default;
+
+    bool isValid() const { return request_ != nullptr; }
+
+    /** @brief Current state; Loading until the load task finishes. */
+    ZincX::LoadState state() const { return request_->state(); }
+
+    bool isLoaded() const { return request_ && request_->state() == ZincX::LoadState::Loaded; }
+
+    /** @brief The resource if loaded, otherwise null. Never blocks. */
+    std::shared_ptr<const ZResource> resource() const {
+        return isLoaded() ? request_->resource : nullptr;
+    }
+
+    /** @brief Like resource(), downcast to the concrete resource class. */
+    template <typename T>
+    std::shared_ptr<const T> as() const {
+        return std::dynamic_pointer_cast<const T>(resource());
+    }
+
+    /**
+     * @brief Blocks until the load finishes, helping the compute pool meanwhile.
+     * @return The resource; rethrows the loader's exception if the load failed.
+     */
+    std::shared_ptr<const ZResource> wait() const { return request_->done.get(); }
+
+    /** @brief Completion future, for attaching then() continuations. */
+    const ZFuture<std::shared_ptr<const ZResource>>& future() const { return request_->done; }
+
+private:
+    friend class ZResourceManager;
+    explicit ZResourceHandle(std::shared_ptr<ZResourceRequest> request) : request_(std::move(request)) {}
+
+    std::shared_ptr<ZResourceRequest> request_;
+};
+
+class ZResourceManager {
+public:
+    /**
+     * @brief Produces a resource from its name, or throws.
+     *
+     * Runs on a compute worker, so it must not touch UI state. Called concurrently for different
+     * names.
+     */
+    using Loader = std::function<std::unique_ptr<ZResource>(const std::string& name)>;
+
+    /**
+     * @brief Creates an empty cache.
+     * @param budgetBytes Total bytes the cache may hold.
+     * @param shardCount Number of independently locked shards; at least 1.
+     * @param compute Pool the loads run on; ZCompute::shared() if null.
+     */
+    explicit ZResourceManager(std::size_t budgetBytes = ZincX::RESOURCE_CACHE_BYTES,
+                              std::size_t shardCount = ZincX::RESOURCE_CACHE_SHARDS,
+                              ZCompute* compute = nullptr);
+
+    ZResourceManager(const ZResourceManager&) = delete;
+    ZResourceManager& operator=(const ZResourceManager&) = delete;
+
+    /**
+     * @brief Waits for loads still in flight; their tasks refer to the manager.
+     */
+    ~ZResourceManager();
+
+    /** @brief Installs the loader for a resource type. Configure loaders before issuing loads. */
+    void setLoader(ZincX::ResourceType type, Loader loader);
+
+    /**
+     * @brief Makes an archive's assets loadable by name, ahead of the loaders.
+     *
+     * Packs mounted later take precedence. An asset is served from a pack only if the entry's
+     * type matches the requested type; it then loads as a ZPackedResource. Mount packs before
+     * issuing loads.
+     */
+    void mountPack(std::shared_ptr<const ZAssetPack> pack);
+
+    /**
+     * @brief Returns the cached resource, starting an asynchronous load if it is not cached.
+     *
+     * Loads of the same name in flight are shared. If the load fails the entry is dropped, so a
+     * later call retries.
+     *
+     * @param type The resource type; its loader must be set unless a pack is mounted.
+     * @param name The resource name passed to the loader.
+     * @param priority Priority of the load task.
+     * @return A handle whose state() is Loading until the load completes.
+     */
+    ZResourceHandle load(ZincX::ResourceType type, const std::string& name,
+                         ZincX::TaskPriority priority = ZincX::TaskPriority::Medium);
+
+    /**
+     * @brief Looks up a resource without loading it.
+     * @return A handle, or an invalid one if the name is not cached or loading.
+     */
+    ZResourceHandle find(ZincX::ResourceType type, const std::string& name);
+
+    /**
+     * @brief Caches an already loaded resource under a name, replacing any previous entry.
+     * @return A handle in the Loaded state.
+     */
+    ZResourceHandle insert(const std::string& name, std::unique_ptr<ZResource> resource);
+
+    /** @brief Drops a cached entry. @return False if it was not cached. */
+    bool evict(ZincX::ResourceType type, const std::string& name);
+
+    /** @brief Drops every loaded entry; loads in flight stay cached. */
+    void clear();
+
+    /** @brief Bytes held by loaded entries. */
+    std::size_t usedBytes() const;
+
+    std::size_t budget() const;
+
+    /** @brief Changes the total budget, evicting least recently used entries as needed. */
+    void setBudget(std::size_t budgetBytes);
+
+    /** @brief Number of entries, loading ones included. */
+    std::size_t size() const;
+
+    /** @brief Entries evicted for space since construction. */
+    std::size_t evictionCount() const;
+
+private:
+    struct Key {
+        ZincX::ResourceType type;
+        std::string name;
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const {
+            return std::hash<std::string>()(key.name) * 31 + static_cast<std::size_t>(key.type);
+        }
+    };
+
+    struct Entry {
+        Key key;
+        std::shared_ptr<ZResourceRequest> request;
+        std::size_t bytes = 0;   ///< Charged size; 0 while loading.
+        bool loaded = false;     ///< Charged and evictable; false while its load is in flight.
+    };
+
+    /** @brief One lock's worth of cache: an LRU list (front = most recent) and its index. */
+    struct Shard {
+        std::list<Entry> lru;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+        std::size_t evictions = 0;
+#ifdef ZINCX_THREAD_SAFE
+        mutable std::mutex mutex;
+        std::unique_lock<std::mutex> lock() const { return std::unique_lock<std::mutex>(mutex); }
+#else
+        struct NoLock {};
+        NoLock lock() const { return {}; }
+#endif
+    };
+
+    std::size_t shardIndex(const Key& key) const { return KeyHash()(key) % shards_.size(); }
+
+    /** @brief Moves an entry to the front of its shard's list. */
+    static void touch(Shard& shard, std::list<Entry>::iterator it) { shard.lru.splice(shard.lru.begin(), shard.lru, it); }
+
+    /** @brief Removes an entry and uncharges its bytes; the shard must be locked. */
+    void erase(Shard& shard, std::list<Entry>::iterator it);
+
+    /**
+     * @brief Evicts least recently used loaded entries until the cache fits its budget.
+     *
+     * Starts with the given shard, where the new bytes went, and moves on to the others. Locks
+     * one shard at a time, so the caller must hold none.
+     *
+     * @param firstShard Shard to evict from first.
+     * @param keep Request of the entry just added, evicted only as a last resort; may be null.
+     */
+    void reclaim(std::size_t firstShard, const ZResourceRequest* keep);
+
+    /** @brief Body of a load task: runs the loader and publishes the outcome. */
+    std::shared_ptr<const ZResource> runLoad(const Key& key, const std::shared_ptr<ZResourceRequest>& request);
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::array<Loader, 3> loaders_;
+    std::vector<std::shared_ptr<const ZAssetPack>> packs_;
+    ZCompute* compute_;
+#ifdef ZINCX_THREAD_SAFE
+    std::atomic<std::size_t> used_{0};
+    std::atomic<std::size_t> budget_{0};
+    std::atomic<std::size_t> inFlight_{0};
+#else
+    std::size_t used_ = 0;
+    std::size_t budget_ = 0;
+#endif
+};
@@ -0,0 +1,34 @@
+/**
+ * @file ZAnimBase.cpp
+ * @brief Implementation of the ZAnimBase class and the stock animations for the ZincX style subsystem.
+ */
+#include "ZAnimBase.h"
+#include "ZAnimManager.h"
+#include "../graphics/ZGraphicsItem.h"
+#include <cmath>
+
+ZAnimBase::~ZAnimBase() {
+    if (manager_) manager_->stop(*this);
+}
+
+void ZAnimBase::setEasing(ZincX::Easing easing) {
+    switch (easing) {
+    case ZincX::Easing::Linear:
+        setEasingCurve(1.0f, 0.0f, 0.0f);
+        break;
+    case ZincX::Easing::EaseIn:
+        setEasingCurve(0.0f, 0.0f, 1.0f);
+        break;
+    case ZincX::Easing::EaseOut:
+        setEasingCurve(3.0f, -3.0f, 1.0f);
+        break;
+    case ZincX::Easing::EaseInOut:
+        setEasingCurve(0.0f, 3.0f, -2.0f);
+        break;
+    }
+}
+
+void ZGeometryAnim::update(float value) {
+    auto lerp = [value](int from, int to) { return from + static_cast<int>(std::lround(static_cast<float>(to - from) * value)); };
+    item_->setBounds({ lerp(from_.x, to_.x), lerp(from_.y, to_.y), lerp(from_.width, to_.width), lerp(from_.height, to_.height) });
+}
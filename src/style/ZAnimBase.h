@@ -0,0 +1,113 @@
+/**
+ * @file ZAnimBase.h
+ * @brief Defines the animation base class and the stock animations of the ZincX framework.
+ *
+ * This file contains ZAnimBase, the timing description (duration, delay, easing, loops) and
+ * callback of one animation, and the two common animations built on it: ZFloatAnim, which feeds
+ * an interpolated value to a setter, and ZGeometryAnim, which moves and resizes an item. An
+ * animation does nothing by itself; ZAnimManager::start() hands it to the manager that ticks it.
+ * Like graphics items, animations are owned by the caller, and destroying a running animation
+ * stops it.
+ */
+#pragma once
+#include "../common/ZCommon.h"
+#include "../common/ZCommonEnums.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+class ZAnimManager;
+class ZGraphicsItem;
+
+class ZAnimBase {
+public:
+    /**
+     * @param target Item redrawn after every step, or nullptr if update() damages what it changes
+     *        itself, as ZGraphicsItem::setBounds() does.
+     */
+    explicit ZAnimBase(ZGraphicsItem* target = nullptr) : target_(target) {}
+
+    /** @brief Stops the animation if it is running; finished() is not called. */
+    virtual ~ZAnimBase();
+
+    ZAnimBase(const ZAnimBase&) = delete;
+    ZAnimBase& operator=(const ZAnimBase&) = delete;
+
+    /** @brief Length of one run in microseconds; a run lasts at least one frame. */
+    void setDuration(std::uint64_t microseconds) { duration_ = microseconds; }
+    std::uint64_t duration() const { return duration_; }
+
+    /** @brief Time between the first frame after start() and the beginning of the first run. */
+    void setDelay(std::uint64_t microseconds) { delay_ = microseconds; }
+    std::uint64_t delay() const { return delay_; }
+
+    void setEasing(ZincX::Easing easing);
+
+    /**
+     * @brief Sets a custom curve: eased = c1 * t + c2 * t^2 + c3 * t^3 for progress t in [0, 1].
+     *
+     * Coefficients summing to 1 end the run at the final value; others overshoot or stop short.
+     */
+    void setEasingCurve(float c1, float c2, float c3) { curve_[0] = c1; curve_[1] = c2; curve_[2] = c3; }
+
+    /** @brief Number of runs before the animation finishes; 0 repeats forever. The default is 1. */
+    void setLoopCount(int loops) { loops_ = loops; }
+    int loopCount() const { return loops_; }
+
+    ZGraphicsItem* target() const { return target_; }
+
+    bool isRunning() const { return manager_ != nullptr; }
+
+protected:
+    /** @brief Applies one step; @p value is the eased progress, 0 at the start of a run and 1 at its end. */
+    virtual void update(float value) = 0;
+
+    /** @brief Called once the last run ended, after its final update(); may start the animation again. */
+    virtual void finished() {}
+
+private:
+    friend class ZAnimManager;
+
+    ZGraphicsItem* target_;
+    std::uint64_t duration_ = 250000;
+    std::uint64_t delay_ = 0;
+    float curve_[3] = { 1.0f, 0.0f, 0.0f };
+    int loops_ = 1;
+    ZAnimManager* manager_ = nullptr;
+    std::size_t slot_ = 0; ///< Index into the manager's arrays while running.
+};
+
+/** @brief Interpolates a float between two values and passes it to a setter. */
+class ZFloatAnim : public ZAnimBase {
+public:
+    ZFloatAnim(float from, float to, std::function<void(float)> setter, ZGraphicsItem* target = nullptr)
+        : ZAnimBase(target), from_(from), to_(to), setter_(std::move(setter)) {}
+
+    void setRange(float from, float to) { from_ = from; to_ = to; }
+
+protected:
+    void update(float value) override { setter_(from_ + (to_ - from_) * value); }
+
+private:
+    float from_;
+    float to_;
+    std::function<void(float)> setter_;
+};
+
+/** @brief Moves and resizes an item between two rectangles. */
+class ZGeometryAnim : public ZAnimBase {
+public:
+    ZGeometryAnim(ZGraphicsItem* item, const ZincX::ZRect& from, const ZincX::ZRect& to)
+        : item_(item), from_(from), to_(to) {}
+
+    void setRange(const ZincX::ZRect& from, const ZincX::ZRect& to) { from_ = from; to_ = to; }
+
+protected:
+    void update(float value) override;
+
+private:
+    ZGraphicsItem* item_;
+    ZincX::ZRect from_;
+    ZincX::ZRect to_;
+};
@@ -0,0 +1,173 @@
+/**
+ * @file ZAnimManager.cpp
+ * @brief Implementation of the ZAnimManager class for the ZincX style subsystem.
+ *
+ * A tick runs in three passes. The first computes the eased value of every slot with no branches
+ * beyond a clamp. The second walks the slots in order, calls update() and redraws
+ * targets, and retires runs that ended. The third closes the holes left by stopped and finished
+ * animations by moving the last slots into them. Animations started or stopped from a callback
+ * only append or null slots, so the passes never see the arrays shift under them.
+ */
+#include "ZAnimManager.h"
+#include "../debug/ZProfiler.h"
+#include "../graphics/ZGraphicsItem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Local times stay below 2^20 ms (about 17 minutes), keeping float steps under 0.1 ms.
+    constexpr float kRebaseAfterMs = 1048576.0f;
+
+    // Pass 1: eased value of every slot, stopped ones included. Branch-free with a single output
+    // array, so the compiler can vectorize it after a few overlap checks.
+    void ease(std::size_t count, float now, const float* start, const float* invDuration, const float* c1, const float* c2,
+              const float* c3, float* value) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const float t = std::min(std::max((now - start[i]) * invDuration[i], 0.0f), 1.0f);
+            value[i] = t * (c1[i] + t * (c2[i] + t * c3[i]));
+        }
+    }
+}
+
+ZAnimManager::~ZAnimManager() {
+    for (ZAnimBase* animation : animations_) {
+        if (animation) animation->manager_ = nullptr;
+    }
+}
+
+void ZAnimManager::start(ZAnimBase& animation) {
+    if (animation.manager_) animation.manager_->stop(animation);
+    if (!ticking_ && holes_) compact();
+
+    const std::size_t slot = animations_.size();
+    animations_.push_back(&animation);
+    start_.push_back(0.0f);
+    invDuration_.push_back(1000.0f / static_cast<float>(std::max<std::uint64_t>(animation.duration_, 1)));
+    c1_.push_back(animation.curve_[0]);
+    c2_.push_back(animation.curve_[1]);
+    c3_.push_back(animation.curve_[2]);
+    loopsLeft_.push_back(animation.loops_ - 1);
+    value_.push_back(0.0f);
+    pending_.push_back(&animation);
+    animation.manager_ = this;
+    animation.slot_ = slot;
+    if (running_++ == 0) {
+        haveEpoch_ = false;
+        activeChanged.emit(true);
+    }
+}
+
+void ZAnimManager::stop(ZAnimBase& animation) {
+    if (animation.manager_ != this) return;
+    auto it = std::find(pending_.begin(), pending_.end(), &animation);
+    if (it != pending_.end()) pending_.erase(it);
+    release(animation.slot_);
+    if (!ticking_ && running_ == 0) activeChanged.emit(false);
+}
+
+void ZAnimManager::release(std::size_t slot) {
+    animations_[slot]->manager_ = nullptr;
+    animations_[slot] = nullptr;
+    holes_ = true;
+    --running_;
+}
+
+void ZAnimManager::compact() {
+    std::size_t size = animations_.size();
+    for (std::size_t slot = 0; slot < size; ++slot) {
+        if (animations_[slot]) continue;
+        while (size > slot + 1 && !animations_[size - 1]) --size;
+        if (--size == slot) break;
+        animations_[slot] = animations_[size];
+        animations_[slot]->slot_ = slot;
+        start_[slot] = start_[size];
+        invDuration_[slot] = invDuration_[size];
+        c1_[slot] = c1_[size];
+        c2_[slot] = c2_[size];
+        c3_[slot] = c3_[size];
+        loopsLeft_[slot] = loopsLeft_[size];
+        value_[slot] = value_[size];
+    }
+    animations_.resize(size);
+    start_.resize(size);
+    invDuration_.resize(size);
+    c1_.resize(size);
+    c2_.resize(size);
+    c3_.resize(size);
+    loopsLeft_.resize(size);
+    value_.resize(size);
+    holes_ = false;
+}
+
+void ZAnimManager::rebase(std::uint64_t frameTime) {
+    const float shift = toLocal(frameTime);
+    epoch_ = frameTime;
+    for (float& start : start_) start -= shift;
+}
+
+std::uint64_t ZAnimManager::tick(std::uint64_t frameTime) {
+    ZINCX_PROFILE_SCOPE("ZAnimManager::tick", Rendering);
+    if (running_ == 0) return kIdle;
+    if (!haveEpoch_) {
+        epoch_ = frameTime;
+        haveEpoch_ = true;
+    } else if (toLocal(frameTime) > kRebaseAfterMs) {
+        rebase(frameTime);
+    }
+    const float now = toLocal(frameTime);
+    for (ZAnimBase* animation : pending_) {
+        start_[animation->slot_] = now + static_cast<float>(animation->delay_) / 1000.0f;
+    }
+    pending_.clear();
+
+    const std::size_t count = animations_.size();
+    ease(count, now, start_.data(), invDuration_.data(), c1_.data(), c2_.data(), c3_.data(), value_.data());
+
+    // Pass 2: apply. Callbacks may start animations (appended past count) or stop any (nulled).
+    ticking_ = true;
+    bool animating = false;
+    float nextStart = std::numeric_limits<float>::infinity();
+    try {
+        for (std::size_t i = 0; i < count; ++i) {
+            ZAnimBase* animation = animations_[i];
+            if (!animation) continue;
+            float p = (now - start_[i]) * invDuration_[i];
+            if (p < 0.0f) {
+                nextStart = std::min(nextStart, start_[i]);
+                continue;
+            }
+            animating = true;
+            bool last = false;
+            if (p >= 1.0f) {
+                const float runs = std::floor(p);
+                if (loopsLeft_[i] >= 0 && runs > static_cast<float>(loopsLeft_[i])) {
+                    last = true;
+                } else {
+                    if (loopsLeft_[i] > 0) loopsLeft_[i] -= static_cast<int>(runs);
+                    start_[i] += runs / invDuration_[i];
+                    p -= runs;
+                    value_[i] = p * (c1_[i] + p * (c2_[i] + p * c3_[i]));
+                }
+            }
+            ZGraphicsItem* target = animation->target_;
+            animation->update(value_[i]);
+            if (animations_[i] != animation) continue;
+            if (target) target->invalidate();
+            if (last) {
+                release(i);
+                animation->finished();
+            }
+        }
+    } catch (...) {
+        ticking_ = false;
+        throw;
+    }
+    ticking_ = false;
+    if (holes_) compact();
+    if (running_ == 0) {
+        activeChanged.emit(false);
+        return kIdle;
+    }
+    if (animating || !pending_.empty()) return frameTime;
+    return epoch_ + static_cast<std::uint64_t>(std::max(0.0, std::ceil(static_cast<double>(nextStart) * 1000.0)));
+}
@@ -0,0 +1,90 @@
+/**
+ * @file ZAnimManager.h
+ * @brief Defines the frame-paced animation scheduler of the ZincX framework.
+ *
+ * This file contains ZAnimManager, which advances every running ZAnimBase once per frame from one
+ * timestamp. The timing of all running animations is kept as parallel arrays (start, inverse
+ * duration, easing coefficients), so computing this frame's progress and eased value is a single
+ * loop of float arithmetic the compiler vectorizes; only the update() callbacks that follow are
+ * dispatched one by one. A step redraws just the animation's target item, so damage stays limited
+ * to what animates.
+ *
+ * The manager never schedules anything itself. The UI loop calls tick() before each render,
+ * ideally with the timestamp of the vertical blank the frame will be shown at, and uses the
+ * returned time to decide when it must wake next: with nothing animating, the loop can block on
+ * input indefinitely instead of rendering idle frames. activeChanged reports the transitions,
+ * for hosts that run a vsync timer only while it is needed.
+ *
+ * Like the scene graph, the manager and its animations are used from the UI thread only.
+ */
+#pragma once
+#include "ZAnimBase.h"
+#include "../common/ZCommon.h"
+#include "../event/ZSignal.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+class ZAnimManager {
+public:
+    /** @brief Returned by tick() when nothing is running. */
+    static constexpr std::uint64_t kIdle = std::numeric_limits<std::uint64_t>::max();
+
+    ZAnimManager() = default;
+
+    /** @brief Stops every animation; none of them see finished(). */
+    ~ZAnimManager();
+
+    ZAnimManager(const ZAnimManager&) = delete;
+    ZAnimManager& operator=(const ZAnimManager&) = delete;
+
+    /**
+     * @brief Starts an animation, restarting it if it is already running here or elsewhere.
+     *
+     * The run is timed from the next tick(), so it begins on the first frame that shows it rather
+     * than losing the time until then.
+     */
+    void start(ZAnimBase& animation);
+
+    /** @brief Stops an animation where it is; finished() is not called. Does nothing if it is not running here. */
+    void stop(ZAnimBase& animation);
+
+    /**
+     * @brief Advances every running animation to @p frameTime.
+     * @param frameTime The frame's timestamp in ZincX::ZTime::now() microseconds.
+     * @return When tick() must run next: @p frameTime if something is animating, so on the next
+     *         frame; the start of the earliest delayed animation if all are delayed; kIdle if none is running.
+     */
+    std::uint64_t tick(std::uint64_t frameTime = ZincX::ZTime::now());
+
+    bool isIdle() const { return running_ == 0; }
+
+    /** @brief Number of running animations. */
+    std::size_t size() const { return running_; }
+
+    /** @brief Emitted with true when the first animation starts and with false when the last one ends. */
+    ZSignal<bool> activeChanged;
+
+private:
+    /** @brief Times are float milliseconds after epoch_, rebased before they lose precision. */
+    float toLocal(std::uint64_t time) const { return static_cast<float>(static_cast<double>(static_cast<std::int64_t>(time - epoch_)) / 1000.0); }
+    void rebase(std::uint64_t frameTime);
+    void release(std::size_t slot);
+    void compact();
+
+    // One entry per slot; a stopped animation leaves a null slot until the next compact().
+    std::vector<ZAnimBase*> animations_;
+    std::vector<float> start_;        ///< Local start of the current run; set by the first tick.
+    std::vector<float> invDuration_;  ///< 1 / duration in milliseconds.
+    std::vector<float> c1_, c2_, c3_; ///< Easing polynomial.
+    std::vector<int> loopsLeft_;      ///< Runs after the current one; negative repeats forever.
+    std::vector<float> value_;        ///< Eased value at the last tick.
+
+    std::vector<ZAnimBase*> pending_; ///< Started since the last tick, waiting for their start time.
+    std::uint64_t epoch_ = 0;
+    bool haveEpoch_ = false;
+    std::size_t running_ = 0;
+    bool ticking_ = false;
+    bool holes_ = false;
+};
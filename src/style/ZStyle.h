@@ -0,0 +1,69 @@
+/**
+ * @file ZStyle.h
+ * @brief Defines the widget style description of the ZincX framework.
+ *
+ * This file contains ZStyleElement, the look of a widget in one WidgetState (fill, border,
+ * shadow and text color), and ZStyle, which holds one element per state. A style is shared by
+ * any number of ZStyledItem objects. Every edit gives it a new revision, which is unique across
+ * all styles, so cacheKey() changes whenever what a cached layer depends on may have changed,
+ * and the changed signal lets the items using the style redraw.
+ */
+#pragma once
+#include "../common/ZCommon.h"
+#include "../common/ZCommonEnums.h"
+#include "../event/ZSignal.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+class IZGraphicsBackend;
+
+/** @brief How a widget looks in one state. Fully transparent colors are not drawn. */
+struct ZStyleElement {
+    ZincX::ZColor background{ 0, 0, 0, 0 };
+    ZincX::ZColor border{ 0, 0, 0, 0 };
+    int borderWidth = 0;
+    ZincX::BorderStyle borderStyle = ZincX::BorderStyle::Solid;
+    ZincX::ZColor text{ 255, 255, 255 };
+    ZincX::ZColor shadow{ 0, 0, 0, 0 };
+    ZincX::ZPoint shadowOffset{ 0, 0 }; ///< Where the shadow lies relative to the box.
+};
+
+class ZStyle {
+public:
+    ZStyle();
+
+    ZStyle(const ZStyle&) = delete;
+    ZStyle& operator=(const ZStyle&) = delete;
+
+    /** @brief Returns the element for @p state, or the Normal element if none was set for it. */
+    const ZStyleElement& element(ZincX::WidgetState state) const;
+
+    /** @brief Replaces the element for @p state and emits changed. */
+    void setElement(ZincX::WidgetState state, const ZStyleElement& element);
+
+    /** @brief Changes with every edit; no two styles ever share a revision. */
+    std::uint64_t revision() const { return revision_; }
+
+    /** @brief Identifies the look of @p state, for ZLayerCache::update(). */
+    std::uint64_t cacheKey(ZincX::WidgetState state) const { return (revision_ << 8) | static_cast<std::uint64_t>(state); }
+
+    /**
+     * @brief Draws an element's shadow, fill and border.
+     *
+     * Everything stays inside @p rect: with a shadow offset, the box shrinks by the offset and
+     * the shadow fills the space it leaves. Dashed and dotted borders are drawn as runs of
+     * borderWidth-thick segments, in backend units.
+     */
+    static void drawElement(IZGraphicsBackend& backend, const ZincX::ZRect& rect, const ZStyleElement& element);
+
+    /** @brief Emitted after every setElement(); mutable so users of a const style can listen. */
+    mutable ZSignal<> changed;
+
+private:
+    static std::size_t index(ZincX::WidgetState state) { return static_cast<std::size_t>(state); }
+
+    std::array<ZStyleElement, 4> elements_;
+    std::array<bool, 4> set_{};
+    std::uint64_t revision_;
+};
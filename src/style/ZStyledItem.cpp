@@ -0,0 +1,63 @@
+/**
+ * @file ZStyledItem.cpp
+ * @brief Implementation of the ZStyledItem class for the ZincX style subsystem.
+ *
+ * Layer keys combine the style's cache key with the widget state, so a state change or a style
+ * edit re-records the cached layers and nothing else does; a label change invalidates the
+ * midground explicitly.
+ */
+#include "ZStyledItem.h"
+
+ZStyledItem::ZStyledItem(const ZStyle* style) {
+    setLayerCached(ZincX::StyleLayer::Background, true);
+    setStyle(style);
+}
+
+void ZStyledItem::setStyle(const ZStyle* style) {
+    if (style == style_) return;
+    style_ = style;
+    styleChanged_ = style_ ? style_->changed.connect([this] { invalidate(); }) : ZConnection();
+    invalidate();
+}
+
+void ZStyledItem::setText(const std::string& text) {
+    if (text == text_) return;
+    text_ = text;
+    invalidateLayer(ZincX::StyleLayer::Midground);
+}
+
+void ZStyledItem::saveProperty(std::uint32_t id, ZByteWriter& out) const {
+    if (id == TextProperty) out.string(text_);
+    else ZGraphicsItem::saveProperty(id, out);
+}
+
+void ZStyledItem::loadProperty(std::uint32_t id, ZByteReader& in) {
+    if (id == TextProperty) {
+        const std::string_view text = in.string();
+        if (text != text_) {
+            text_.assign(text);
+            invalidateLayer(ZincX::StyleLayer::Midground);
+        }
+    } else {
+        ZGraphicsItem::loadProperty(id, in);
+    }
+}
+
+void ZStyledItem::paintLayer(IZGraphicsBackend* backend, ZincX::StyleLayer layer) {
+    if (!style_) return;
+    const ZStyleElement& element = style_->element(state_);
+    switch (layer) {
+    case ZincX::StyleLayer::Background:
+        ZStyle::drawElement(*backend, bounds_, element);
+        break;
+    case ZincX::StyleLayer::Midground:
+        if (!text_.empty()) backend->drawText(text_, bounds_, element.text);
+        break;
+    case ZincX::StyleLayer::Foreground:
+        break;
+    }
+}
+
+std::uint64_t ZStyledItem::layerKey(ZincX::StyleLayer layer) const {
+    return style_ ? style_->cacheKey(state_) : ZGraphicsItem::layerKey(layer);
+}
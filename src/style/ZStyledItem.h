@@ -0,0 +1,48 @@
+/**
+ * @file ZStyledItem.h
+ * @brief Defines the scene item drawn from a ZStyle in the ZincX framework.
+ *
+ * This file contains ZStyledItem, a ZGraphicsItem whose background layer is its style's element
+ * for the current WidgetState and whose midground layer is its label. The background layer is
+ * cached by default, since themed fills, borders and shadows rarely change but are costly to
+ * draw: once rendered, a frame that only redraws the item's foreground, such as a blinking
+ * caret, copies it instead. Subclasses draw their own content by overriding paintLayer() and
+ * forwarding the layers they do not handle.
+ */
+#pragma once
+#include "ZStyle.h"
+#include "../graphics/ZGraphicsItem.h"
+#include <string>
+
+class ZStyledItem : public ZGraphicsItem {
+public:
+    enum StyledProperty : std::uint32_t {
+        TextProperty = ZGraphicsItem::PropertyCount, ///< The label, as a string.
+        StyledPropertyCount
+    };
+
+    /** @param style Drawn from; must outlive the item or be replaced first. May be null. */
+    explicit ZStyledItem(const ZStyle* style = nullptr);
+
+    /** @brief Switches to another style, redrawing the item. */
+    void setStyle(const ZStyle* style);
+    const ZStyle* style() const { return style_; }
+
+    void setText(const std::string& text);
+    const std::string& text() const { return text_; }
+
+    void draw(IZGraphicsBackend* backend) override { drawLayers(backend); }
+
+    std::uint32_t propertyCount() const override { return StyledPropertyCount; }
+    void saveProperty(std::uint32_t id, ZByteWriter& out) const override;
+    void loadProperty(std::uint32_t id, ZByteReader& in) override;
+
+protected:
+    void paintLayer(IZGraphicsBackend* backend, ZincX::StyleLayer layer) override;
+    std::uint64_t layerKey(ZincX::StyleLayer layer) const override;
+
+private:
+    const ZStyle* style_ = nullptr;
+    ZConnection styleChanged_;
+    std::string text_;
+};
@@ -0,0 +1,38 @@
+/**
+ * @file IZStateSerializable.h
+ * @brief Defines the property-level state interface of the ZincX undo/redo subsystem.
+ *
+ * This file contains IZStateSerializable, implemented by objects whose state can be saved,
+ * restored and undone. State is exposed as numbered properties rather than as one blob, so an
+ * undo entry stores just the bytes of the properties an edit changed and a scene snapshot can
+ * skip properties a reader does not know. Subclasses extend the property list of their base by
+ * numbering their own properties from the base's propertyCount() on and forwarding lower ids.
+ */
+#pragma once
+#include "ZByteStream.h"
+#include <cstdint>
+
+class IZStateSerializable {
+public:
+    virtual ~IZStateSerializable() = default;
+
+    /**
+     * @brief Identifies the concrete type for ZSceneSerializer, which creates objects by it.
+     *
+     * The default of 0 means the object is not restored from snapshots.
+     */
+    virtual std::uint32_t typeId() const { return 0; }
+
+    /** @brief Number of properties; valid ids are 0 to propertyCount() - 1. */
+    virtual std::uint32_t propertyCount() const = 0;
+
+    /** @brief Writes the current value of one property. */
+    virtual void saveProperty(std::uint32_t id, ZByteWriter& out) const = 0;
+
+    /**
+     * @brief Sets one property from the bytes saveProperty() wrote for it.
+     *
+     * Implementations copy what they keep: the reader's views die with its buffer.
+     */
+    virtual void loadProperty(std::uint32_t id, ZByteReader& in) = 0;
+};
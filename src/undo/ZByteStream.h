@@ -0,0 +1,116 @@
+/**
+ * @file ZByteStream.h
+ * @brief Defines the binary writer and reader used by ZincX state serialization.
+ *
+ * This file contains ZByteWriter, which appends little-endian values to a caller-owned byte
+ * buffer, and ZByteReader, which decodes them from any span of bytes. The writer never allocates
+ * per field: it only grows the buffer it was given, and a buffer that is cleared and written
+ * again reuses its capacity. The reader never copies: strings and byte blocks come back as views
+ * into the span, which can be a memory-mapped file such as a ZAssetPack asset.
+ *
+ * Integers are encoded byte by byte, so data reads the same on every target and needs no
+ * alignment. Reading past the end throws ZincX::ZException rather than returning garbage.
+ */
+#pragma once
+#include "../common/ZCommon.h"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+class ZByteWriter {
+public:
+    /** @param buffer Receives the bytes, appended after what it already holds. */
+    explicit ZByteWriter(std::vector<std::uint8_t>& buffer) : buffer_(buffer) {}
+
+    void u8(std::uint8_t value) { buffer_.push_back(value); }
+
+    void u32(std::uint32_t value) {
+        const std::uint8_t bytes[4] = { std::uint8_t(value), std::uint8_t(value >> 8), std::uint8_t(value >> 16), std::uint8_t(value >> 24) };
+        buffer_.insert(buffer_.end(), bytes, bytes + 4);
+    }
+
+    void u64(std::uint64_t value) {
+        u32(static_cast<std::uint32_t>(value));
+        u32(static_cast<std::uint32_t>(value >> 32));
+    }
+
+    void i32(std::int32_t value) { u32(static_cast<std::uint32_t>(value)); }
+    void f32(float value) { u32(std::bit_cast<std::uint32_t>(value)); }
+
+    /** @brief Writes a u32 length and the bytes. */
+    void string(std::string_view text) {
+        u32(static_cast<std::uint32_t>(text.size()));
+        buffer_.insert(buffer_.end(), text.begin(), text.end());
+    }
+
+    void bytes(std::span<const std::uint8_t> data) { buffer_.insert(buffer_.end(), data.begin(), data.end()); }
+
+    /** @brief Writes a u32 placeholder to be filled by patchU32() once its value is known. */
+    std::size_t reserveU32() {
+        const std::size_t at = buffer_.size();
+        u32(0);
+        return at;
+    }
+
+    void patchU32(std::size_t at, std::uint32_t value) {
+        for (int i = 0; i < 4; ++i) buffer_[at + i] = std::uint8_t(value >> (8 * i));
+    }
+
+    /** @brief Bytes in the buffer, including those it held before this writer. */
+    std::size_t size() const { return buffer_.size(); }
+
+    std::vector<std::uint8_t>& buffer() { return buffer_; }
+
+private:
+    std::vector<std::uint8_t>& buffer_;
+};
+
+class ZByteReader {
+public:
+    explicit ZByteReader(std::span<const std::uint8_t> data) : data_(data) {}
+
+    std::uint8_t u8() { return *take(1); }
+
+    std::uint32_t u32() {
+        const std::uint8_t* p = take(4);
+        return std::uint32_t(p[0]) | std::uint32_t(p[1]) << 8 | std::uint32_t(p[2]) << 16 | std::uint32_t(p[3]) << 24;
+    }
+
+    std::uint64_t u64() {
+        const std::uint64_t low = u32();
+        return low | std::uint64_t(u32()) << 32;
+    }
+
+    std::int32_t i32() { return static_cast<std::int32_t>(u32()); }
+    float f32() { return std::bit_cast<float>(u32()); }
+
+    /** @brief Reads a string written by ZByteWriter::string(); the view points into the data. */
+    std::string_view string() {
+        const std::uint32_t length = u32();
+        return { reinterpret_cast<const char*>(take(length)), length };
+    }
+
+    /** @brief Returns the next @p count bytes as a view into the data. */
+    std::span<const std::uint8_t> bytes(std::size_t count) { return { take(count), count }; }
+
+    /** @brief Skips @p count bytes. */
+    void skip(std::size_t count) { take(count); }
+
+    std::size_t position() const { return position_; }
+    std::size_t remaining() const { return data_.size() - position_; }
+    bool atEnd() const { return position_ == data_.size(); }
+
+private:
+    const std::uint8_t* take(std::size_t count) {
+        if (count > remaining()) throw ZincX::ZException("ZByteReader: data is truncated");
+        const std::uint8_t* p = data_.data() + position_;
+        position_ += count;
+        return p;
+    }
+
+    std::span<const std::uint8_t> data_;
+    std::size_t position_ = 0;
+};
@@ -0,0 +1,78 @@
+/**
+ * @file ZSceneSerializer.cpp
+ * @brief Implementation of the ZSceneSerializer class for the ZincX undo/redo subsystem.
+ *
+ * Parents are written as indices into the snapshot, which requires numbering the saved items
+ * before writing any record; loading creates every item first and links parents in a second
+ * pass, so a child may come before its parent. Property lengths are written as placeholders and
+ * patched after the property, which keeps saving a single pass over the items.
+ */
+#include "ZSceneSerializer.h"
+#include <cstring>
+#include <string>
+
+namespace {
+    constexpr char kMagic[4] = { 'Z', 'S', 'C', 'N' };
+}
+
+std::size_t ZSceneSerializer::save(const ZGraphicsScene& scene, std::vector<std::uint8_t>& out) {
+    indices_.clear();
+    for (const ZGraphicsItem* item : scene.items()) {
+        if (item->typeId() != 0) indices_.emplace(item, static_cast<std::uint32_t>(indices_.size()));
+    }
+
+    ZByteWriter writer(out);
+    writer.bytes({ reinterpret_cast<const std::uint8_t*>(kMagic), 4 });
+    writer.u32(kVersion);
+    writer.u32(static_cast<std::uint32_t>(indices_.size()));
+    writer.u32(0);
+    for (const ZGraphicsItem* item : scene.items()) {
+        if (item->typeId() == 0) continue;
+        const auto parent = item->parentItem() ? indices_.find(item->parentItem()) : indices_.end();
+        writer.u32(item->typeId());
+        writer.u32(parent != indices_.end() ? parent->second : kNoParent);
+        const std::uint32_t count = item->propertyCount();
+        writer.u32(count);
+        for (std::uint32_t id = 0; id < count; ++id) {
+            writer.u32(id);
+            const std::size_t length = writer.reserveU32();
+            item->saveProperty(id, writer);
+            writer.patchU32(length, static_cast<std::uint32_t>(writer.size() - length - 4));
+        }
+    }
+    return indices_.size();
+}
+
+void ZSceneSerializer::load(ZGraphicsScene& scene, std::span<const std::uint8_t> data, std::vector<ZGraphicsItem*>* items) {
+    ZByteReader reader(data);
+    if (reader.remaining() < kHeaderSize || std::memcmp(reader.bytes(4).data(), kMagic, 4) != 0) {
+        throw ZincX::ZException("ZSceneSerializer: not a scene snapshot");
+    }
+    if (reader.u32() != kVersion) throw ZincX::ZException("ZSceneSerializer: unsupported version");
+    const std::uint32_t count = reader.u32();
+    reader.skip(4);
+
+    created_.clear();
+    parents_.clear();
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const std::uint32_t type = reader.u32();
+        const auto factory = factories_.find(type);
+        if (factory == factories_.end()) throw ZincX::ZException("ZSceneSerializer: unregistered item type " + std::to_string(type));
+        ZGraphicsItem* item = factory->second(scene);
+        created_.push_back(item);
+        parents_.push_back(reader.u32());
+
+        const std::uint32_t properties = reader.u32();
+        for (std::uint32_t p = 0; p < properties; ++p) {
+            const std::uint32_t id = reader.u32();
+            ZByteReader value(reader.bytes(reader.u32()));
+            if (id < item->propertyCount()) item->loadProperty(id, value);
+        }
+    }
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (parents_[i] == kNoParent) continue;
+        if (parents_[i] >= count) throw ZincX::ZException("ZSceneSerializer: parent index out of range");
+        created_[i]->setParentItem(created_[parents_[i]]);
+    }
+    if (items) items->assign(created_.begin(), created_.end());
+}
@@ -0,0 +1,67 @@
+/**
+ * @file ZSceneSerializer.h
+ * @brief Defines the binary scene snapshot format of the ZincX undo/redo subsystem.
+ *
+ * This file contains ZSceneSerializer, which writes the items of a ZGraphicsScene into a byte
+ * buffer and recreates them from one. Items are written through IZStateSerializable, one length-
+ * prefixed record per property, so readers skip properties they do not know and newer item
+ * types can add properties without breaking older snapshots. Saving appends to a caller-owned
+ * buffer without allocating per item; loading reads straight from the span it is given, so a
+ * snapshot in a memory-mapped file (for instance a ZAssetPack asset's view()) is restored with
+ * no copy of the file.
+ *
+ * Layout, all integers little-endian:
+ * - Header, 16 bytes: magic "ZSCN", u32 version (1), u32 item count, u32 reserved.
+ * - Per item: u32 type id, u32 index of the parent item in this snapshot (0xFFFFFFFF for none),
+ *   u32 property count, then per property: u32 id, u32 byte length, the bytes.
+ *
+ * Only items with a non-zero typeId() are saved; loading creates them in the scene's pools with
+ * ZGraphicsScene::createItem(), so types must be registered with registerType() first.
+ */
+#pragma once
+#include "ZByteStream.h"
+#include "../graphics/ZGraphicsScene.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+class ZSceneSerializer {
+public:
+    static constexpr std::uint32_t kVersion = 1;
+    static constexpr std::size_t kHeaderSize = 16;
+    static constexpr std::uint32_t kNoParent = 0xFFFFFFFFu;
+
+    /**
+     * @brief Lets load() create items of type T for records with the given type id.
+     *
+     * T must be default constructible and return @p typeId from typeId().
+     */
+    template <typename T>
+    void registerType(std::uint32_t typeId) {
+        factories_[typeId] = [](ZGraphicsScene& scene) -> ZGraphicsItem* { return scene.createItem<T>(); };
+    }
+
+    /**
+     * @brief Appends a snapshot of the scene's items to @p out.
+     * @return The number of items saved.
+     */
+    std::size_t save(const ZGraphicsScene& scene, std::vector<std::uint8_t>& out);
+
+    /**
+     * @brief Creates the items of a snapshot in a scene and restores their properties and parents.
+     * @param items If given, receives the created items in snapshot order.
+     * @throws ZincX::ZException if the data is not a valid snapshot or holds an unregistered type;
+     *         items created before the error stay in the scene.
+     */
+    void load(ZGraphicsScene& scene, std::span<const std::uint8_t> data, std::vector<ZGraphicsItem*>* items = nullptr);
+
+private:
+    using Factory = ZGraphicsItem* (*)(ZGraphicsScene&);
+
+    std::unordered_map<std::uint32_t, Factory> factories_;
+    std::unordered_map<const ZGraphicsItem*, std::uint32_t> indices_; ///< Scratch for save(); keeps its buckets.
+    std::vector<ZGraphicsItem*> created_;                              ///< Scratch for load().
+    std::vector<std::uint32_t> parents_;                               ///< Scratch for load().
+};
@@ -0,0 +1,173 @@
+/**
+ * @file ZUndoRedoManager.cpp
+ * @brief Implementation of the ZUndoRedoManager class for the ZincX undo/redo subsystem.
+ *
+ * A delta is written in two halves around the edit: the header and old value before it, the new
+ * value after it. A merging edit writes nothing before; afterwards it cuts the last entry's new
+ * value off the end of the log and writes its own in its place, which is why only the newest
+ * entry can merge. Deltas whose old and new bytes are equal are dropped, as is a merged entry
+ * that ends where it started. Edits nested in another's apply function write their deltas after
+ * its old value; the outer edit moves them behind its new value and the entry becomes a group.
+ * The redo tail stays in the log, below the new delta, until the edit has succeeded. Dropping the
+ * oldest entries to stay within the byte limit moves the rest of the log down once per edit, not
+ * once per entry.
+ */
+#include "ZUndoRedoManager.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    constexpr std::size_t kHeaderBytes = 12; // u64 target, u32 property.
+
+    std::uint32_t readU32(const std::vector<std::uint8_t>& log, std::size_t at) {
+        return ZByteReader({ log.data() + at, 4 }).u32();
+    }
+}
+
+ZUndoRedoManager::Delta ZUndoRedoManager::beginDelta(IZStateSerializable& target, std::uint32_t property, std::uint64_t time) {
+    const Entry* last = current_ > 0 ? &entries_[current_ - 1] : nullptr;
+    const bool merging = groupDepth_ == 0 && editDepth_ == 0 && !sealed_ && mergeInterval_ > 0 &&
+                         current_ == entries_.size() && last && last->target == &target &&
+                         last->property == property && time >= last->time && time - last->time <= mergeInterval_;
+    const std::size_t start = log_.size();
+    if (merging) return { start, start, true };
+
+    ZByteWriter writer(log_);
+    writer.u64(reinterpret_cast<std::uintptr_t>(&target));
+    writer.u32(property);
+    const std::size_t length = writer.reserveU32();
+    target.saveProperty(property, writer);
+    writer.patchU32(length, static_cast<std::uint32_t>(log_.size() - length - 4));
+    return { start, log_.size(), false };
+}
+
+void ZUndoRedoManager::endDelta(IZStateSerializable& target, std::uint32_t property, const Delta& pending, std::uint64_t time) {
+    const bool nested = log_.size() != pending.oldEnd;
+    if (nested) nested_.assign(log_.begin() + static_cast<std::ptrdiff_t>(pending.oldEnd), log_.end());
+    std::size_t delta = pending.merging ? entries_.back().offset : pending.start;
+    std::size_t newValue = pending.merging ? entries_.back().newValue : pending.oldEnd;
+    log_.resize(newValue);
+    ZByteWriter writer(log_);
+    const std::size_t length = writer.reserveU32();
+    target.saveProperty(property, writer);
+    writer.patchU32(length, static_cast<std::uint32_t>(log_.size() - length - 4));
+
+    const std::size_t oldLength = readU32(log_, delta + kHeaderBytes);
+    const std::size_t newLength = log_.size() - newValue - 4;
+    const bool unchanged = oldLength == newLength &&
+                           std::memcmp(&log_[delta + kHeaderBytes + 4], &log_[newValue + 4], oldLength) == 0;
+    if (unchanged) log_.resize(delta);
+    if (nested) log_.insert(log_.end(), nested_.begin(), nested_.end());
+    // With nested deltas, or without its own, the entry is no longer a single mergeable delta.
+    const bool single = !unchanged && !nested;
+
+    if (pending.merging) {
+        Entry& last = entries_.back();
+        if (log_.size() == last.offset) {
+            entries_.pop_back();
+            current_ = entries_.size();
+            return;
+        }
+        last.end = log_.size();
+        last.time = time;
+        if (!single) last.target = nullptr;
+        return;
+    }
+    if (log_.size() == delta) return;
+    if (groupDepth_ > 0) groupTime_ = time;
+    if (groupDepth_ > 0 || editDepth_ > 0) return;
+
+    // The edit succeeded: its delta replaces the redo tail.
+    if (current_ < entries_.size()) {
+        const std::size_t tail = entries_[current_].offset;
+        log_.erase(log_.begin() + static_cast<std::ptrdiff_t>(tail), log_.begin() + static_cast<std::ptrdiff_t>(delta));
+        newValue -= delta - tail;
+        delta = tail;
+        entries_.resize(current_);
+    }
+    entries_.push_back({ delta, log_.size(), time, single ? &target : nullptr, property, newValue });
+    current_ = entries_.size();
+    sealed_ = false;
+    enforceLimit();
+}
+
+void ZUndoRedoManager::beginGroup() {
+    if (groupDepth_++ > 0) return;
+    truncateRedo();
+    groupStart_ = log_.size();
+    groupTime_ = 0;
+}
+
+void ZUndoRedoManager::endGroup() {
+    if (groupDepth_ == 0 || --groupDepth_ > 0) return;
+    if (log_.size() == groupStart_) return;
+    entries_.push_back({ groupStart_, log_.size(), groupTime_, nullptr, 0, 0 });
+    current_ = entries_.size();
+    enforceLimit();
+}
+
+void ZUndoRedoManager::truncateRedo() {
+    if (current_ == entries_.size()) return;
+    log_.resize(entries_[current_].offset);
+    entries_.resize(current_);
+    sealed_ = true;
+}
+
+void ZUndoRedoManager::enforceLimit() {
+    std::size_t drop = 0;
+    while (drop + 1 < entries_.size() && drop < current_ && log_.size() - entries_[drop].offset > byteLimit_) {
+        ++drop;
+    }
+    if (drop == 0) return;
+    const std::size_t shift = entries_[drop].offset;
+    log_.erase(log_.begin(), log_.begin() + static_cast<std::ptrdiff_t>(shift));
+    entries_.erase(entries_.begin(), entries_.begin() + static_cast<std::ptrdiff_t>(drop));
+    for (Entry& entry : entries_) {
+        entry.offset -= shift;
+        entry.end -= shift;
+        if (entry.target) entry.newValue -= shift;
+    }
+    current_ -= drop;
+    if (groupDepth_ > 0) groupStart_ -= shift;
+}
+
+void ZUndoRedoManager::undo() {
+    if (!canUndo()) return;
+    apply(entries_[--current_], true);
+    sealed_ = true;
+}
+
+void ZUndoRedoManager::redo() {
+    if (!canRedo()) return;
+    apply(entries_[current_++], false);
+    sealed_ = true;
+}
+
+void ZUndoRedoManager::clear() {
+    log_.clear();
+    entries_.clear();
+    current_ = 0;
+    groupDepth_ = 0;
+    sealed_ = false;
+}
+
+void ZUndoRedoManager::apply(const Entry& entry, bool undo) {
+    // Deltas can only be walked forward; a group is undone last edit first.
+    deltas_.clear();
+    for (std::size_t at = entry.offset; at < entry.end;) {
+        deltas_.push_back(at);
+        at += kHeaderBytes;
+        at += 4 + readU32(log_, at);
+        at += 4 + readU32(log_, at);
+    }
+    if (undo) std::reverse(deltas_.begin(), deltas_.end());
+    for (std::size_t at : deltas_) {
+        ZByteReader reader({ log_.data() + at, entry.end - at });
+        auto* target = reinterpret_cast<IZStateSerializable*>(static_cast<std::uintptr_t>(reader.u64()));
+        const std::uint32_t property = reader.u32();
+        const std::span<const std::uint8_t> before = reader.bytes(reader.u32());
+        const std::span<const std::uint8_t> after = reader.bytes(reader.u32());
+        ZByteReader value(undo ? before : after);
+        target->loadProperty(property, value);
+    }
+}
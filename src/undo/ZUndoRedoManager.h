@@ -0,0 +1,127 @@
+/**
+ * @file ZUndoRedoManager.h
+ * @brief Defines the delta-based undo/redo history of the ZincX framework.
+ *
+ * This file contains ZUndoRedoManager. It records edits as property deltas: for each property an
+ * edit changes, the bytes IZStateSerializable::saveProperty() wrote before and after the edit.
+ * An entry therefore costs the size of what changed, never a snapshot of the document. All
+ * entries live back to back in one byte log that grows like a stack: recording appends, undo and
+ * redo move a cursor, and recording after an undo truncates the redo tail in place.
+ *
+ * Consecutive edits of the same property of the same object merge into one entry while they
+ * arrive within the merge interval, as keystrokes in a text field do: the entry keeps the value
+ * from before the first edit and takes the value after the latest one, so typing a paragraph
+ * leaves one entry holding two strings. Edits between beginGroup() and endGroup() form one entry
+ * that is undone and redone as a whole, such as moving a selection of items; so do edits that
+ * another edit's apply function makes.
+ *
+ * The history refers to its targets by address: call clear() before destroying an object it
+ * holds edits for. Like the scene graph, the manager is used from the UI thread only.
+ */
+#pragma once
+#include "IZStateSerializable.h"
+#include "ZByteStream.h"
+#include "../common/ZCommon.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class ZUndoRedoManager {
+public:
+    /** @param byteLimit Log size above which the oldest entries are dropped; the latest is always kept. */
+    explicit ZUndoRedoManager(std::size_t byteLimit = 1 << 20) : byteLimit_(byteLimit) {}
+
+    ZUndoRedoManager(const ZUndoRedoManager&) = delete;
+    ZUndoRedoManager& operator=(const ZUndoRedoManager&) = delete;
+
+    /**
+     * @brief Records an edit of one property made by @p apply.
+     *
+     * The property is saved before and after @p apply runs; if the bytes are equal nothing is
+     * recorded. Edits @p apply makes itself are recorded into the same entry. If @p apply throws,
+     * nothing is recorded, the redo history is kept and the exception propagates.
+     * @param time When the edit happened, in ZincX::ZTime::now() microseconds; decides merging.
+     */
+    template <typename F>
+    void edit(IZStateSerializable& target, std::uint32_t property, F&& apply, std::uint64_t time = ZincX::ZTime::now()) {
+        const Delta delta = beginDelta(target, property, time);
+        ++editDepth_;
+        try {
+            apply();
+        } catch (...) {
+            --editDepth_;
+            log_.resize(delta.start);
+            throw;
+        }
+        --editDepth_;
+        endDelta(target, property, delta, time);
+    }
+
+    /** @brief Starts an entry that collects every edit until the matching endGroup(); groups nest. */
+    void beginGroup();
+    void endGroup();
+
+    /** @brief Makes the next edit start a new entry instead of merging into the last one. */
+    void seal() { sealed_ = true; }
+
+    /** @brief Sets how far apart in microseconds merging edits may be; 0 disables merging. The default is one second. */
+    void setMergeInterval(std::uint64_t microseconds) { mergeInterval_ = microseconds; }
+
+    bool canUndo() const { return current_ > 0 && groupDepth_ == 0; }
+    bool canRedo() const { return current_ < entries_.size() && groupDepth_ == 0; }
+
+    /** @brief Restores the properties of the latest done entry to their values before it. */
+    void undo();
+
+    /** @brief Re-applies the earliest undone entry. */
+    void redo();
+
+    /** @brief Drops the whole history. */
+    void clear();
+
+    /** @brief Number of entries, done and undone. */
+    std::size_t size() const { return entries_.size(); }
+
+    /** @brief Number of entries undo() can step back through. */
+    std::size_t undoCount() const { return current_; }
+
+    /** @brief Bytes the history occupies in its log. */
+    std::size_t byteSize() const { return log_.size(); }
+
+private:
+    struct Entry {
+        std::size_t offset;                 ///< Start of the entry's first delta in log_.
+        std::size_t end;                    ///< End of its last delta.
+        std::uint64_t time;                 ///< Time of its latest edit.
+        const IZStateSerializable* target;  ///< Target of its only delta, or null for a group.
+        std::uint32_t property;
+        std::size_t newValue;               ///< Offset of its only delta's new-value length.
+    };
+
+    /** @brief An edit between its two halves; kept by edit() so nested edits cannot disturb it. */
+    struct Delta {
+        std::size_t start;    ///< Log offset of its header, or the log's end if it merges.
+        std::size_t oldEnd;   ///< Log end once its old value is written; nested edits follow.
+        bool merging;         ///< It updates the last entry instead of adding one.
+    };
+
+    // Delta layout: u64 target address, u32 property, u32 length + old bytes, u32 length + new bytes.
+    Delta beginDelta(IZStateSerializable& target, std::uint32_t property, std::uint64_t time);
+    void endDelta(IZStateSerializable& target, std::uint32_t property, const Delta& delta, std::uint64_t time);
+    void truncateRedo();
+    void enforceLimit();
+    void apply(const Entry& entry, bool undo);
+
+    std::vector<std::uint8_t> log_;
+    std::vector<Entry> entries_;
+    std::vector<std::size_t> deltas_;       ///< Scratch for apply().
+    std::vector<std::uint8_t> nested_;      ///< Scratch for endDelta(): deltas of nested edits.
+    std::size_t current_ = 0;               ///< Entries before this index are done.
+    std::size_t byteLimit_;
+    std::uint64_t mergeInterval_ = 1000000;
+    int groupDepth_ = 0;
+    std::size_t groupStart_ = 0;            ///< Log offset where the open group began.
+    std::uint64_t groupTime_ = 0;
+    int editDepth_ = 0;                     ///< edit() calls whose apply function is running.
+    bool sealed_ = false;
+};
@@ -0,0 +1,261 @@
+/**
+ * @file ZListView.cpp
+ * @brief Implementation of the ZListView and ZRowView classes for the ZincX widgets subsystem.
+ *
+ * updateRows() is the only place row views are created, bound and placed. It computes the range
+ * of rows to keep bound, the visible rows plus the overscan, and walks it once: a view already
+ * holding its row only has its clipped bounds refreshed, which is a no-op for rows away from the
+ * edges, while the rows it must rebind are gathered into contiguous runs that are announced to
+ * the model with one fetch() each before their cells are read.
+ *
+ * Structural model changes go through updateRows() as well, marking the rows from the change on
+ * as stale. A data change touches only the part of the ring it overlaps and the columns showing
+ * the changed model columns.
+ */
+#include "ZListView.h"
+#include "../graphics/IZGraphicsBackend.h"
+#include "../graphics/ZGraphicsScene.h"
+#include "../mvc/ZModel.h"
+#include <algorithm>
+#include <climits>
+
+namespace {
+    /** The rows' common parent; it has no area and is never added to a scene. */
+    class ZListContent : public ZGraphicsItem {
+    public:
+        void draw(IZGraphicsBackend*) override {}
+    };
+}
+
+ZRowView::ZRowView(const ZListView& list) : ZStyledItem(list.rowStyle()), list_(list) {}
+
+void ZRowView::bind(const ZModel& model, std::size_t row) {
+    const std::vector<ZListView::Column>& columns = list_.columns();
+    cells_.resize(columns.size());
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        if (columns[i].modelColumn < model.columnCount()) model.data(row, columns[i].modelColumn, cells_[i]);
+        else cells_[i].clear();
+    }
+}
+
+void ZRowView::markStale(const ZincX::ZRect& area) {
+    stale_ = true;
+    if (isLayerCached(ZincX::StyleLayer::Midground)) invalidateLayer(ZincX::StyleLayer::Midground);
+    else invalidate(area);
+}
+
+void ZRowView::draw(IZGraphicsBackend* backend) {
+    if (stale_ && row_ != kUnbound && list_.model()) bind(*list_.model(), row_);
+    stale_ = false;
+    drawLayers(backend);
+}
+
+void ZRowView::paintLayer(IZGraphicsBackend* backend, ZincX::StyleLayer layer) {
+    if (layer != ZincX::StyleLayer::Midground) {
+        ZStyledItem::paintLayer(backend, layer);
+        return;
+    }
+    if (row_ == kUnbound) return;
+    const ZincX::ZColor color = style() ? style()->element(state_).text : ZincX::ZColor{ 255, 255, 255 };
+    const std::vector<ZListView::Column>& columns = list_.columns();
+    for (std::size_t i = 0; i < columns.size() && i < cells_.size(); ++i) {
+        if (cells_[i].empty()) continue;
+        const ZincX::ZRect cell = ZincX::ZRect{ columns[i].x, rowRect_.y, columns[i].width, rowRect_.height }.intersected(rowRect_);
+        if (!cell.isEmpty()) backend->drawText(cells_[i], cell, color, ZincX::TextAlignment::Left);
+    }
+}
+
+ZListView::ZListView(int rowHeight) : rowHeight_(std::max(rowHeight, 1)), content_(std::make_unique<ZListContent>()) {
+    content_->setParentItem(this);
+    layoutColumns(columns_);
+}
+
+ZListView::~ZListView() {
+    // Rows leave the scene before the list's own hooks are gone.
+    views_.clear();
+}
+
+void ZListView::setModel(const ZModel* model) {
+    if (model == model_) return;
+    model_ = model;
+    if (model_) {
+        modelConnections_[0] = model_->reset.connect([this] { columnsChanged(); });
+        modelConnections_[1] = model_->rowsInserted.connect([this](std::size_t first, std::size_t) { updateRows(first); });
+        modelConnections_[2] = model_->rowsRemoved.connect([this](std::size_t first, std::size_t) { updateRows(first); });
+        modelConnections_[3] = model_->dataChanged.connect([this](const ZModelRange& range, ZModelRoles roles) { modelDataChanged(range, roles); });
+    } else {
+        modelConnections_ = {};
+    }
+    columnsChanged();
+}
+
+void ZListView::setRowHeight(int height) {
+    height = std::max(height, 1);
+    if (height == rowHeight_) return;
+    rowHeight_ = height;
+    updateRows(0);
+}
+
+void ZListView::setOverscan(int rows) {
+    rows = std::max(rows, 0);
+    if (rows == overscan_) return;
+    overscan_ = rows;
+    updateRows(ZRowView::kUnbound);
+}
+
+void ZListView::setModelColumn(std::size_t column) {
+    if (column == modelColumn_) return;
+    modelColumn_ = column;
+    columnsChanged();
+}
+
+void ZListView::setRowStyle(const ZStyle* style) {
+    if (style == rowStyle_) return;
+    rowStyle_ = style;
+    for (auto& view : views_) view->setStyle(style);
+}
+
+void ZListView::setScrollOffset(int offset) {
+    offset = std::clamp(offset, 0, maxScroll());
+    if (offset == scroll_) return;
+    scroll_ = offset;
+    updateRows(ZRowView::kUnbound);
+}
+
+void ZListView::scrollToRow(std::size_t row) {
+    if (!model_ || row >= model_->rowCount()) return;
+    const long long top = static_cast<long long>(row) * rowHeight_;
+    if (top > INT_MAX - rowHeight_) return;
+    const int y = static_cast<int>(top);
+    if (y < scroll_) setScrollOffset(y);
+    else if (y + rowHeight_ > scroll_ + bounds_.height) setScrollOffset(y + rowHeight_ - bounds_.height);
+}
+
+int ZListView::contentHeight() const {
+    const long long height = model_ ? static_cast<long long>(model_->rowCount()) * rowHeight_ : 0;
+    return static_cast<int>(std::min<long long>(height, INT_MAX));
+}
+
+int ZListView::maxScroll() const {
+    return std::max(contentHeight() - bounds_.height, 0);
+}
+
+std::size_t ZListView::rowAt(const ZincX::ZPoint& point) const {
+    if (!model_ || !containsWorldPoint(point)) return ZRowView::kUnbound;
+    const ZincX::ZPoint local = mapFromWorld(point);
+    const long long y = static_cast<long long>(local.y - bounds_.y) + scroll_;
+    const std::size_t row = static_cast<std::size_t>(y / rowHeight_);
+    return row < model_->rowCount() ? row : ZRowView::kUnbound;
+}
+
+std::unique_ptr<ZRowView> ZListView::createRowView() {
+    return std::make_unique<ZRowView>(*this);
+}
+
+void ZListView::layoutColumns(std::vector<Column>& out) const {
+    out.assign(1, Column{ modelColumn_, 0, bounds_.width });
+}
+
+void ZListView::columnsChanged() {
+    layoutColumns(columns_);
+    updateRows(0);
+}
+
+void ZListView::boundsChanged() {
+    layoutColumns(columns_);
+    updateRows(ZRowView::kUnbound);
+}
+
+void ZListView::sceneChanged() {
+    for (auto& view : views_) {
+        if (scene()) scene()->addItem(view.get());
+        else if (view->scene()) view->scene()->removeItem(view.get());
+    }
+}
+
+void ZListView::updateRows(std::size_t staleFrom) {
+    const std::size_t rows = model_ ? model_->rowCount() : 0;
+    scroll_ = std::clamp(scroll_, 0, maxScroll());
+
+    // Visible rows, one more for a partly shown row at each edge, plus the overscan on both sides.
+    const std::size_t visible = bounds_.height > 0 ? static_cast<std::size_t>((bounds_.height + rowHeight_ - 1) / rowHeight_) + 1 : 0;
+    const std::size_t wanted = std::min(rows, visible + 2 * static_cast<std::size_t>(overscan_));
+    if (wanted != views_.size()) {
+        // The ring's size decides which view holds which row, so every row moves.
+        while (views_.size() > wanted) views_.pop_back();
+        while (views_.size() < wanted) {
+            std::unique_ptr<ZRowView> view = createRowView();
+            view->setParentItem(content_.get());
+            if (scene()) scene()->addItem(view.get());
+            views_.push_back(std::move(view));
+        }
+        staleFrom = 0;
+    }
+    if (views_.empty()) {
+        firstRow_ = 0;
+        return;
+    }
+
+    const std::size_t count = views_.size();
+    const std::size_t firstVisible = static_cast<std::size_t>(scroll_ / rowHeight_);
+    std::size_t first = firstVisible > static_cast<std::size_t>(overscan_) ? firstVisible - overscan_ : 0;
+    first = std::min(first, rows - count);
+    firstRow_ = first;
+
+    std::size_t runStart = first;
+    for (std::size_t row = first; row < first + count; ++row) {
+        ZRowView& view = *views_[row % count];
+        const bool bound = view.row_ == row && row < staleFrom;
+        if (bound && runStart < row) bindRun(runStart, row);
+        if (bound) runStart = row + 1;
+    }
+    if (runStart < first + count) bindRun(runStart, first + count);
+
+    // Content coordinates start at the first bound row, not at row 0: the offsets handed to the
+    // float transformations stay a few rows tall, so they are exact however far the list scrolls.
+    const int firstTop = static_cast<int>(static_cast<long long>(first) * rowHeight_ - scroll_);
+    content_->setTransform(ZincX::ZMatrix::translation(static_cast<float>(bounds_.x), static_cast<float>(bounds_.y + firstTop)));
+    for (std::size_t row = first; row < first + count; ++row) {
+        ZRowView& view = *views_[row % count];
+        const int top = static_cast<int>(row - first) * rowHeight_;
+        view.setTransform(ZincX::ZMatrix::translation(0, static_cast<float>(top)));
+        view.rowRect_.width = bounds_.width;
+        view.setBounds(view.rowRect_.intersected({ 0, -firstTop - top, bounds_.width, bounds_.height }));
+        // A row cut by the edge still lays its text out over the whole row.
+        view.setClipsToBounds(view.bounds() != view.rowRect_);
+    }
+}
+
+void ZListView::bindRun(std::size_t first, std::size_t end) {
+    model_->fetch(first, end - first);
+    const std::size_t count = views_.size();
+    for (std::size_t row = first; row < end; ++row) {
+        ZRowView& view = *views_[row % count];
+        view.row_ = row;
+        view.rowRect_ = { 0, 0, bounds_.width, rowHeight_ };
+        view.stale_ = false;
+        view.bind(*model_, row);
+        view.invalidateLayer(ZincX::StyleLayer::Midground);
+    }
+}
+
+void ZListView::modelDataChanged(const ZModelRange& range, ZModelRoles roles) {
+    if (!(roles & roles_) || views_.empty()) return;
+    const std::size_t count = views_.size();
+    const std::size_t first = std::max(range.firstRow, firstRow_);
+    const std::size_t end = std::min(range.endRow(), firstRow_ + count);
+    if (first >= end) return;
+
+    // Horizontal extent of the columns showing a changed model column.
+    int left = INT_MAX, right = INT_MIN;
+    for (const Column& column : columns_) {
+        if (column.modelColumn < range.firstColumn || column.modelColumn >= range.endColumn()) continue;
+        left = std::min(left, column.x);
+        right = std::max(right, column.x + column.width);
+    }
+    if (left >= right) return;
+    for (std::size_t row = first; row < end; ++row) {
+        ZRowView& view = *views_[row % count];
+        view.markStale({ left, view.rowRect_.y, right - left, rowHeight_ });
+    }
+}
@@ -0,0 +1,181 @@
+/**
+ * @file ZListView.h
+ * @brief Defines the virtualized list widget of the ZincX framework.
+ *
+ * This file contains ZListView, which shows the rows of a ZModel in a scrolling viewport, and
+ * ZRowView, the scene item that draws one row. A list never holds one item per model row: it
+ * keeps a fixed ring of row views covering the viewport plus a few overscan rows above and below
+ * it, and hands each view a new row as it scrolls out of range. Row r always lives in view
+ * r % ring size, so scrolling by a few rows rebinds just the views whose row changed, reading
+ * only those rows from the model; memory depends on the viewport, not on the row count.
+ *
+ * Rows are children of an internal content item whose transformation carries the scroll offset,
+ * so a scroll moves every row with one matrix and only re-records the views that were rebound
+ * or cut by the viewport edge. The content item's origin is the top of the first bound row and
+ * each view is translated by its place in the ring, so every coordinate stays within a few rows
+ * of zero and exact in float however many rows the model has. A row's bounds are its rectangle clipped to the viewport; overscan
+ * rows are bound but have empty bounds. A row cut by the edge lays its text out over the whole
+ * row, as when it is fully shown, and clips to its bounds, so the text moves with its row.
+ *
+ * The list follows the model's change notifications. Inserted or removed rows rebind only the
+ * views at or behind the change; changed cells only mark the row views showing them stale and
+ * damage those cells' rectangles, and a stale view re-reads its row when it is next drawn, so
+ * any number of changes to one row between two frames cost a single read.
+ */
+#pragma once
+#include "../graphics/ZGraphicsItem.h"
+#include "../mvc/ZModel.h"
+#include "../style/ZStyledItem.h"
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+class ZListView;
+
+/** @brief One recycled row of a ZListView; the list binds it to a model row as it scrolls. */
+class ZRowView : public ZStyledItem {
+public:
+    /** @brief row() of a view that shows no model row. */
+    static constexpr std::size_t kUnbound = std::numeric_limits<std::size_t>::max();
+
+    explicit ZRowView(const ZListView& list);
+
+    std::size_t row() const { return row_; }
+
+    /** @brief Returns the texts of the list's columns, as read at the last bind. */
+    const std::vector<std::string>& cells() const { return cells_; }
+
+    /** @brief Re-reads the row if the model changed it since the last bind, then draws the layers. */
+    void draw(IZGraphicsBackend* backend) override;
+
+protected:
+    /**
+     * @brief Reads a row from the model, replacing what the view showed.
+     *
+     * The default reads one cell per list column, reusing the strings' storage. It may run while
+     * the view is being drawn, so it must not invalidate anything; the list redraws the view.
+     */
+    virtual void bind(const ZModel& model, std::size_t row);
+
+    void paintLayer(IZGraphicsBackend* backend, ZincX::StyleLayer layer) override;
+
+    const ZListView& list() const { return list_; }
+
+    /** @brief The whole row in the view's coordinates, at the origin; bounds() is this clipped to the viewport. */
+    const ZincX::ZRect& rowRect() const { return rowRect_; }
+
+private:
+    friend class ZListView;
+
+    /** @brief Marks the row as changed in the model and damages @p area, in the view's coordinates. */
+    void markStale(const ZincX::ZRect& area);
+
+    const ZListView& list_;
+    std::size_t row_ = kUnbound;
+    bool stale_ = false;
+    ZincX::ZRect rowRect_{ 0, 0, 0, 0 };
+    std::vector<std::string> cells_;
+};
+
+class ZListView : public ZStyledItem {
+public:
+    /** @brief One column of the list, in content coordinates. */
+    struct Column {
+        std::size_t modelColumn; ///< Model column the cell text is read from.
+        int x;                   ///< Left edge relative to the list.
+        int width;
+    };
+
+    /** @param rowHeight Height of every row in view units; the default of one suits text cells. */
+    explicit ZListView(int rowHeight = 1);
+    ~ZListView() override;
+
+    /**
+     * @brief Shows another model, or none.
+     *
+     * The model must outlive the list or be replaced first. The scroll offset is kept where the
+     * new model allows it.
+     */
+    void setModel(const ZModel* model);
+    const ZModel* model() const { return model_; }
+
+    void setRowHeight(int height);
+    int rowHeight() const { return rowHeight_; }
+
+    /** @brief Sets the number of rows kept bound beyond each edge of the viewport; the default is 2. */
+    void setOverscan(int rows);
+    int overscan() const { return overscan_; }
+
+    /** @brief Selects the model column a single-column list shows; the default is 0. */
+    void setModelColumn(std::size_t column);
+    std::size_t modelColumn() const { return modelColumn_; }
+
+    /** @brief Style of the row views; may be null. */
+    void setRowStyle(const ZStyle* style);
+    const ZStyle* rowStyle() const { return rowStyle_; }
+
+    /**
+     * @brief Scrolls to a content offset, clamped to the rows there are.
+     * @param offset Distance from the top of the first row to the top of the viewport.
+     */
+    void setScrollOffset(int offset);
+    int scrollOffset() const { return scroll_; }
+
+    /** @brief Scrolls the least distance that shows all of @p row, if it exists. */
+    void scrollToRow(std::size_t row);
+
+    /** @brief Height of all rows together, limited to what fits in an int. */
+    int contentHeight() const;
+
+    /** @brief Returns the model row under a point in view coordinates, or ZRowView::kUnbound. */
+    std::size_t rowAt(const ZincX::ZPoint& point) const;
+
+    const std::vector<Column>& columns() const { return columns_; }
+
+    /** @brief Number of row views currently materialized; bounded by the viewport, not the model. */
+    std::size_t rowViewCount() const { return views_.size(); }
+
+protected:
+    /** @brief Makes a new row view; override to draw rows differently. */
+    virtual std::unique_ptr<ZRowView> createRowView();
+
+    /** @brief Computes the column layout for the current width. The default is one column spanning the list. */
+    virtual void layoutColumns(std::vector<Column>& out) const;
+
+    /** @brief Recomputes the columns and rebinds every row, e.g. after a column setting changed. */
+    void columnsChanged();
+
+    /**
+     * @brief Sets the model roles the rows show; changes to other roles are ignored.
+     *
+     * The default is the Display role. Row views that show more set it accordingly.
+     */
+    void setShownRoles(ZModelRoles roles) { roles_ = roles; }
+    ZModelRoles shownRoles() const { return roles_; }
+
+    void boundsChanged() override;
+    void sceneChanged() override;
+
+private:
+    /** @brief Brings the row views in line with the scroll offset, re-reading rows from @p staleFrom on. */
+    void updateRows(std::size_t staleFrom);
+    void bindRun(std::size_t first, std::size_t end);
+    void modelDataChanged(const ZModelRange& range, ZModelRoles roles);
+    int maxScroll() const;
+
+    const ZModel* model_ = nullptr;
+    std::array<ZConnection, 4> modelConnections_;
+    ZModelRoles roles_ = zRole(ZincX::ModelRole::Display);
+    std::size_t firstRow_ = 0;                   ///< Row held by the ring's first view in row order.
+    const ZStyle* rowStyle_ = nullptr;
+    int rowHeight_;
+    int overscan_ = 2;
+    std::size_t modelColumn_ = 0;
+    int scroll_ = 0;
+    std::vector<Column> columns_;
+    std::unique_ptr<ZGraphicsItem> content_;     ///< Parent of the rows; its transformation scrolls them.
+    std::vector<std::unique_ptr<ZRowView>> views_; ///< Ring of row views; row r lives in views_[r % size].
+};
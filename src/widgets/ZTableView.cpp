@@ -0,0 +1,32 @@
+/**
+ * @file ZTableView.cpp
+ * @brief Implementation of the ZTableView class for the ZincX widgets subsystem.
+ */
+#include "ZTableView.h"
+#include "../mvc/ZModel.h"
+#include <algorithm>
+
+void ZTableView::setColumnWidths(const std::vector<int>& widths) {
+    if (widths == widths_) return;
+    widths_ = widths;
+    columnsChanged();
+}
+
+void ZTableView::layoutColumns(std::vector<Column>& out) const {
+    out.clear();
+    const int width = bounds().width;
+    if (widths_.empty()) {
+        const std::size_t count = model() ? model()->columnCount() : 1;
+        if (count == 0) return;
+        const int share = width / static_cast<int>(count);
+        for (std::size_t i = 0; i < count; ++i) out.push_back({ i, static_cast<int>(i) * share, share });
+    } else {
+        int x = 0;
+        for (std::size_t i = 0; i < widths_.size(); ++i) {
+            out.push_back({ i, x, std::max(widths_[i], 0) });
+            x += out.back().width;
+        }
+    }
+    Column& last = out.back();
+    last.width = std::max(width - last.x, last.width);
+}
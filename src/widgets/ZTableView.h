@@ -0,0 +1,30 @@
+/**
+ * @file ZTableView.h
+ * @brief Defines the virtualized table widget of the ZincX framework.
+ *
+ * This file contains ZTableView, a ZListView that shows several model columns side by side. It
+ * virtualizes rows exactly like the list; columns are laid out from fixed widths, with the last
+ * one stretched over whatever width remains.
+ */
+#pragma once
+#include "ZListView.h"
+#include <vector>
+
+class ZTableView : public ZListView {
+public:
+    explicit ZTableView(int rowHeight = 1) : ZListView(rowHeight) {}
+
+    /**
+     * @brief Sets the width of each shown column; column i shows model column i.
+     *
+     * With no widths set, every model column gets an equal share of the width.
+     */
+    void setColumnWidths(const std::vector<int>& widths);
+    const std::vector<int>& columnWidths() const { return widths_; }
+
+protected:
+    void layoutColumns(std::vector<Column>& out) const override;
+
+private:
+    std::vector<int> widths_;
+};
@@ -0,0 +1,61 @@
+/**
+ * @file ZTest.h
+ * @brief Check macros and a case runner for the ZincX regression tests.
+ *
+ * Each test executable defines its cases with ZTEST and ends with ZTEST_MAIN(). A failed ZCHECK
+ * reports the file, line and expression and lets the case continue, so one run shows every
+ * broken expectation; the executable exits non-zero if any check failed, which is what ctest
+ * looks at. A command-line argument runs only the cases whose names contain it.
+ */
+#pragma once
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace ZTest {
+    struct Case {
+        const char* name;
+        void (*run)();
+    };
+
+    inline std::vector<Case>& cases() {
+        static std::vector<Case> all;
+        return all;
+    }
+
+    inline int& failures() {
+        static int count = 0;
+        return count;
+    }
+
+    struct Registration {
+        Registration(const char* name, void (*run)()) { cases().push_back({ name, run }); }
+    };
+
+    inline int runAll(int argc, char** argv) {
+        const char* filter = argc > 1 ? argv[1] : "";
+        for (const Case& test : cases()) {
+            if (!std::strstr(test.name, filter)) continue;
+            const int before = failures();
+            test.run();
+            std::fprintf(stderr, "%s %s\n", failures() == before ? "[ OK ]" : "[FAIL]", test.name);
+        }
+        return failures() == 0 ? 0 : 1;
+    }
+}
+
+#define ZTEST(name)                                                     \
+    static void name();                                                 \
+    static const ZTest::Registration name##Registration(#name, name);   \
+    static void name()
+
+#define ZCHECK(condition)                                                                         \
+    do {                                                                                          \
+        if (!(condition)) {                                                                       \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);   \
+            ++ZTest::failures();                                                                  \
+        }                                                                                         \
+    } while (0)
+
+#define ZTEST_MAIN() \
+    int main(int argc, char** argv) { return ZTest::runAll(argc, argv); }
@@ -0,0 +1,758 @@
+/**
+ * @file bench_zincx.cpp
+ * @brief The zincx_bench benchmark suite for the ZincX framework's hot paths.
+ *
+ * Covers ZGraphicsView::render over a counting backend, of cached style layers and with a statically bound text backend, ZEventManager queue and dispatch, ZSignal
+ * emission, ZAnimManager ticks, scrolling a virtualized ZTableView, undo recording and scene snapshots, ZNet loopback telemetry, ZGrid layout of large trees and ZResourceManager hits and misses. Each benchmark calibrates an
+ * iteration count to a minimum sample time, takes several samples and reports the median, so
+ * runs on one machine are comparable; all inputs are generated deterministically. Results are
+ * written to stdout as one JSON document, progress to stderr:
+ *
+ *     zincx_bench [--filter <substring>] [--repeats <n>] [--min-time-ms <ms>] > results.json
+ *
+ * Backends and loads run inline (no worker threads) unless a benchmark name says otherwise, so
+ * the numbers measure the framework rather than the scheduler.
+ */
+#include "common/ZArena.h"
+#include "common/ZCommon.h"
+#include "common/ZConfig.h"
+#include "compute/CPUComputeBackend.h"
+#include "compute/ZCompute.h"
+#include "event/ZEventManager.h"
+#include "event/ZSignal.h"
+#include "graphics/DOSGraphicsBackend.h"
+#include "graphics/IZGraphicsBackend.h"
+#include "graphics/SoftwareGraphicsBackend.h"
+#include "graphics/ZGraphicsItem.h"
+#include "graphics/ZGraphicsScene.h"
+#include "graphics/ZGraphicsView.h"
+#include "graphics/ZQuadBatch.h"
+#include "layout/ZGrid.h"
+#include "layout/ZLayoutNode.h"
+#include "mvc/ZModel.h"
+#include "mvc/ZTableModel.h"
+#ifdef ZINCX_NETWORK
+#include "network/ZNet.h"
+#endif
+#include "resource/ZResourceManager.h"
+#include "style/ZAnimManager.h"
+#include "style/ZStyledItem.h"
+#include "undo/ZSceneSerializer.h"
+#include "undo/ZUndoRedoManager.h"
+#include "widgets/ZTableView.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::string filter;
+        int repeats = 7;
+        double minSampleMs = 20.0;
+    };
+
+    struct Result {
+        std::string name;
+        std::uint64_t iterations;   ///< Per sample.
+        double medianNs;            ///< Per operation.
+        double minNs;
+        double maxNs;
+        double itemsPerOp;          ///< Work units per operation, for the throughput column.
+    };
+
+    /** @brief Runs benchmarks and collects their results. */
+    class Runner {
+    public:
+        explicit Runner(const Options& options) : options_(options) {}
+
+        /**
+         * @brief Times one operation.
+         * @param name Reported name; skipped unless it contains the filter.
+         * @param itemsPerOp Work units one call of @p op processes (items drawn, events dispatched...).
+         * @param op The operation; its state must make repeated calls equivalent.
+         */
+        void run(const std::string& name, double itemsPerOp, const std::function<void()>& op) {
+            if (!options_.filter.empty() && name.find(options_.filter) == std::string::npos) return;
+            std::fprintf(stderr, "%-48s", name.c_str());
+
+            // Calibrate: double the batch until one sample takes at least the minimum time.
+            std::uint64_t iterations = 1;
+            for (;;) {
+                const double ms = sample(op, iterations) / 1e6;
+                if (ms >= options_.minSampleMs || iterations >= (std::uint64_t(1) << 30)) break;
+                iterations = ms <= 0.0 ? iterations * 16
+                                       : std::max(iterations * 2, std::uint64_t(iterations * options_.minSampleMs / ms));
+            }
+            std::vector<double> perOp;
+            for (int r = 0; r < options_.repeats; ++r) perOp.push_back(sample(op, iterations) / double(iterations));
+            std::sort(perOp.begin(), perOp.end());
+
+            Result result{ name, iterations, perOp[perOp.size() / 2], perOp.front(), perOp.back(), itemsPerOp };
+            std::fprintf(stderr, "%12.1f ns/op %14.0f items/s\n", result.medianNs,
+                         result.medianNs > 0.0 ? itemsPerOp * 1e9 / result.medianNs : 0.0);
+            results_.push_back(result);
+        }
+
+        const std::vector<Result>& results() const { return results_; }
+
+    private:
+        static double sample(const std::function<void()>& op, std::uint64_t iterations) {
+            const auto begin = Clock::now();
+            for (std::uint64_t i = 0; i < iterations; ++i) op();
+            return std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+        }
+
+        Options options_;
+        std::vector<Result> results_;
+    };
+
+    /** @brief Backend that records nothing and counts calls; isolates the view from rasterization. */
+    class CountingBackend : public IZGraphicsBackend {
+    public:
+        explicit CountingBackend(ZincX::ZSize size) : size_(size) {}
+
+        void initialize(ZincX::RenderMode) override {}
+        ZincX::ZSize surfaceSize() const override { return size_; }
+        void setClipRect(const ZincX::ZRect&) override { ++calls; }
+        void fillRect(const ZincX::ZRect&, const ZincX::ZColor&) override { ++calls; }
+        void drawRect(const ZincX::ZRect&, const ZincX::ZColor&) override { ++calls; }
+        void drawLine(const ZincX::ZPoint&, const ZincX::ZPoint&, const ZincX::ZColor&) override { ++calls; }
+        void drawCircle(const ZincX::ZPoint&, int, const ZincX::ZColor&, bool) override { ++calls; }
+        void drawEllipse(const ZincX::ZPoint&, int, int, const ZincX::ZColor&, bool) override { ++calls; }
+        void drawPolygon(const std::vector<ZincX::ZPoint>&, const ZincX::ZColor&, bool) override { ++calls; }
+        void drawText(const std::string&, const ZincX::ZRect&, const ZincX::ZColor&, ZincX::TextAlignment) override { ++calls; }
+
+        std::uint64_t calls = 0;
+
+    private:
+        ZincX::ZSize size_;
+    };
+
+    class BenchItem : public ZGraphicsItem {
+    public:
+        void draw(IZGraphicsBackend* backend) override {
+            backend->fillRect(bounds(), ZincX::ZColor(40, 40, 160));
+            backend->drawRect(bounds(), ZincX::ZColor(255, 255, 255));
+            backend->drawText("item", bounds(), ZincX::ZColor(255, 255, 0));
+        }
+    };
+
+    void benchRender(Runner& runner) {
+        constexpr ZincX::ZSize kSurface{ 1920, 1080 };
+        for (int count : { 100, 1000, 10000 }) {
+            auto owned = std::make_unique<CountingBackend>(kSurface);
+            ZGraphicsView view(std::move(owned));
+            std::vector<BenchItem> items(static_cast<std::size_t>(count));
+            // Square-ish grid of equal cells covering the surface.
+            int columns = 1;
+            while (columns * columns < count) ++columns;
+            const int rows = (count + columns - 1) / columns;
+            const int w = std::max(1, kSurface.width / columns), h = std::max(1, kSurface.height / rows);
+            for (int i = 0; i < count; ++i) {
+                items[static_cast<std::size_t>(i)].setBounds({ (i % columns) * w, (i / columns) * h, w - 1, h - 1 });
+                view.addItem(&items[static_cast<std::size_t>(i)]);
+            }
+            view.render();
+
+            const std::string n = std::to_string(count);
+            runner.run("render/full/items=" + n, count, [&] {
+                view.invalidateAll();
+                view.render();
+            });
+            runner.run("render/full_redraw/items=" + n, count, [&] {
+                for (auto& item : items) item.invalidate();
+                view.render();
+            });
+            ZincX::ZRect home = items[0].bounds();
+            bool moved = false;
+            runner.run("render/move_one/items=" + n, 1, [&] {
+                moved = !moved;
+                items[0].setBounds(moved ? ZincX::ZRect{ home.x + 3, home.y + 3, home.width, home.height } : home);
+                view.render();
+            });
+            runner.run("render/idle/items=" + n, 1, [&] { view.render(); });
+        }
+
+        // A scrolled panel: one transformation moves every child; nothing is re-recorded.
+        for (int count : { 1000, 10000 }) {
+            ZGraphicsView view(std::make_unique<CountingBackend>(kSurface));
+            BenchItem panel;
+            panel.setBounds({ 0, 0, kSurface.width, kSurface.height });
+            view.addItem(&panel);
+            std::vector<BenchItem> rows(static_cast<std::size_t>(count));
+            for (int i = 0; i < count; ++i) {
+                BenchItem& row = rows[static_cast<std::size_t>(i)];
+                row.setBounds({ 8, i * 20, kSurface.width - 16, 19 });
+                row.setParentItem(&panel);
+                view.addItem(&row);
+            }
+            view.render();
+            int offset = 0;
+            runner.run("render/scroll_panel/children=" + std::to_string(count), 1, [&] {
+                offset = (offset + 7) % 400;
+                panel.setTransform(ZincX::ZMatrix::translation(0.0f, static_cast<float>(-offset)));
+                view.render();
+            });
+        }
+
+        // An 80x25 text screen of 100 cells, each redrawn every frame, through each way of binding the backend.
+        auto textScreen = [&](auto& view, const char* binding) {
+            std::vector<BenchItem> cells(100);
+            for (std::size_t i = 0; i < cells.size(); ++i) {
+                cells[i].setBounds({ static_cast<int>(i % 10) * 8, static_cast<int>(i / 10) * 2 + 2, 7, 2 });
+                view.addItem(&cells[i]);
+            }
+            view.render();
+            runner.run(std::string("render/dos_text/view=") + binding, 100, [&] {
+                for (auto& cell : cells) cell.invalidate();
+                view.render();
+            });
+        };
+        {
+            ZGraphicsView view(std::make_unique<DOSGraphicsBackend>(80, 25));
+            textScreen(view, "dynamic");
+        }
+        {
+            ZGraphicsView<DOSGraphicsBackend> view(ZincX::RenderMode::Text, 80, 25);
+            textScreen(view, "static");
+        }
+
+        // A form of styled fields whose carets blink every frame, with and without a cached background layer.
+        struct CaretField : ZStyledItem {
+            using ZStyledItem::ZStyledItem;
+            bool caret = false;
+            void paintLayer(IZGraphicsBackend* backend, ZincX::StyleLayer layer) override {
+                if (layer != ZincX::StyleLayer::Foreground) return ZStyledItem::paintLayer(backend, layer);
+                if (caret) backend->fillRect({ bounds_.x + 6, bounds_.y + 3, 1, bounds_.height - 6 }, ZincX::ZColor(255, 255, 255));
+            }
+        };
+        for (bool cached : { false, true }) {
+            ZStyle style;
+            ZStyleElement element;
+            element.background = ZincX::ZColor(30, 34, 52);
+            element.border = ZincX::ZColor(120, 130, 200);
+            element.borderWidth = 1;
+            element.borderStyle = ZincX::BorderStyle::Dotted;
+            element.shadow = ZincX::ZColor(0, 0, 0, 96);
+            element.shadowOffset = { 3, 3 };
+            style.setElement(ZincX::WidgetState::Normal, element);
+            ZGraphicsView view(std::make_unique<SoftwareGraphicsBackend>(640, 480), ZincX::RenderMode::Graphics16);
+            std::vector<std::unique_ptr<CaretField>> fields;
+            for (int i = 0; i < 100; ++i) {
+                fields.push_back(std::make_unique<CaretField>(&style));
+                fields.back()->setBounds({ (i % 4) * 160 + 4, (i / 4) * 19 + 2, 152, 17 });
+                fields.back()->setText("Field");
+                fields.back()->setLayerCached(ZincX::StyleLayer::Background, cached);
+                view.addItem(fields.back().get());
+            }
+            view.render();
+            runner.run(std::string("render/styled_caret_blink/background=") + (cached ? "cached" : "uncached"), 100, [&] {
+                for (auto& field : fields) {
+                    field->caret = !field->caret;
+                    field->invalidate();
+                }
+                view.render();
+            });
+        }
+
+        // Draw list to GPU instances, as VulkanGraphicsBackend::submit() does: a labelled button per widget.
+        ZGlyphAtlas atlas(ZincX::GLYPH_ATLAS_SIZE, ZincX::GLYPH_ATLAS_SIZE, &SoftwareGraphicsBackend::builtinGlyph);
+        ZTextRunCache runs(ZincX::TEXT_RUN_CACHE_ENTRIES);
+        const ZFontKey font{ 0, SoftwareGraphicsBackend::kGlyphHeight, ZincX::FontWeight::Normal };
+        for (int count : { 1000, 10000 }) {
+            ZDrawList list;
+            for (int i = 0; i < count; ++i) {
+                const ZincX::ZRect cell{ (i % 100) * 19, (i / 100) * 10 % kSurface.height, 18, 9 };
+                list.fillRect(cell, ZincX::ZColor(40, 40, 48));
+                list.drawRect(cell, ZincX::ZColor(90, 90, 110));
+                list.drawText("OK", cell, ZincX::ZColor(230, 230, 230), ZincX::TextAlignment::Center);
+            }
+            ZQuadBatch batch;
+            runner.run("render/quad_batch/widgets=" + std::to_string(count), count, [&] {
+                batch.clear({ 0, 0, kSurface.width, kSurface.height });
+                batch.add(list, atlas, runs, font);
+            });
+        }
+    }
+
+    void benchEvents(Runner& runner) {
+        constexpr int kBatch = 1024;
+        for (int listeners : { 1, 8, 64 }) {
+            ZEventManager manager;
+            std::uint64_t delivered = 0;
+            for (int i = 0; i < listeners; ++i) manager.registerListener(nullptr, [&delivered](const ZEvent&) { ++delivered; });
+            runner.run("event/dispatch/listeners=" + std::to_string(listeners), kBatch, [&] {
+                for (int i = 0; i < kBatch; ++i) manager.queueEvent(ZKeyEvent(ZincX::EventType::KeyPress, 'a' + i % 26));
+                manager.dispatchEvents();
+            });
+        }
+        {
+            ZEventManager manager;
+            manager.registerListener(nullptr, [](const ZEvent&) {});
+            manager.setCoalescePolicy(ZincX::EventType::MouseMove, ZincX::CoalescePolicy::Coalesce);
+            runner.run("event/coalesce/mouse_moves", kBatch, [&] {
+                for (int i = 0; i < kBatch; ++i) manager.queueEvent(ZMouseEvent(ZincX::EventType::MouseMove, { i, i }, 0));
+                manager.dispatchEvents();
+            });
+        }
+        {
+            // Posting cost alone; the queue is emptied every kBatch posts without listeners.
+            ZEventManager manager;
+            int queued = 0;
+            runner.run("event/queue_only", 1, [&] {
+                manager.queueEvent(ZKeyEvent(ZincX::EventType::KeyPress, 'a'));
+                if (++queued == kBatch) {
+                    queued = 0;
+                    manager.dispatchEvents();
+                }
+            });
+        }
+    }
+
+    void benchSignals(Runner& runner) {
+        for (int slots : { 1, 8 }) {
+            ZSignal<int> signal;
+            std::vector<ZConnection> connections;
+            int sum = 0;
+            for (int i = 0; i < slots; ++i) connections.push_back(signal.connect([&sum](int v) { sum += v; }));
+            runner.run("signal/emit/slots=" + std::to_string(slots), slots, [&] { signal.emit(1); });
+        }
+        {
+            ZSignal<int> signal;
+            runner.run("signal/connect_disconnect", 1, [&] {
+                ZConnection connection = signal.connect([](int) {});
+            });
+        }
+    }
+
+    void benchAnimation(Runner& runner) {
+        // Looping fades on separate items, ticked at 60 Hz timestamps.
+        for (int count : { 100, 10000 }) {
+            ZGraphicsView view(std::make_unique<CountingBackend>(ZincX::ZSize{ 1920, 1080 }));
+            std::vector<BenchItem> items(static_cast<std::size_t>(count));
+            std::vector<std::unique_ptr<ZFloatAnim>> animations;
+            float sink = 0.0f;
+            ZAnimManager manager;
+            for (int i = 0; i < count; ++i) {
+                BenchItem& item = items[static_cast<std::size_t>(i)];
+                item.setBounds({ (i % 100) * 19, (i / 100) * 10 % 1080, 18, 9 });
+                view.addItem(&item);
+                animations.push_back(std::make_unique<ZFloatAnim>(0.0f, 1.0f, [&sink](float v) { sink += v; }, &item));
+                animations.back()->setDuration(static_cast<std::uint64_t>(200000 + i % 7 * 50000));
+                animations.back()->setEasing(static_cast<ZincX::Easing>(i % 4));
+                animations.back()->setLoopCount(0);
+                manager.start(*animations.back());
+            }
+            std::uint64_t frame = 1000000;
+            manager.tick(frame);
+            view.render();
+            runner.run("anim/tick/animations=" + std::to_string(count), count, [&] {
+                frame += 16667;
+                manager.tick(frame);
+            });
+            runner.run("anim/tick_render/animations=" + std::to_string(count), count, [&] {
+                frame += 16667;
+                manager.tick(frame);
+                view.render();
+            });
+        }
+    }
+
+    /** @brief Model whose cells are computed from their index; holds no rows at all. */
+    class GeneratedModel : public ZModel {
+    public:
+        explicit GeneratedModel(std::size_t rows) : rows_(rows) {}
+
+        std::size_t rowCount() const override { return rows_; }
+        std::size_t columnCount() const override { return 4; }
+        void data(std::size_t row, std::size_t column, std::string& out) const override {
+            char text[32];
+            const int length = std::snprintf(text, sizeof(text), "r%zu c%zu", row, column);
+            out.assign(text, static_cast<std::size_t>(length));
+        }
+
+    private:
+        std::size_t rows_;
+    };
+
+    void benchWidgets(Runner& runner) {
+        // A 4-column table filling a 1080p view with 20-unit rows (55 rows shown).
+        for (std::size_t rows : { std::size_t(1000), std::size_t(1000000), std::size_t(50000000) }) {
+            GeneratedModel model(rows);
+            ZGraphicsView view(std::make_unique<CountingBackend>(ZincX::ZSize{ 1920, 1080 }));
+            ZTableView table(20);
+            table.setBounds({ 0, 0, 1920, 1080 });
+            table.setModel(&model);
+            view.addItem(&table);
+            view.render();
+            const double shown = static_cast<double>(table.rowViewCount());
+            const std::string suffix = "/rows=" + std::to_string(rows);
+            int offset = 0;
+            runner.run("table/scroll" + suffix, shown, [&] {
+                offset = offset + 7 > table.contentHeight() - 1080 ? 0 : offset + 7;
+                table.setScrollOffset(offset);
+                view.render();
+            });
+            std::uint32_t seed = 1;
+            runner.run("table/jump" + suffix, shown, [&] {
+                seed = seed * 1664525u + 1013904223u;
+                table.setScrollOffset(static_cast<int>(seed % static_cast<std::uint32_t>(table.contentHeight())));
+                view.render();
+            });
+        }
+        {
+            // A feed of 1000 scattered cell updates per frame into a 100k-row table, one batch per frame.
+            constexpr std::size_t kRows = 100000;
+            ZTableModel model(4);
+            for (std::size_t i = 0; i < kRows; ++i) model.appendRow({ "sym" + std::to_string(i), "0", "0", "0" });
+            ZGraphicsView view(std::make_unique<CountingBackend>(ZincX::ZSize{ 1920, 1080 }));
+            ZTableView table(20);
+            table.setBounds({ 0, 0, 1920, 1080 });
+            table.setModel(&model);
+            view.addItem(&table);
+            view.render();
+            std::uint32_t seed = 7;
+            int tick = 0;
+            auto feed = [&] {
+                ++tick;
+                for (int i = 0; i < 1000; ++i) {
+                    seed = seed * 1664525u + 1013904223u;
+                    // Every eighth update lands on a shown row.
+                    const std::size_t row = (seed >> 8) % 8 == 0 ? (seed >> 12) % 60 : (seed >> 12) % kRows;
+                    model.setText(row, 1 + (seed >> 4) % 3, std::to_string(tick + i));
+                }
+            };
+            runner.run("table/feed_batched", 1000, [&] {
+                {
+                    ZModelBatch batch(model);
+                    feed();
+                }
+                view.render();
+            });
+            runner.run("table/feed_unbatched", 1000, [&] {
+                feed();
+                view.render();
+            });
+        }
+    }
+
+    /** @brief Styled item that scene snapshots can recreate. */
+    class SnapshotItem : public ZStyledItem {
+    public:
+        std::uint32_t typeId() const override { return 1; }
+    };
+
+    void benchUndo(Runner& runner) {
+        {
+            // Typing into a label: every keystroke merges into one entry, sealed every 64 keys.
+            ZStyledItem label;
+            ZUndoRedoManager history;
+            std::string text;
+            int keys = 0;
+            runner.run("undo/edit_merged", 1, [&] {
+                if (++keys % 64 == 0) {
+                    text.clear();
+                    history.seal();
+                }
+                text.push_back(static_cast<char>('a' + keys % 26));
+                history.edit(label, ZStyledItem::TextProperty, [&] { label.setText(text); });
+            });
+        }
+        {
+            // Moving 100 items as one group, then stepping back and forth over it.
+            ZGraphicsScene scene;
+            std::vector<SnapshotItem*> items;
+            for (int i = 0; i < 100; ++i) {
+                items.push_back(scene.createItem<SnapshotItem>());
+                items.back()->setBounds({ i * 10, 0, 8, 8 });
+            }
+            ZUndoRedoManager history;
+            history.beginGroup();
+            for (SnapshotItem* item : items) {
+                history.edit(*item, ZGraphicsItem::BoundsProperty, [&] {
+                    const ZincX::ZRect b = item->bounds();
+                    item->setBounds({ b.x, b.y + 50, b.width, b.height });
+                });
+            }
+            history.endGroup();
+            runner.run("undo/undo_redo/items=100", 200, [&] {
+                history.undo();
+                history.redo();
+            });
+        }
+        {
+            // A 10k-item scene, a tenth of the items parented, saved into and loaded from one buffer.
+            constexpr int kItems = 10000;
+            ZGraphicsScene scene;
+            std::vector<SnapshotItem*> items;
+            for (int i = 0; i < kItems; ++i) {
+                SnapshotItem* item = scene.createItem<SnapshotItem>();
+                item->setBounds({ (i % 100) * 20, (i / 100) * 20, 16, 16 });
+                item->setText("item " + std::to_string(i));
+                if (i % 10 != 0) item->setParentItem(items[static_cast<std::size_t>(i - i % 10)]);
+                items.push_back(item);
+            }
+            ZSceneSerializer serializer;
+            serializer.registerType<SnapshotItem>(1);
+            std::vector<std::uint8_t> snapshot;
+            runner.run("undo/snapshot_save/items=10000", kItems, [&] {
+                snapshot.clear();
+                serializer.save(scene, snapshot);
+            });
+            ZGraphicsScene target;
+            std::vector<ZGraphicsItem*> loaded;
+            runner.run("undo/snapshot_load/items=10000", kItems, [&] {
+                for (ZGraphicsItem* item : loaded) target.destroyItem(item);
+                serializer.load(target, snapshot, &loaded);
+            });
+        }
+    }
+
+#ifdef ZINCX_NETWORK
+    void benchNetwork(Runner& runner) {
+        // 64 telemetry streams over loopback TCP, each delivering one 256-byte sample per frame.
+        constexpr int kStreams = 64;
+        ZEventManager events;
+        ZNet net(events);
+        const ZNet::ConnectionId listener = net.listen(0, ZincX::Protocol::TCP, "127.0.0.1");
+        std::vector<ZNet::ConnectionId> senders;
+        std::size_t received = 0;
+        int accepted = 0;
+        events.subscribe(ZincX::EventType::Network, [&](const ZEvent& event) {
+            const ZNetEvent* net = event.as<ZNetEvent>();
+            if (net->listener == listener) ++accepted;
+            received += net->size;
+        });
+        for (int i = 0; i < kStreams; ++i) senders.push_back(net.connect("127.0.0.1", net.localPort(listener)));
+        while (accepted < kStreams) {
+            net.poll(10);
+            events.dispatchEvents();
+        }
+        const std::vector<std::uint8_t> sample(256, 0x5A);
+        runner.run("net/telemetry_frame/streams=64", kStreams, [&] {
+            for (ZNet::ConnectionId sender : senders) net.send(sender, sample);
+            const std::size_t expected = received + sample.size() * kStreams;
+            while (received < expected) {
+                net.poll(10);
+                events.dispatchEvents();
+            }
+        });
+    }
+#endif
+
+    void benchAllocation(Runner& runner) {
+        constexpr int kItems = 1000;
+        {
+            ZGraphicsScene scene;
+            std::vector<std::unique_ptr<BenchItem>> items(kItems);
+            runner.run("alloc/items_heap/items=1000", kItems, [&] {
+                for (auto& item : items) {
+                    item = std::make_unique<BenchItem>();
+                    scene.addItem(item.get());
+                }
+                for (auto& item : items) item.reset();
+            });
+        }
+        {
+            ZGraphicsScene scene;
+            std::vector<BenchItem*> items(kItems);
+            runner.run("alloc/items_pooled/items=1000", kItems, [&] {
+                for (auto& item : items) item = scene.createItem<BenchItem>();
+                for (BenchItem* item : items) scene.destroyItem(item);
+            });
+        }
+        {
+            // The scratch a frame of layout and event handling asks for, in many small pieces.
+            ZincX::ZArena& arena = ZincX::ZArena::frame();
+            runner.run("alloc/frame_arena/vectors=100", 100, [&] {
+                for (int i = 0; i < 100; ++i) {
+                    ZincX::ZArenaVector<int> scratch(16 + i % 16, 0, ZincX::ZArenaAllocator<int>(arena));
+                    scratch.back() = i;
+                }
+                arena.reset();
+            });
+            runner.run("alloc/heap_vectors/vectors=100", 100, [&] {
+                for (int i = 0; i < 100; ++i) {
+                    std::vector<int> scratch(16 + i % 16, 0);
+                    scratch.back() = i;
+                }
+            });
+        }
+    }
+
+    /** @brief A grid of grids with cells x cells leaves per inner grid. */
+    std::unique_ptr<ZGrid> makeGridTree(int outer, int inner) {
+        auto root = std::make_unique<ZGrid>(2);
+        for (int i = 0; i < outer * outer; ++i) {
+            auto cell = std::make_unique<ZGrid>(1);
+            for (int j = 0; j < inner * inner; ++j) {
+                cell->addChild(std::make_unique<ZLayoutItem>(nullptr, ZincX::ZSize{ 8 + j % 5, 6 + j % 3 }), j / inner, j % inner);
+            }
+            root->setColumnStretch(i % outer, 1);
+            root->setRowStretch(i / outer, 1);
+            root->addChild(std::move(cell), i / outer, i % outer);
+        }
+        return root;
+    }
+
+    void benchLayout(Runner& runner) {
+#ifdef ZINCX_THREAD_SAFE
+        ZCompute pool(std::make_unique<CPUComputeBackend>(std::max(1u, std::thread::hardware_concurrency())));
+#endif
+        // (outer, inner): 10 x 10 grids of 10 x 10 leaves is 10,101 nodes.
+        for (auto [outer, inner] : { std::pair{ 4, 8 }, std::pair{ 10, 10 }, std::pair{ 20, 15 } }) {
+            auto root = makeGridTree(outer, inner);
+            const std::size_t nodes = root->subtreeSize();
+            const std::string n = std::to_string(nodes);
+            root->layout({ 0, 0, 1920, 1080 });
+
+            bool wide = false;
+            runner.run("layout/grid_resize/nodes=" + n, double(nodes), [&] {
+                wide = !wide;
+                root->layout({ 0, 0, wide ? 1600 : 1920, 1080 });
+            });
+            ZLayoutNode* leaf = root->child(0)->child(0);
+            bool big = false;
+            runner.run("layout/grid_leaf_change/nodes=" + n, 1, [&] {
+                big = !big;
+                leaf->setSizeHint(big ? ZincX::ZSize{ 20, 12 } : ZincX::ZSize{ 8, 6 });
+                root->layout({ 0, 0, 1920, 1080 });
+            });
+            runner.run("layout/grid_clean/nodes=" + n, 1, [&] { root->layout({ 0, 0, 1920, 1080 }); });
+#ifdef ZINCX_THREAD_SAFE
+            runner.run("layout/grid_resize_parallel/nodes=" + n, double(nodes), [&] {
+                wide = !wide;
+                root->layout({ 0, 0, wide ? 1600 : 1920, 1080 }, &pool);
+            });
+#endif
+        }
+    }
+
+    void benchResources(Runner& runner) {
+        constexpr std::size_t kNames = 1024;
+        constexpr std::size_t kBlobBytes = 1024;
+        std::vector<std::string> names;
+        for (std::size_t i = 0; i < kNames; ++i) names.push_back("asset/" + std::to_string(i) + ".bin");
+        ZCompute inlinePool(std::make_unique<CPUComputeBackend>(0));
+        auto loader = [](const std::string& name) {
+            return std::make_unique<ZBlobResource>(ZincX::ResourceType::Texture, std::vector<std::uint8_t>(kBlobBytes, std::uint8_t(name.size())));
+        };
+
+        {
+            ZResourceManager cache(kNames * kBlobBytes * 2, ZincX::RESOURCE_CACHE_SHARDS, &inlinePool);
+            cache.setLoader(ZincX::ResourceType::Texture, loader);
+            for (const auto& name : names) cache.load(ZincX::ResourceType::Texture, name).wait();
+            std::size_t next = 0;
+            runner.run("resource/hit", 1, [&] {
+                cache.load(ZincX::ResourceType::Texture, names[next++ % kNames]).resource();
+            });
+            runner.run("resource/find", 1, [&] {
+                cache.find(ZincX::ResourceType::Texture, names[next++ % kNames]).resource();
+            });
+        }
+        {
+            // A budget of a sixteenth of the working set: every cycled load misses and evicts.
+            ZResourceManager cache(kNames * kBlobBytes / 16, ZincX::RESOURCE_CACHE_SHARDS, &inlinePool);
+            cache.setLoader(ZincX::ResourceType::Texture, loader);
+            std::size_t next = 0;
+            runner.run("resource/miss_evict", 1, [&] {
+                cache.load(ZincX::ResourceType::Texture, names[next++ % kNames]).wait();
+            });
+        }
+    }
+
+    const char* platformName() {
+        switch (ZincX::CURRENT_PLATFORM) {
+        case ZincX::Platform::DOS: return "DOS";
+        case ZincX::Platform::Win16: return "Win16";
+        case ZincX::Platform::Windows: return "Windows";
+        case ZincX::Platform::MacOS: return "MacOS";
+        case ZincX::Platform::Linux: return "Linux";
+        default: return "Embedded";
+        }
+    }
+
+    void writeJson(const std::vector<Result>& results, const Options& options) {
+        std::printf("{\n  \"suite\": \"zincx_bench\",\n  \"format\": 1,\n");
+        std::printf("  \"environment\": {\"platform\": \"%s\", \"compiler\": \"%s\", \"optimized\": %s, \"thread_safe\": %s, "
+                    "\"hardware_threads\": %u, \"repeats\": %d, \"min_sample_ms\": %.1f},\n",
+                    platformName(),
+#if defined(__VERSION__)
+                    __VERSION__,
+#else
+                    "unknown",
+#endif
+#ifdef NDEBUG
+                    "true",
+#else
+                    "false",
+#endif
+#ifdef ZINCX_THREAD_SAFE
+                    "true",
+#else
+                    "false",
+#endif
+                    std::thread::hardware_concurrency(), options.repeats, options.minSampleMs);
+        std::printf("  \"results\": [");
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            std::printf("%s\n    {\"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.2f, \"min_ns_per_op\": %.2f, "
+                        "\"max_ns_per_op\": %.2f, \"items_per_second\": %.0f}",
+                        i ? "," : "", r.name.c_str(), static_cast<unsigned long long>(r.iterations), r.medianNs, r.minNs,
+                        r.maxNs, r.medianNs > 0.0 ? r.itemsPerOp * 1e9 / r.medianNs : 0.0);
+        }
+        std::printf("\n  ]\n}\n");
+    }
+
+    int usage(const char* program) {
+        std::fprintf(stderr, "usage: %s [--filter <substring>] [--repeats <n>] [--min-time-ms <ms>]\n", program);
+        return 2;
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (!std::strcmp(argv[i], "--filter") && hasValue) {
+            options.filter = argv[++i];
+        } else if (!std::strcmp(argv[i], "--repeats") && hasValue) {
+            options.repeats = std::max(1, std::atoi(argv[++i]));
+        } else if (!std::strcmp(argv[i], "--min-time-ms") && hasValue) {
+            options.minSampleMs = std::max(0.1, std::atof(argv[++i]));
+        } else {
+            return usage(argv[0]);
+        }
+    }
+
+    Runner runner(options);
+    try {
+        benchRender(runner);
+        benchEvents(runner);
+        benchSignals(runner);
+        benchAnimation(runner);
+        benchWidgets(runner);
+        benchUndo(runner);
+#ifdef ZINCX_NETWORK
+        benchNetwork(runner);
+#endif
+        benchAllocation(runner);
+        benchLayout(runner);
+        benchResources(runner);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "zincx_bench: %s\n", e.what());
+        return 1;
+    }
+    writeJson(runner.results(), options);
+    return 0;
+}
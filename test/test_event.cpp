@@ -0,0 +1,140 @@
+/**
+ * @file test_event.cpp
+ * @brief Regression tests for ZEventManager dispatch.
+ */
+#include "ZTest.h"
+#include "event/ZEventManager.h"
+#include "event/ZSignal.h"
+#include "graphics/ZGraphicsItem.h"
+#include "graphics/ZGraphicsScene.h"
+
+namespace {
+    class Box : public ZGraphicsItem {
+    public:
+        explicit Box(const ZincX::ZRect& bounds) { setBounds(bounds); }
+        void draw(IZGraphicsBackend*) override {}
+    };
+
+    /** @brief Two boxes side by side in a scene the manager hit-tests. */
+    struct Fixture {
+        Fixture() {
+            scene.addItem(&left);
+            scene.addItem(&right);
+            events.setScene(&scene);
+        }
+
+        void mouse(ZincX::EventType type, const Box& box) {
+            const ZincX::ZRect& b = box.bounds();
+            events.queueEvent(ZMouseEvent(type, { b.x + 1, b.y + 1 }, 1));
+            events.dispatchEvents();
+        }
+
+        ZEventManager events;
+        ZGraphicsScene scene;
+        Box left{ { 0, 0, 10, 10 } };
+        Box right{ { 20, 0, 10, 10 } };
+    };
+}
+
+ZTEST(listenersAddedDuringDispatchStartWithTheNextEvent) {
+    Fixture f;
+    int calls = 0, added = 0, subscribed = 0;
+    for (int i = 0; i < 3; ++i) {
+        f.events.registerListener(&f.left, [&](const ZEvent&) {
+            ++calls;
+            // Enough new listeners to reallocate the list being walked.
+            for (int k = 0; k < 100; ++k) f.events.registerListener(&f.left, [&](const ZEvent&) { ++added; });
+            f.events.subscribe(ZincX::EventType::MouseClick, [&](const ZEvent&) { ++subscribed; });
+        });
+    }
+    f.mouse(ZincX::EventType::MouseClick, f.left);
+    ZCHECK(calls == 3);
+    ZCHECK(added == 0);
+    ZCHECK(subscribed == 0);
+
+    calls = 0;
+    f.mouse(ZincX::EventType::MouseClick, f.left);
+    ZCHECK(calls == 3);
+    ZCHECK(added == 300);
+    ZCHECK(subscribed == 3);
+}
+
+ZTEST(unregisteringDuringDispatchStopsDelivery) {
+    Fixture f;
+    Box child({ 0, 0, 5, 5 });
+    child.setParentItem(&f.left);
+    f.scene.addItem(&child);
+    int childCalls = 0, parentCalls = 0;
+    f.events.registerListener(&child, [&](const ZEvent&) {
+        ++childCalls;
+        f.events.unregisterItem(&child);
+    });
+    f.events.registerListener(&child, [&](const ZEvent&) { ++childCalls; });
+    f.events.registerListener(&f.left, [&](const ZEvent&) { ++parentCalls; });
+    f.mouse(ZincX::EventType::MouseClick, child);
+    ZCHECK(childCalls == 1);
+    ZCHECK(parentCalls == 0);
+
+    f.mouse(ZincX::EventType::MouseClick, child);
+    ZCHECK(childCalls == 1);
+    ZCHECK(parentCalls == 1);
+    f.events.unregisterItem(&child);
+}
+
+ZTEST(newClickReleasesThePreviousPress) {
+    Fixture f;
+    f.mouse(ZincX::EventType::MouseClick, f.left);
+    ZCHECK(f.left.state() == ZincX::WidgetState::Pressed);
+    f.mouse(ZincX::EventType::MouseClick, f.right);
+    ZCHECK(f.left.state() == ZincX::WidgetState::Normal);
+    ZCHECK(f.right.state() == ZincX::WidgetState::Pressed);
+    f.mouse(ZincX::EventType::MouseRelease, f.right);
+    ZCHECK(f.right.state() == ZincX::WidgetState::Normal);
+}
+
+ZTEST(releaseRestoresTheStateBeforeThePress) {
+    Fixture f;
+    f.left.setState(ZincX::WidgetState::Hovered);
+    f.mouse(ZincX::EventType::MouseClick, f.left);
+    ZCHECK(f.left.state() == ZincX::WidgetState::Pressed);
+    // A double click presses the same item again; the state to restore stays Hovered.
+    f.mouse(ZincX::EventType::MouseClick, f.left);
+    f.mouse(ZincX::EventType::MouseRelease, f.right);
+    ZCHECK(f.left.state() == ZincX::WidgetState::Hovered);
+
+    f.right.setState(ZincX::WidgetState::Disabled);
+    f.mouse(ZincX::EventType::MouseClick, f.right);
+    ZCHECK(f.right.state() == ZincX::WidgetState::Disabled);
+    f.mouse(ZincX::EventType::MouseRelease, f.right);
+    ZCHECK(f.right.state() == ZincX::WidgetState::Disabled);
+}
+
+ZTEST(slotMayEmitItsOwnSignal) {
+    ZSignal<int> signal;
+    int calls = 0;
+    ZConnection connection = signal.connect([&](int depth) {
+        ++calls;
+        if (depth < 3) signal.emit(depth + 1);
+    });
+    signal.emit(0);
+    ZCHECK(calls == 4);
+}
+
+ZTEST(slotsConnectedToANestedSignalGetCalled) {
+    // inner is only ever emitted from outer's slot, so the thread is always inside a slot then.
+    ZSignal<> outer, inner;
+    ZConnection late;
+    int innerCalls = 0;
+    ZConnection connection = outer.connect([&] {
+        if (!late.isConnected()) late = inner.connect([&] { ++innerCalls; });
+        inner.emit();
+    });
+    // The connection is made before inner's emit starts, so that emit already calls it.
+    outer.emit();
+    ZCHECK(innerCalls == 1);
+    outer.emit();
+    ZCHECK(innerCalls == 2);
+    ZCHECK(inner.slotCount() == 1);
+}
+
+ZTEST_MAIN()
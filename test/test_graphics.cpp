@@ -0,0 +1,81 @@
+/**
+ * @file test_graphics.cpp
+ * @brief Regression tests for the ZGraphicsItem hierarchy.
+ */
+#include "ZTest.h"
+#include "graphics/IZGraphicsBackend.h"
+#include "graphics/ZGraphicsItem.h"
+#include "graphics/ZGraphicsScene.h"
+#include "graphics/ZGraphicsView.h"
+#include "debug/ZProfiler.h"
+#include <memory>
+#include <vector>
+
+namespace {
+    class Box : public ZGraphicsItem {
+    public:
+        explicit Box(const ZincX::ZRect& bounds) { setBounds(bounds); }
+        void draw(IZGraphicsBackend*) override {}
+    };
+
+    /** @brief Draws nowhere; the tests look at the frame statistics. */
+    class NullBackend : public IZGraphicsBackend {
+    public:
+        void initialize(ZincX::RenderMode) override {}
+        ZincX::ZSize surfaceSize() const override { return { 1000, 1000 }; }
+        void setClipRect(const ZincX::ZRect&) override {}
+        void fillRect(const ZincX::ZRect&, const ZincX::ZColor&) override {}
+        void drawRect(const ZincX::ZRect&, const ZincX::ZColor&) override {}
+        void drawLine(const ZincX::ZPoint&, const ZincX::ZPoint&, const ZincX::ZColor&) override {}
+        void drawCircle(const ZincX::ZPoint&, int, const ZincX::ZColor&, bool) override {}
+        void drawEllipse(const ZincX::ZPoint&, int, int, const ZincX::ZColor&, bool) override {}
+        void drawPolygon(const std::vector<ZincX::ZPoint>&, const ZincX::ZColor&, bool) override {}
+        void drawText(const std::string&, const ZincX::ZRect&, const ZincX::ZColor&, ZincX::TextAlignment) override {}
+    };
+}
+
+ZTEST(orphanedChildDropsItsParentsTransform) {
+    ZGraphicsScene scene;
+    auto parent = std::make_unique<Box>(ZincX::ZRect{ 0, 0, 100, 100 });
+    Box child({ 0, 0, 10, 10 });
+    parent->setTransform(ZincX::ZMatrix::translation(40, 30));
+    child.setTransform(ZincX::ZMatrix::translation(5, 5));
+    child.setParentItem(parent.get());
+    scene.addItem(parent.get());
+    scene.addItem(&child);
+    ZCHECK(child.worldBounds() == (ZincX::ZRect{ 45, 35, 10, 10 }));
+
+    parent.reset();
+    ZCHECK(child.parentItem() == nullptr);
+    ZCHECK(child.worldTransform() == ZincX::ZMatrix::translation(5, 5));
+    ZCHECK(child.worldBounds() == (ZincX::ZRect{ 5, 5, 10, 10 }));
+}
+
+ZTEST(colorChannelsClampToByteRange) {
+    constexpr ZincX::ZColor color(300, -5, 128, 1000);
+    ZCHECK(color.r == 255 && color.g == 0 && color.b == 128 && color.a == 255);
+    ZCHECK(ZincX::ZColor(256, 0, 0).r == 255);
+}
+
+#ifdef ZINCX_PROFILE
+ZTEST(itemsCulledCountsEachItemOncePerFrame) {
+    ZGraphicsView view(std::make_unique<NullBackend>());
+    Box wide({ 0, 0, 1000, 10 });
+    Box corner({ 990, 990, 10, 10 });
+    Box unseen({ 500, 500, 10, 10 });
+    view.addItem(&wide);
+    view.addItem(&corner);
+    view.addItem(&unseen);
+    view.render();
+
+    // Two damaged rectangles far apart: wide is in both, corner in one, unseen in neither.
+    view.invalidate({ 0, 0, 10, 10 });
+    view.invalidate({ 990, 0, 10, 1000 });
+    ZProfiler::instance().endFrame();
+    view.render();
+    ZProfiler::instance().endFrame();
+    ZCHECK(ZProfiler::instance().lastFrame().count(ZProfileCounter::ItemsCulled) == 1);
+}
+#endif
+
+ZTEST_MAIN()
@@ -0,0 +1,53 @@
+/**
+ * @file test_log.cpp
+ * @brief Regression tests for ZLogger formatting and ring ownership.
+ */
+#include "ZTest.h"
+#include "common/ZLog.h"
+#include <string>
+#include <vector>
+#ifdef ZINCX_THREAD_SAFE
+#include <thread>
+#endif
+
+namespace {
+    /** @brief Routes the log into a vector for the lifetime of the capture. */
+    struct Capture {
+        Capture() {
+            ZincX::ZLogger::setLevel(ZincX::LogLevel::Debug);
+            ZincX::ZLogger::instance().setSink([this](const ZincX::ZLogRecord& record) { lines.emplace_back(record.message); });
+        }
+        ~Capture() { ZincX::ZLogger::instance().setSink({}); }
+
+        const std::vector<std::string>& drain() {
+            ZincX::ZLogger::instance().flush();
+            return lines;
+        }
+
+        std::vector<std::string> lines;
+    };
+}
+
+ZTEST(nullStringsLogAsNull) {
+    Capture capture;
+    const char* missing = nullptr;
+    ZincX::log(ZincX::LogLevel::Info, "name={}", missing);
+    ZincX::log(missing);
+    const std::vector<std::string>& lines = capture.drain();
+    ZCHECK(lines.size() == 2);
+    ZCHECK(lines.size() == 2 && lines[0] == "name=(null)" && lines[1] == "(null)");
+}
+
+#ifdef ZINCX_THREAD_SAFE
+ZTEST(ringsOfExitedThreadsAreReused) {
+    Capture capture;
+    for (int i = 0; i < 4; ++i) {
+        std::thread([i] { ZincX::log(ZincX::LogLevel::Info, "thread {}", i); }).join();
+    }
+    const std::vector<std::string>& lines = capture.drain();
+    ZCHECK(lines.size() == 4);
+    ZCHECK(lines.size() == 4 && lines[0] == "thread 0" && lines[3] == "thread 3");
+}
+#endif
+
+ZTEST_MAIN()
@@ -0,0 +1,48 @@
+/**
+ * @file test_resource.cpp
+ * @brief Regression tests for the ZResourceManager cache.
+ */
+#include "ZTest.h"
+#include "resource/ZResourceManager.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    std::unique_ptr<ZResource> blob(std::size_t size) {
+        return std::make_unique<ZBlobResource>(ZincX::ResourceType::Texture, std::vector<std::uint8_t>(size));
+    }
+}
+
+ZTEST(concurrentLoadsShareOneRequest) {
+    ZResourceManager cache(1024, 4);
+    int loads = 0;
+    cache.setLoader(ZincX::ResourceType::Texture, [&](const std::string&) {
+        ++loads;
+        return blob(16);
+    });
+    ZResourceHandle first = cache.load(ZincX::ResourceType::Texture, "a");
+    ZResourceHandle second = cache.load(ZincX::ResourceType::Texture, "a");
+    ZCHECK(first.wait() == second.wait());
+    ZCHECK(loads == 1);
+    ZCHECK(cache.usedBytes() == 16);
+}
+
+ZTEST(zeroByteEntriesAreEvictable) {
+    ZResourceManager cache(100, 1);
+    cache.setLoader(ZincX::ResourceType::Texture, [](const std::string&) { return blob(0); });
+    cache.load(ZincX::ResourceType::Texture, "loaded").wait();
+    cache.insert("inserted", blob(0));
+    cache.insert("big", blob(100));
+    ZCHECK(cache.size() == 3);
+
+    // Overflowing the budget walks the LRU tail: both empty entries go before the big one.
+    cache.insert("bigger", blob(100));
+    ZCHECK(!cache.find(ZincX::ResourceType::Texture, "loaded").isValid());
+    ZCHECK(!cache.find(ZincX::ResourceType::Texture, "inserted").isValid());
+    ZCHECK(!cache.find(ZincX::ResourceType::Texture, "big").isValid());
+    ZCHECK(cache.find(ZincX::ResourceType::Texture, "bigger").isValid());
+    ZCHECK(cache.usedBytes() == 100);
+}
+
+ZTEST_MAIN()
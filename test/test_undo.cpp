@@ -0,0 +1,78 @@
+/**
+ * @file test_undo.cpp
+ * @brief Regression tests for the ZUndoRedoManager history.
+ */
+#include "ZTest.h"
+#include "undo/ZUndoRedoManager.h"
+#include <stdexcept>
+
+namespace {
+    /** @brief Two integer properties. */
+    class Pair : public IZStateSerializable {
+    public:
+        std::uint32_t propertyCount() const override { return 2; }
+        void saveProperty(std::uint32_t id, ZByteWriter& out) const override { out.i32(values[id]); }
+        void loadProperty(std::uint32_t id, ZByteReader& in) override { values[id] = in.i32(); }
+
+        int values[2] = { 0, 0 };
+    };
+
+    void set(ZUndoRedoManager& history, Pair& pair, std::uint32_t id, int value, std::uint64_t time) {
+        history.edit(pair, id, [&] { pair.values[id] = value; }, time);
+    }
+}
+
+ZTEST(throwingEditKeepsTheRedoHistory) {
+    ZUndoRedoManager history;
+    Pair pair;
+    set(history, pair, 0, 1, 0);
+    history.seal();
+    set(history, pair, 0, 2, 0);
+    history.undo();
+    bool thrown = false;
+    try {
+        history.edit(pair, 0, [] { throw std::runtime_error("rejected"); }, 10);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    ZCHECK(thrown);
+    ZCHECK(history.canRedo());
+    history.redo();
+    ZCHECK(pair.values[0] == 2);
+
+    // A successful edit after an undo still replaces the redo tail.
+    history.undo();
+    set(history, pair, 1, 5, 20);
+    ZCHECK(!history.canRedo());
+    ZCHECK(history.size() == 2);
+    history.undo();
+    ZCHECK(pair.values[0] == 1 && pair.values[1] == 0);
+}
+
+ZTEST(nestedEditsJoinTheOuterEntry) {
+    ZUndoRedoManager history;
+    Pair pair;
+    set(history, pair, 0, 1, 0);
+    // Within the merge interval of the first edit: the outer edit merges, its nested one joins it.
+    history.edit(pair, 0, [&] {
+        pair.values[0] = 2;
+        set(history, pair, 1, 7, 1);
+    }, 1);
+    ZCHECK(history.size() == 1);
+    history.undo();
+    ZCHECK(pair.values[0] == 0 && pair.values[1] == 0);
+    history.redo();
+    ZCHECK(pair.values[0] == 2 && pair.values[1] == 7);
+
+    // A merged entry that took nested edits no longer merges.
+    set(history, pair, 0, 3, 2);
+    ZCHECK(history.size() == 2);
+
+    history.seal();
+    history.edit(pair, 1, [&] { set(history, pair, 0, 4, 3); }, 3);
+    ZCHECK(history.size() == 3);
+    history.undo();
+    ZCHECK(pair.values[0] == 3 && pair.values[1] == 7);
+}
+
+ZTEST_MAIN()
@@ -0,0 +1,121 @@
+/**
+ * @file test_widgets.cpp
+ * @brief Regression tests for the virtualized ZListView.
+ */
+#include "ZTest.h"
+#include "graphics/IZGraphicsBackend.h"
+#include "graphics/ZGraphicsView.h"
+#include "mvc/ZModel.h"
+#include "widgets/ZListView.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    class CountModel : public ZModel {
+    public:
+        explicit CountModel(std::size_t rows) : rows_(rows) {}
+        std::size_t rowCount() const override { return rows_; }
+        void data(std::size_t row, std::size_t, std::string& out) const override { out = "row " + std::to_string(row); }
+
+    private:
+        std::size_t rows_;
+    };
+
+    /** @brief Keeps the row views it creates, so tests can look at where they are. */
+    class ProbeList : public ZListView {
+    public:
+        using ZListView::ZListView;
+        std::vector<ZRowView*> views;
+
+    protected:
+        std::unique_ptr<ZRowView> createRowView() override {
+            std::unique_ptr<ZRowView> view = ZListView::createRowView();
+            views.push_back(view.get());
+            return view;
+        }
+    };
+
+    /** @brief Checks that every bound row's top lands exactly at row * height - scroll in the view. */
+    bool rowsExact(std::size_t rows, int rowHeight, int scroll) {
+        CountModel model(rows);
+        ProbeList list(rowHeight);
+        list.setBounds({ 0, 5, 80, 100 });
+        list.setModel(&model);
+        list.setScrollOffset(scroll);
+        bool exact = list.scrollOffset() == scroll;
+        for (const ZRowView* view : list.views) {
+            const long long expected = static_cast<long long>(view->row()) * rowHeight - scroll + 5;
+            exact = exact && view->worldTransform().mapRect({ 0, 0, 1, rowHeight }).y == expected;
+        }
+        return exact && !list.views.empty();
+    }
+
+    struct Text {
+        std::string text;
+        ZincX::ZRect rect;
+        ZincX::ZRect clip;
+    };
+
+    /** @brief Replays frames through the virtual interface and keeps the text drawn, with its clip. */
+    class TextRecorder : public IZGraphicsBackend {
+    public:
+        void initialize(ZincX::RenderMode) override {}
+        ZincX::ZSize surfaceSize() const override { return { 100, 100 }; }
+        void setClipRect(const ZincX::ZRect& clip) override { clip_ = clip; }
+        void fillRect(const ZincX::ZRect&, const ZincX::ZColor&) override {}
+        void drawRect(const ZincX::ZRect&, const ZincX::ZColor&) override {}
+        void drawLine(const ZincX::ZPoint&, const ZincX::ZPoint&, const ZincX::ZColor&) override {}
+        void drawCircle(const ZincX::ZPoint&, int, const ZincX::ZColor&, bool) override {}
+        void drawEllipse(const ZincX::ZPoint&, int, int, const ZincX::ZColor&, bool) override {}
+        void drawPolygon(const std::vector<ZincX::ZPoint>&, const ZincX::ZColor&, bool) override {}
+        void drawText(const std::string& text, const ZincX::ZRect& bounds, const ZincX::ZColor&, ZincX::TextAlignment) override {
+            texts.push_back({ text, bounds, clip_ });
+        }
+
+        std::vector<Text> texts;
+
+    private:
+        ZincX::ZRect clip_{ 0, 0, 0, 0 };
+    };
+
+    const Text* findText(const std::vector<Text>& texts, const std::string& text) {
+        for (const Text& t : texts) {
+            if (t.text == text) return &t;
+        }
+        return nullptr;
+    }
+}
+
+ZTEST(rowsExactAtMillionRows) {
+    ZCHECK(rowsExact(1000000, 20, 19999849));
+    ZCHECK(rowsExact(1000000, 20, 19999800));
+}
+
+ZTEST(rowsExactAtFiftyMillionRows) {
+    ZCHECK(rowsExact(50000000, 1, 49999900));
+    ZCHECK(rowsExact(50000000, 1, 33333333));
+}
+
+ZTEST(cutRowsLayTextOutOverTheWholeRow) {
+    CountModel model(100);
+    ZListView list(20);
+    list.setBounds({ 0, 10, 100, 50 });
+    list.setModel(&model);
+    list.setScrollOffset(7);
+    auto backend = std::make_unique<TextRecorder>();
+    TextRecorder& recorder = *backend;
+    ZGraphicsView view(std::move(backend));
+    view.addItem(&list);
+    view.render();
+
+    // Row 0 is cut at the top, row 2 at the bottom; both keep their full row as layout rectangle.
+    const Text* top = findText(recorder.texts, "row 0");
+    const Text* middle = findText(recorder.texts, "row 1");
+    const Text* bottom = findText(recorder.texts, "row 2");
+    ZCHECK(top && top->rect == (ZincX::ZRect{ 0, 3, 100, 20 }) && top->clip == (ZincX::ZRect{ 0, 10, 100, 13 }));
+    ZCHECK(middle && middle->rect == (ZincX::ZRect{ 0, 23, 100, 20 }));
+    ZCHECK(bottom && bottom->rect == (ZincX::ZRect{ 0, 43, 100, 20 }) && bottom->clip == (ZincX::ZRect{ 0, 43, 100, 17 }));
+}
+
+ZTEST_MAIN()